@@ -4,6 +4,7 @@
 // SPDX-License-Identifier: MIT
 
 #include <stdio.h>
+#include <string.h>
 
 #include "py/binary.h"
 #include "py/objarray.h"
@@ -319,6 +320,430 @@ STATIC mp_obj_t mod_ujson_loads(mp_obj_t obj) {
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_1(mod_ujson_loads_obj, mod_ujson_loads);
 
+#if MICROPY_PY_UJSON_PARSER
+
+// The Parser type below is an incremental pull parser.  It reads the stream
+// in chunks into a fixed buffer and produces one event per call, keeping only
+// the text of the current token and a bit per level of nesting, so that the
+// caller decides which values are turned into Python objects.
+
+#define JSON_PARSER_DEFAULT_BUFSIZE (128)
+
+enum {
+    JSON_TOKEN_NONE,
+    JSON_TOKEN_STR,
+    JSON_TOKEN_INT,
+    JSON_TOKEN_FLOAT,
+    JSON_TOKEN_TRUE,
+    JSON_TOKEN_FALSE,
+    JSON_TOKEN_NULL,
+};
+
+typedef struct _mp_obj_ujson_parser_t {
+    mp_obj_base_t base;
+    ujson_stream_t s;
+    byte *buf;
+    size_t buf_size;
+    size_t buf_len;
+    size_t buf_pos;
+    vstr_t token;
+    qstr event;
+    byte token_kind;
+    byte sep; // ',' or ':' when that must come before the next item, else 0
+    bool expect_key;
+    bool eof;
+    size_t depth;
+    size_t stack_alloc;
+    byte *stack; // one bit per level, set for a map
+} mp_obj_ujson_parser_t;
+
+// Returns the next byte of the stream without consuming it, or S_EOF.
+STATIC byte ujson_parser_peek(mp_obj_ujson_parser_t *self) {
+    if (self->buf_pos == self->buf_len) {
+        if (self->eof) {
+            return S_EOF;
+        }
+        mp_uint_t ret = self->s.read(self->s.stream_obj, self->buf, self->buf_size, &self->s.errcode);
+        if (ret == MP_STREAM_ERROR) {
+            mp_raise_OSError(self->s.errcode);
+        }
+        if (ret == 0) {
+            self->eof = true;
+            return S_EOF;
+        }
+        self->buf_len = ret;
+        self->buf_pos = 0;
+    }
+    return self->buf[self->buf_pos];
+}
+
+STATIC byte ujson_parser_next_byte(mp_obj_ujson_parser_t *self) {
+    byte c = ujson_parser_peek(self);
+    if (c != S_EOF) {
+        self->buf_pos += 1;
+    }
+    return c;
+}
+
+STATIC NORETURN void ujson_parser_fail(void) {
+    mp_raise_ValueError(translate("syntax error in JSON"));
+}
+
+STATIC bool ujson_parser_in_map(mp_obj_ujson_parser_t *self) {
+    size_t i = self->depth - 1;
+    return self->depth > 0 && (self->stack[i / 8] & (1 << (i % 8)));
+}
+
+STATIC void ujson_parser_push(mp_obj_ujson_parser_t *self, bool is_map) {
+    if (self->depth == self->stack_alloc * 8) {
+        self->stack = m_renew(byte, self->stack, self->stack_alloc, self->stack_alloc + 4);
+        self->stack_alloc += 4;
+    }
+    size_t i = self->depth++;
+    if (is_map) {
+        self->stack[i / 8] |= 1 << (i % 8);
+    } else {
+        self->stack[i / 8] &= ~(1 << (i % 8));
+    }
+    self->expect_key = is_map;
+    self->sep = 0;
+}
+
+STATIC void ujson_parser_expect_literal(mp_obj_ujson_parser_t *self, const char *rest) {
+    for (; *rest; ++rest) {
+        if (ujson_parser_next_byte(self) != (byte)*rest) {
+            ujson_parser_fail();
+        }
+    }
+}
+
+// Advances to the next event, returning MP_QSTR_NULL at the end of the stream.
+STATIC qstr ujson_parser_next(mp_obj_ujson_parser_t *self) {
+    byte c;
+    bool after_sep = false;
+    for (;;) {
+        c = ujson_parser_next_byte(self);
+        if (c == ',' || c == ':') {
+            if (c != self->sep) {
+                ujson_parser_fail();
+            }
+            self->sep = 0;
+            after_sep = true;
+        } else if (!unichar_isspace(c)) {
+            break;
+        }
+    }
+    // a key must be followed by ':', a value in a container by ',' unless
+    // the container ends, and a ',' by another item
+    bool is_end = c == '}' || c == ']';
+    if (self->sep == ':' || (self->sep == ',' && !is_end) || (after_sep && is_end)) {
+        ujson_parser_fail();
+    }
+
+    self->token_kind = JSON_TOKEN_NONE;
+    qstr event;
+    switch (c) {
+        case S_EOF:
+            if (self->depth != 0) {
+                ujson_parser_fail();
+            }
+            self->event = MP_QSTR_NULL;
+            return MP_QSTR_NULL;
+        case '{':
+        case '[':
+            if (self->expect_key) {
+                ujson_parser_fail();
+            }
+            ujson_parser_push(self, c == '{');
+            self->event = c == '{' ? MP_QSTR_start_map : MP_QSTR_start_array;
+            return self->event;
+        case '}':
+        case ']':
+            // a map can't end between a key and its value
+            if (self->depth == 0 || ujson_parser_in_map(self) != (c == '}')
+                || (c == '}' && !self->expect_key)) {
+                ujson_parser_fail();
+            }
+            self->depth -= 1;
+            self->expect_key = ujson_parser_in_map(self);
+            self->sep = self->depth > 0 ? ',' : 0;
+            self->event = c == '}' ? MP_QSTR_end_map : MP_QSTR_end_array;
+            return self->event;
+        case 't':
+            ujson_parser_expect_literal(self, "rue");
+            self->token_kind = JSON_TOKEN_TRUE;
+            event = MP_QSTR_boolean;
+            break;
+        case 'f':
+            ujson_parser_expect_literal(self, "alse");
+            self->token_kind = JSON_TOKEN_FALSE;
+            event = MP_QSTR_boolean;
+            break;
+        case 'n':
+            ujson_parser_expect_literal(self, "ull");
+            self->token_kind = JSON_TOKEN_NULL;
+            event = MP_QSTR_null;
+            break;
+        case '"':
+            vstr_reset(&self->token);
+            for (;;) {
+                c = ujson_parser_next_byte(self);
+                if (c == S_EOF) {
+                    ujson_parser_fail();
+                } else if (c == '"') {
+                    break;
+                } else if (c == '\\') {
+                    c = ujson_parser_next_byte(self);
+                    switch (c) {
+                        case 'b': c = 0x08; break;
+                        case 'f': c = 0x0c; break;
+                        case 'n': c = 0x0a; break;
+                        case 'r': c = 0x0d; break;
+                        case 't': c = 0x09; break;
+                        case 'u': {
+                            mp_uint_t num = 0;
+                            for (int i = 0; i < 4; i++) {
+                                c = (ujson_parser_next_byte(self) | 0x20) - '0';
+                                if (c > 9) {
+                                    c -= ('a' - ('9' + 1));
+                                }
+                                num = (num << 4) | c;
+                            }
+                            vstr_add_char(&self->token, num);
+                            continue;
+                        }
+                    }
+                }
+                vstr_add_byte(&self->token, c);
+            }
+            self->token_kind = JSON_TOKEN_STR;
+            if (self->expect_key) {
+                self->expect_key = false;
+                self->sep = ':';
+                self->event = MP_QSTR_map_key;
+                return MP_QSTR_map_key;
+            }
+            event = MP_QSTR_string;
+            break;
+        case '-':
+        case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7': case '8': case '9': {
+            vstr_reset(&self->token);
+            self->token_kind = JSON_TOKEN_INT;
+            bool has_exp = false;
+            for (;;) {
+                vstr_add_byte(&self->token, c);
+                byte prev = c;
+                c = ujson_parser_peek(self);
+                if (c == '.' && self->token_kind == JSON_TOKEN_INT && unichar_isdigit(prev)) {
+                    self->token_kind = JSON_TOKEN_FLOAT;
+                } else if ((c == 'E' || c == 'e') && !has_exp && unichar_isdigit(prev)) {
+                    self->token_kind = JSON_TOKEN_FLOAT;
+                    has_exp = true;
+                } else if (!unichar_isdigit(c) && !((c == '-' || c == '+') && (prev == 'E' || prev == 'e'))) {
+                    // a number ends with a digit, before a delimiter
+                    if (!unichar_isdigit(prev) || !(c == S_EOF || c == ',' || c == '}' || c == ']' || unichar_isspace(c))) {
+                        ujson_parser_fail();
+                    }
+                    break;
+                }
+                self->buf_pos += 1;
+            }
+            event = MP_QSTR_number;
+            break;
+        }
+        default:
+            ujson_parser_fail();
+    }
+
+    // a value has been completed, where a key wasn't expected
+    if (self->expect_key) {
+        ujson_parser_fail();
+    }
+    self->expect_key = ujson_parser_in_map(self);
+    self->sep = self->depth > 0 ? ',' : 0;
+    self->event = event;
+    return event;
+}
+
+STATIC mp_obj_t ujson_parser_token_value(mp_obj_ujson_parser_t *self) {
+    switch (self->token_kind) {
+        case JSON_TOKEN_STR:
+            return mp_obj_new_str(self->token.buf, self->token.len);
+        case JSON_TOKEN_INT:
+            return mp_parse_num_integer(self->token.buf, self->token.len, 10, NULL);
+        case JSON_TOKEN_FLOAT:
+            return mp_parse_num_decimal(self->token.buf, self->token.len, false, false, NULL);
+        case JSON_TOKEN_TRUE:
+            return mp_const_true;
+        case JSON_TOKEN_FALSE:
+            return mp_const_false;
+        default:
+            return mp_const_none;
+    }
+}
+
+STATIC bool ujson_parser_is_start(mp_obj_ujson_parser_t *self) {
+    return self->event == MP_QSTR_start_map || self->event == MP_QSTR_start_array;
+}
+
+STATIC mp_obj_t ujson_parser_make_new(const mp_obj_type_t *type, size_t n_args, const mp_obj_t *args, mp_map_t *kw_args) {
+    mp_arg_check_num(n_args, kw_args, 1, 2, false);
+    mp_obj_ujson_parser_t *self = m_new_obj(mp_obj_ujson_parser_t);
+    self->base.type = type;
+    const mp_stream_p_t *stream_p = mp_proto_get(MP_QSTR_protocol_stream, args[0]);
+    if (stream_p == NULL) {
+        mp_load_method(args[0], MP_QSTR_readinto, self->s.python_readinto);
+        self->s.bytearray_obj.base.type = &mp_type_bytearray;
+        self->s.bytearray_obj.typecode = BYTEARRAY_TYPECODE;
+        self->s.bytearray_obj.free = 0;
+        self->s.python_readinto[2] = MP_OBJ_FROM_PTR(&self->s.bytearray_obj);
+        self->s.stream_obj = &self->s;
+        self->s.read = ujson_python_readinto;
+    } else {
+        stream_p = mp_get_stream_raise(args[0], MP_STREAM_OP_READ);
+        self->s.stream_obj = args[0];
+        self->s.read = stream_p->read;
+    }
+    self->s.errcode = 0;
+    self->buf_size = JSON_PARSER_DEFAULT_BUFSIZE;
+    if (n_args > 1) {
+        self->buf_size = mp_obj_get_int(args[1]);
+        if (self->buf_size == 0) {
+            mp_raise_ValueError_varg(translate("Invalid %q"), MP_QSTR_bufsize);
+        }
+    }
+    self->buf = m_new(byte, self->buf_size);
+    self->buf_len = 0;
+    self->buf_pos = 0;
+    vstr_init(&self->token, 8);
+    self->event = MP_QSTR_NULL;
+    self->token_kind = JSON_TOKEN_NONE;
+    self->sep = 0;
+    self->expect_key = false;
+    self->eof = false;
+    self->depth = 0;
+    self->stack_alloc = 1;
+    self->stack = m_new(byte, 1);
+    return MP_OBJ_FROM_PTR(self);
+}
+
+STATIC mp_obj_t ujson_parser_iternext(mp_obj_t self_in) {
+    mp_obj_ujson_parser_t *self = MP_OBJ_TO_PTR(self_in);
+    qstr event = ujson_parser_next(self);
+    if (event == MP_QSTR_NULL) {
+        return MP_OBJ_STOP_ITERATION;
+    }
+    return MP_OBJ_NEW_QSTR(event);
+}
+
+// Parser.value(): returns the current key or value, and for the start of a
+// container parses all of it into a list or dict.
+STATIC mp_obj_t ujson_parser_value(mp_obj_t self_in) {
+    mp_obj_ujson_parser_t *self = MP_OBJ_TO_PTR(self_in);
+    if (!ujson_parser_is_start(self)) {
+        return ujson_parser_token_value(self);
+    }
+
+    // parse the container non-recursively, as _mod_ujson_load does
+    size_t depth = self->depth;
+    mp_obj_t root = self->event == MP_QSTR_start_map ? mp_obj_new_dict(0) : mp_obj_new_list(0, NULL);
+    mp_obj_t stack = mp_obj_new_list(0, NULL);
+    mp_obj_t top = root;
+    mp_obj_t key = MP_OBJ_NULL;
+    while (self->depth >= depth) {
+        qstr event = ujson_parser_next(self);
+        if (event == MP_QSTR_end_map || event == MP_QSTR_end_array) {
+            if (self->depth >= depth) {
+                mp_obj_list_t *stack_list = MP_OBJ_TO_PTR(stack);
+                stack_list->len -= 1;
+                top = stack_list->items[stack_list->len];
+            }
+            continue;
+        }
+        if (event == MP_QSTR_map_key) {
+            key = ujson_parser_token_value(self);
+            continue;
+        }
+        mp_obj_t next;
+        bool enter = ujson_parser_is_start(self);
+        if (enter) {
+            next = event == MP_QSTR_start_map ? mp_obj_new_dict(0) : mp_obj_new_list(0, NULL);
+        } else {
+            next = ujson_parser_token_value(self);
+        }
+        if (key == MP_OBJ_NULL) {
+            mp_obj_list_append(top, next);
+        } else {
+            mp_obj_dict_store(top, key, next);
+            key = MP_OBJ_NULL;
+        }
+        if (enter) {
+            mp_obj_list_append(stack, top);
+            top = next;
+        }
+    }
+    return root;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(ujson_parser_value_obj, ujson_parser_value);
+
+// Parser.skip(): at the start of a container, consumes it without creating any objects.
+STATIC mp_obj_t ujson_parser_skip(mp_obj_t self_in) {
+    mp_obj_ujson_parser_t *self = MP_OBJ_TO_PTR(self_in);
+    if (ujson_parser_is_start(self)) {
+        size_t depth = self->depth;
+        while (self->depth >= depth) {
+            ujson_parser_next(self);
+        }
+    }
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(ujson_parser_skip_obj, ujson_parser_skip);
+
+// Parser.find(key): advances past the next map key equal to key, at any
+// depth, and returns the event of its value, or None at the end of the stream.
+STATIC mp_obj_t ujson_parser_find(mp_obj_t self_in, mp_obj_t key_in) {
+    mp_obj_ujson_parser_t *self = MP_OBJ_TO_PTR(self_in);
+    size_t key_len;
+    const char *key = mp_obj_str_get_data(key_in, &key_len);
+    for (;;) {
+        qstr event = ujson_parser_next(self);
+        if (event == MP_QSTR_NULL) {
+            return mp_const_none;
+        }
+        if (event == MP_QSTR_map_key && self->token.len == key_len
+            && memcmp(self->token.buf, key, key_len) == 0) {
+            return MP_OBJ_NEW_QSTR(ujson_parser_next(self));
+        }
+    }
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_2(ujson_parser_find_obj, ujson_parser_find);
+
+STATIC mp_obj_t ujson_parser_get_depth(mp_obj_t self_in) {
+    mp_obj_ujson_parser_t *self = MP_OBJ_TO_PTR(self_in);
+    return MP_OBJ_NEW_SMALL_INT(self->depth);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(ujson_parser_get_depth_obj, ujson_parser_get_depth);
+
+STATIC const mp_rom_map_elem_t ujson_parser_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_value), MP_ROM_PTR(&ujson_parser_value_obj) },
+    { MP_ROM_QSTR(MP_QSTR_skip), MP_ROM_PTR(&ujson_parser_skip_obj) },
+    { MP_ROM_QSTR(MP_QSTR_find), MP_ROM_PTR(&ujson_parser_find_obj) },
+    { MP_ROM_QSTR(MP_QSTR_depth), MP_ROM_PTR(&ujson_parser_get_depth_obj) },
+};
+
+STATIC MP_DEFINE_CONST_DICT(ujson_parser_locals_dict, ujson_parser_locals_dict_table);
+
+STATIC const mp_obj_type_t ujson_parser_type = {
+    { &mp_type_type },
+    .name = MP_QSTR_Parser,
+    .make_new = ujson_parser_make_new,
+    .getiter = mp_identity_getiter,
+    .iternext = ujson_parser_iternext,
+    .locals_dict = (mp_obj_dict_t*)&ujson_parser_locals_dict,
+};
+
+#endif // MICROPY_PY_UJSON_PARSER
+
 STATIC const mp_rom_map_elem_t mp_module_ujson_globals_table[] = {
 #if CIRCUITPY
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_json) },
@@ -329,6 +754,9 @@ STATIC const mp_rom_map_elem_t mp_module_ujson_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR_dumps), MP_ROM_PTR(&mod_ujson_dumps_obj) },
     { MP_ROM_QSTR(MP_QSTR_load), MP_ROM_PTR(&mod_ujson_load_obj) },
     { MP_ROM_QSTR(MP_QSTR_loads), MP_ROM_PTR(&mod_ujson_loads_obj) },
+    #if MICROPY_PY_UJSON_PARSER
+    { MP_ROM_QSTR(MP_QSTR_Parser), MP_ROM_PTR(&ujson_parser_type) },
+    #endif
 };
 
 STATIC MP_DEFINE_CONST_DICT(mp_module_ujson_globals, mp_module_ujson_globals_table);
@@ -20,8 +20,28 @@
 
 #define FLAG_DEBUG 0x1000
 
+#if MICROPY_PY_URE_PREFILTER
+// Maximum length of the literal prefix kept for scanning
+#define RE_PREFIX_MAX (16)
+// Maximum nesting of branches followed when computing the first-byte set
+#define RE_FIRST_SET_MAX_DEPTH (16)
+
+enum {
+    RE_FILTER_NONE,  // every start position must be tried
+    RE_FILTER_BOL,   // pattern starts with ^, only the first position can match
+    RE_FILTER_PREFIX,// a match must start with prefix[0:prefix_len]
+    RE_FILTER_SET,   // a match must start with a byte in first_set
+};
+#endif
+
 typedef struct _mp_obj_re_t {
     mp_obj_base_t base;
+    #if MICROPY_PY_URE_PREFILTER
+    uint8_t filter;
+    uint8_t prefix_len;
+    char prefix[RE_PREFIX_MAX];
+    uint8_t first_set[256 / 8];
+    #endif
     ByteProg re;
 } mp_obj_re_t;
 
@@ -150,6 +170,147 @@ STATIC void re_print(const mp_print_t *print, mp_obj_t self_in, mp_print_kind_t
     mp_printf(print, "<re %p>", self);
 }
 
+#if MICROPY_PY_URE_PREFILTER
+
+// Code of the pattern proper, after the search prefix and the Save 0 of the
+// whole match.
+#define RE_PATTERN_CODE(prog) ((prog)->insts + NON_ANCHORED_PREFIX + 2)
+
+// Add to set every byte that the instruction at pc can start a match with.
+// Returns false if a match can start without consuming a byte, or if the
+// program is too involved to tell.
+STATIC bool re_first_set(const char *pc, uint8_t *set, int depth) {
+    for (; depth < RE_FIRST_SET_MAX_DEPTH; ++depth) {
+        int off;
+        switch (*pc++) {
+            case Char: {
+                byte c = *pc;
+                set[c >> 3] |= 1 << (c & 7);
+                return true;
+            }
+            case Class:
+            case ClassNot:
+            case NamedClass:
+                for (int i = 0; i < 256; ++i) {
+                    char c = i;
+                    int match = (pc[-1] == NamedClass) ? _re1_5_namedclassmatch(pc, &c) : _re1_5_classmatch(pc, &c);
+                    if (match) {
+                        set[i >> 3] |= 1 << (i & 7);
+                    }
+                }
+                return true;
+            case Jmp:
+                off = (signed char)*pc++;
+                pc += off;
+                break;
+            case Split:
+            case RSplit:
+                off = (signed char)*pc++;
+                if (!re_first_set(pc, set, depth + 1)) {
+                    return false;
+                }
+                pc += off;
+                break;
+            case Save:
+                pc++;
+                break;
+            default:
+                // Any, Bol, Eol, Match
+                return false;
+        }
+    }
+    return false;
+}
+
+STATIC void re_prefilter_init(mp_obj_re_t *self) {
+    const char *pc = RE_PATTERN_CODE(&self->re);
+    self->filter = RE_FILTER_NONE;
+    self->prefix_len = 0;
+
+    if (*pc == Bol) {
+        self->filter = RE_FILTER_BOL;
+        return;
+    }
+
+    // Leading Char instructions (with no Split before them) must all match,
+    // in order, for any match to succeed.
+    for (; self->prefix_len < RE_PREFIX_MAX; pc += 2) {
+        if (*pc == Char) {
+            self->prefix[self->prefix_len++] = pc[1];
+        } else if (*pc != Save) {
+            break;
+        }
+    }
+    if (self->prefix_len > 0) {
+        self->filter = RE_FILTER_PREFIX;
+        return;
+    }
+
+    memset(self->first_set, 0, sizeof(self->first_set));
+    if (re_first_set(RE_PATTERN_CODE(&self->re), self->first_set, 0)) {
+        for (size_t i = 0; i < sizeof(self->first_set); ++i) {
+            if (self->first_set[i] != 0xff) {
+                self->filter = RE_FILTER_SET;
+                break;
+            }
+        }
+    }
+}
+
+// Return the first position at or after sp where a match could start, or
+// NULL if there is none.
+STATIC const char *re_prefilter_next(mp_obj_re_t *self, const char *sp, const char *end) {
+    switch (self->filter) {
+        case RE_FILTER_PREFIX: {
+            size_t n = self->prefix_len;
+            while ((size_t)(end - sp) >= n) {
+                sp = memchr(sp, self->prefix[0], end - sp - n + 1);
+                if (sp == NULL) {
+                    return NULL;
+                }
+                if (memcmp(sp + 1, self->prefix + 1, n - 1) == 0) {
+                    return sp;
+                }
+                sp++;
+            }
+            return NULL;
+        }
+        case RE_FILTER_SET:
+            for (; sp < end; sp++) {
+                byte c = *sp;
+                if (self->first_set[c >> 3] & (1 << (c & 7))) {
+                    return sp;
+                }
+            }
+            return NULL;
+        default:
+            return sp;
+    }
+}
+#endif
+
+// Run the compiled program against subj, filling in caps.  For an unanchored
+// search the prefilter (if enabled) picks the start positions to try.
+STATIC int re_exec_prog(mp_obj_re_t *self, Subject *subj, const char **caps, int caps_num, bool is_anchored) {
+    #if MICROPY_PY_URE_PREFILTER
+    if (!is_anchored && self->filter != RE_FILTER_NONE) {
+        if (self->filter == RE_FILTER_BOL) {
+            return re1_5_recursiveloopprog(&self->re, subj, caps, caps_num, true);
+        }
+        for (const char *sp = subj->begin;; sp++) {
+            sp = re_prefilter_next(self, sp, subj->end);
+            if (sp == NULL) {
+                return 0;
+            }
+            if (re1_5_recursiveloopprog_at(&self->re, subj, sp, caps, caps_num)) {
+                return 1;
+            }
+        }
+    }
+    #endif
+    return re1_5_recursiveloopprog(&self->re, subj, caps, caps_num, is_anchored);
+}
+
 STATIC mp_obj_t ure_exec(bool is_anchored, uint n_args, const mp_obj_t *args) {
     (void)n_args;
     mp_obj_re_t *self = MP_OBJ_TO_PTR(args[0]);
@@ -190,7 +351,7 @@ STATIC mp_obj_t ure_exec(bool is_anchored, uint n_args, const mp_obj_t *args) {
     mp_obj_match_t *match = m_new_obj_var(mp_obj_match_t, char*, caps_num);
     // cast is a workaround for a bug in msvc: it treats const char** as a const pointer instead of a pointer to pointer to const char
     memset((char*)match->caps, 0, caps_num * sizeof(char*));
-    int res = re1_5_recursiveloopprog(&self->re, &subj, match->caps, caps_num, is_anchored);
+    int res = re_exec_prog(self, &subj, match->caps, caps_num, is_anchored);
     if (res == 0) {
         m_del_var(mp_obj_match_t, char*, caps_num, match);
         return mp_const_none;
@@ -231,7 +392,7 @@ STATIC mp_obj_t re_split(size_t n_args, const mp_obj_t *args) {
     while (true) {
         // cast is a workaround for a bug in msvc: it treats const char** as a const pointer instead of a pointer to pointer to const char
         memset((char**)caps, 0, caps_num * sizeof(char*));
-        int res = re1_5_recursiveloopprog(&self->re, &subj, caps, caps_num, false);
+        int res = re_exec_prog(self, &subj, caps, caps_num, false);
 
         // if we didn't have a match, or had an empty match, it's time to stop
         if (!res || caps[0] == caps[1]) {
@@ -286,7 +447,7 @@ STATIC mp_obj_t re_sub_helper(mp_obj_t self_in, size_t n_args, const mp_obj_t *a
     for (;;) {
         // cast is a workaround for a bug in msvc: it treats const char** as a const pointer instead of a pointer to pointer to const char
         memset((char*)match->caps, 0, caps_num * sizeof(char*));
-        int res = re1_5_recursiveloopprog(&self->re, &subj, match->caps, caps_num, false);
+        int res = re_exec_prog(self, &subj, match->caps, caps_num, false);
 
         // If we didn't have a match, or had an empty match, it's time to stop
         if (!res || match->caps[0] == match->caps[1]) {
@@ -410,6 +571,9 @@ STATIC mp_obj_t mod_re_compile(size_t n_args, const mp_obj_t *args) {
 error:
         mp_raise_ValueError(translate("Error in regex"));
     }
+    #if MICROPY_PY_URE_PREFILTER
+    re_prefilter_init(o);
+    #endif
     if (flags & FLAG_DEBUG) {
         re1_5_dumpcode(&o->re);
     }
@@ -417,9 +581,40 @@ error:
 }
 MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(mod_re_compile_obj, 1, 2, mod_re_compile);
 
+// Compile a pattern for the module-level functions, reusing a recent
+// compilation of an equal pattern if there is one.
+STATIC mp_obj_t mod_re_compile_cached(mp_obj_t pattern) {
+    #if MICROPY_PY_URE_CACHE_SIZE
+    if (MP_OBJ_IS_STR_OR_BYTES(pattern)) {
+        mp_obj_t *cache = MP_STATE_VM(ure_cache);
+        size_t i = 0;
+        for (; i < MICROPY_PY_URE_CACHE_SIZE - 1 && cache[2 * i] != MP_OBJ_NULL; ++i) {
+            if (cache[2 * i] == pattern || mp_obj_str_equal(cache[2 * i], pattern)) {
+                break;
+            }
+        }
+        mp_obj_t key = cache[2 * i];
+        mp_obj_t re;
+        if (key != MP_OBJ_NULL && (key == pattern || mp_obj_str_equal(key, pattern))) {
+            re = cache[2 * i + 1];
+        } else {
+            // Miss: evict the least recently used entry (the last one)
+            key = pattern;
+            re = mod_re_compile(1, &pattern);
+        }
+        // Move the entry to the front
+        memmove(cache + 2, cache, 2 * i * sizeof(mp_obj_t));
+        cache[0] = key;
+        cache[1] = re;
+        return re;
+    }
+    #endif
+    return mod_re_compile(1, &pattern);
+}
+
 STATIC mp_obj_t mod_re_exec(bool is_anchored, uint n_args, const mp_obj_t *args) {
     (void)n_args;
-    mp_obj_t self = mod_re_compile(1, args);
+    mp_obj_t self = mod_re_compile_cached(args[0]);
 
     const mp_obj_t args2[] = {self, args[1]};
     mp_obj_t match = ure_exec(is_anchored, 2, args2);
@@ -438,7 +633,7 @@ MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(mod_re_search_obj, 2, 4, mod_re_search);
 
 #if MICROPY_PY_URE_SUB
 STATIC mp_obj_t mod_re_sub(size_t n_args, const mp_obj_t *args) {
-    mp_obj_t self = mod_re_compile(1, args);
+    mp_obj_t self = mod_re_compile_cached(args[0]);
     return re_sub_helper(self, n_args, args);
 }
 MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(mod_re_sub_obj, 3, 5, mod_re_sub);
@@ -125,6 +125,350 @@ STATIC const mp_obj_type_t decompio_type = {
     .locals_dict = (void*)&decompio_locals_dict,
 };
 
+#if MICROPY_PY_UZLIB_COMPIO
+
+// Compression uses fixed Huffman codes, with matches found through hash
+// chains over a sliding window of the input.
+
+#define COMPIO_MIN_MATCH (3)
+#define COMPIO_MAX_MATCH (258)
+// number of earlier positions tried when looking for the longest match
+#define COMPIO_MAX_CHAIN (32)
+// input kept ahead of the current position so matches are never cut short
+#define COMPIO_LOOKAHEAD (COMPIO_MAX_MATCH + COMPIO_MIN_MATCH + 1)
+// output is written to the stream in pieces of at most this size; outbits
+// must never fill the buffer, as uzlib would then realloc it
+#define COMPIO_OUT_SIZE (128)
+// most bytes completed by a literal or match of up to 31 bits, on top of 7
+// pending bits
+#define COMPIO_SYMBOL_ROOM (4)
+// most bytes completed after the last symbol, by the end-of-block code, an
+// empty final block, alignment and the 8 byte gzip trailer, which also
+// covers the empty stored block of a flush
+#define COMPIO_END_ROOM (11)
+
+typedef struct _mp_obj_compio_t {
+    mp_obj_base_t base;
+    mp_obj_t dest_stream;
+    struct Outbuf out;
+    byte *win; // input, of which up to wsize bytes before pos are the window
+    uint16_t *head; // latest position in win of each hash, 0 for none
+    uint16_t *prev; // earlier position with the same hash, by stream offset & (wsize - 1)
+    size_t wsize;
+    size_t win_size;
+    size_t win_len;
+    size_t pos; // position in win of the next byte to compress
+    size_t win_offset; // stream offset of win[0]
+    uint32_t checksum;
+    uint32_t in_size;
+    int8_t wbits;
+    uint8_t hash_bits;
+    bool in_block;
+    bool closed;
+} mp_obj_compio_t;
+
+STATIC void compio_out_byte(mp_obj_compio_t *self, byte b) {
+    outbits(&self->out, b, 8);
+}
+
+STATIC void compio_out_flush(mp_obj_compio_t *self) {
+    int err;
+    mp_stream_write_exactly(self->dest_stream, self->out.outbuf, self->out.outlen, &err);
+    if (err != 0) {
+        mp_raise_OSError(err);
+    }
+    self->out.outlen = 0;
+}
+
+// Make sure the next n bytes of output fit in the buffer.
+STATIC void compio_out_room(mp_obj_compio_t *self, int n) {
+    if (self->out.outlen + n > self->out.outsize) {
+        compio_out_flush(self);
+    }
+}
+
+// Add win[pos] to the hash chains, returning the previous position with the same hash.
+STATIC size_t compio_insert(mp_obj_compio_t *self, size_t pos) {
+    const byte *p = &self->win[pos];
+    uint32_t h = (((uint32_t)p[0] << 16 | p[1] << 8 | p[2]) * 2654435761u) >> (32 - self->hash_bits);
+    size_t cand = self->head[h];
+    self->prev[(self->win_offset + pos) & (self->wsize - 1)] = cand;
+    self->head[h] = pos;
+    return cand;
+}
+
+// Drop input that has left the window to make room for more.
+STATIC void compio_slide(mp_obj_compio_t *self) {
+    size_t d = self->pos - self->wsize;
+    memmove(self->win, self->win + d, self->win_len - d);
+    self->win_len -= d;
+    self->pos -= d;
+    self->win_offset += d;
+    for (size_t i = 0; i < ((size_t)1 << self->hash_bits); ++i) {
+        self->head[i] = self->head[i] > d ? self->head[i] - d : 0;
+    }
+    for (size_t i = 0; i < self->wsize; ++i) {
+        self->prev[i] = self->prev[i] > d ? self->prev[i] - d : 0;
+    }
+}
+
+// Compress the buffered input, leaving enough unprocessed to find full
+// length matches unless all of it must be output now.
+STATIC void compio_deflate(mp_obj_compio_t *self, bool flush) {
+    size_t end = self->win_len;
+    if (!flush) {
+        end = end > COMPIO_LOOKAHEAD ? end - COMPIO_LOOKAHEAD : 0;
+    }
+    if (self->pos >= end) {
+        return;
+    }
+    if (!self->in_block) {
+        // non-final block with fixed codes
+        compio_out_room(self, 1);
+        outbits(&self->out, 0, 1);
+        outbits(&self->out, 1, 2);
+        self->in_block = true;
+    }
+
+    const byte *win = self->win;
+    while (self->pos < end) {
+        size_t pos = self->pos;
+        size_t avail = self->win_len - pos;
+        size_t best_len = 0;
+        size_t best_dist = 0;
+        if (avail >= COMPIO_MIN_MATCH) {
+            size_t max_len = MIN(avail, COMPIO_MAX_MATCH);
+            size_t limit = pos > self->wsize ? pos - self->wsize : 0;
+            size_t cand = compio_insert(self, pos);
+            for (size_t chain = COMPIO_MAX_CHAIN; cand > limit && chain > 0; --chain) {
+                if (win[cand + best_len] == win[pos + best_len]) {
+                    size_t n = 0;
+                    while (n < max_len && win[cand + n] == win[pos + n]) {
+                        ++n;
+                    }
+                    if (n > best_len) {
+                        best_len = n;
+                        best_dist = pos - cand;
+                        if (n == max_len) {
+                            break;
+                        }
+                    }
+                }
+                cand = self->prev[(self->win_offset + cand) & (self->wsize - 1)];
+            }
+        }
+
+        compio_out_room(self, COMPIO_SYMBOL_ROOM);
+        if (best_len >= COMPIO_MIN_MATCH) {
+            zlib_match(&self->out, best_dist, best_len);
+            for (size_t i = 1; i < best_len && pos + i + COMPIO_MIN_MATCH <= self->win_len; ++i) {
+                compio_insert(self, pos + i);
+            }
+            self->pos += best_len;
+        } else {
+            zlib_literal(&self->out, win[pos]);
+            self->pos += 1;
+        }
+    }
+}
+
+// Finish the current block, if any, with the end-of-block code, leaving
+// room for whatever ends the stream or flush.
+STATIC void compio_end_block(mp_obj_compio_t *self) {
+    compio_deflate(self, true);
+    compio_out_room(self, COMPIO_END_ROOM);
+    if (self->in_block) {
+        outbits(&self->out, 0, 7);
+        self->in_block = false;
+    }
+}
+
+STATIC void compio_align(mp_obj_compio_t *self) {
+    outbits(&self->out, 0, (8 - self->out.noutbits) & 7);
+}
+
+STATIC mp_obj_t compio_make_new(const mp_obj_type_t *type, size_t n_args, const mp_obj_t *args, mp_map_t *kw_args) {
+    mp_arg_check_num(n_args, kw_args, 1, 2, false);
+    mp_get_stream_raise(args[0], MP_STREAM_OP_WRITE);
+
+    mp_int_t wbits = 10;
+    if (n_args > 1) {
+        wbits = mp_obj_get_int(args[1]);
+    }
+    mp_int_t win_bits = wbits < 0 ? -wbits : wbits >= 16 ? wbits - 16 : wbits;
+    if (win_bits < 8 || win_bits > 15) {
+        mp_raise_ValueError_varg(translate("Invalid %q"), MP_QSTR_wbits);
+    }
+
+    mp_obj_compio_t *o = m_new_obj(mp_obj_compio_t);
+    o->base.type = type;
+    o->dest_stream = args[0];
+    memset(&o->out, 0, sizeof(o->out));
+    o->out.outbuf = m_new(byte, COMPIO_OUT_SIZE);
+    o->out.outsize = COMPIO_OUT_SIZE;
+    o->wsize = (size_t)1 << win_bits;
+    // positions in win must fit in 16 bits, and there must be room for the
+    // window plus a lookahead on each side of the current position
+    o->win_size = o->wsize + MAX(o->wsize, 2 * COMPIO_LOOKAHEAD);
+    o->win = m_new(byte, o->win_size);
+    o->win_len = 0;
+    o->pos = 0;
+    o->win_offset = 0;
+    o->hash_bits = win_bits - 1;
+    o->head = m_new0(uint16_t, (size_t)1 << o->hash_bits);
+    o->prev = m_new0(uint16_t, o->wsize);
+    o->in_size = 0;
+    o->wbits = wbits;
+    o->in_block = false;
+    o->closed = false;
+
+    if (wbits >= 16) {
+        // gzip header, with no mtime and unknown OS
+        static const byte gzip_header[10] = {0x1f, 0x8b, 0x08, 0, 0, 0, 0, 0, 0, 0xff};
+        for (size_t i = 0; i < sizeof(gzip_header); ++i) {
+            compio_out_byte(o, gzip_header[i]);
+        }
+        o->checksum = 0xffffffff;
+    } else if (wbits > 0) {
+        // zlib header, with the check bits making it a multiple of 31
+        byte cmf = 0x08 | (win_bits - 8) << 4;
+        compio_out_byte(o, cmf);
+        compio_out_byte(o, 31 - (cmf << 8) % 31);
+        o->checksum = 1;
+    }
+
+    return MP_OBJ_FROM_PTR(o);
+}
+
+STATIC mp_uint_t compio_write(mp_obj_t o_in, const void *buf, mp_uint_t size, int *errcode) {
+    mp_obj_compio_t *o = MP_OBJ_TO_PTR(o_in);
+    if (o->closed) {
+        *errcode = MP_EINVAL;
+        return MP_STREAM_ERROR;
+    }
+
+    if (o->wbits >= 16) {
+        o->checksum = uzlib_crc32(buf, size, o->checksum);
+    } else if (o->wbits > 0) {
+        o->checksum = uzlib_adler32(buf, size, o->checksum);
+    }
+    o->in_size += size;
+
+    const byte *src = buf;
+    for (mp_uint_t n = size; n > 0;) {
+        if (o->win_len == o->win_size) {
+            compio_slide(o);
+        }
+        size_t chunk = MIN(n, o->win_size - o->win_len);
+        memcpy(o->win + o->win_len, src, chunk);
+        o->win_len += chunk;
+        src += chunk;
+        n -= chunk;
+        compio_deflate(o, false);
+    }
+    return size;
+}
+
+STATIC mp_uint_t compio_ioctl(mp_obj_t o_in, mp_uint_t request, uintptr_t arg, int *errcode) {
+    (void)arg;
+    mp_obj_compio_t *o = MP_OBJ_TO_PTR(o_in);
+    if (o->closed) {
+        if (request == MP_STREAM_CLOSE) {
+            return 0;
+        }
+        *errcode = MP_EINVAL;
+        return MP_STREAM_ERROR;
+    }
+
+    switch (request) {
+        case MP_STREAM_FLUSH: {
+            // Output everything written so far, followed by an empty stored
+            // block to byte-align it, so the receiver can decompress all of it.
+            if (o->in_block || o->pos < o->win_len) {
+                compio_end_block(o);
+                outbits(&o->out, 0, 3);
+                compio_align(o);
+                outbits(&o->out, 0x0000, 16);
+                outbits(&o->out, 0xffff, 16);
+            }
+            compio_out_flush(o);
+            const mp_stream_p_t *stream = mp_get_stream(o->dest_stream);
+            if (stream->ioctl == NULL) {
+                return 0;
+            }
+            return stream->ioctl(o->dest_stream, MP_STREAM_FLUSH, 0, errcode);
+        }
+        case MP_STREAM_CLOSE: {
+            // end with an empty final block, and the trailer; the underlying
+            // stream is left open
+            compio_end_block(o);
+            outbits(&o->out, 1, 1);
+            outbits(&o->out, 1, 2);
+            outbits(&o->out, 0, 7);
+            compio_align(o);
+            if (o->wbits >= 16) {
+                uint32_t crc = o->checksum ^ 0xffffffff;
+                for (int i = 0; i < 32; i += 8) {
+                    compio_out_byte(o, crc >> i);
+                }
+                for (int i = 0; i < 32; i += 8) {
+                    compio_out_byte(o, o->in_size >> i);
+                }
+            } else if (o->wbits > 0) {
+                for (int i = 24; i >= 0; i -= 8) {
+                    compio_out_byte(o, o->checksum >> i);
+                }
+            }
+            compio_out_flush(o);
+            o->closed = true;
+            m_del(byte, o->out.outbuf, o->out.outsize);
+            m_del(byte, o->win, o->win_size);
+            m_del(uint16_t, o->head, (size_t)1 << o->hash_bits);
+            m_del(uint16_t, o->prev, o->wsize);
+            o->out.outbuf = NULL;
+            o->win = NULL;
+            o->head = NULL;
+            o->prev = NULL;
+            return 0;
+        }
+        default:
+            *errcode = MP_EINVAL;
+            return MP_STREAM_ERROR;
+    }
+}
+
+STATIC mp_obj_t compio___exit__(size_t n_args, const mp_obj_t *args) {
+    (void)n_args;
+    return mp_stream_close(args[0]);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(compio___exit___obj, 4, 4, compio___exit__);
+
+STATIC const mp_rom_map_elem_t compio_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_write), MP_ROM_PTR(&mp_stream_write_obj) },
+    { MP_ROM_QSTR(MP_QSTR_flush), MP_ROM_PTR(&mp_stream_flush_obj) },
+    { MP_ROM_QSTR(MP_QSTR_close), MP_ROM_PTR(&mp_stream_close_obj) },
+    { MP_ROM_QSTR(MP_QSTR___enter__), MP_ROM_PTR(&mp_identity_obj) },
+    { MP_ROM_QSTR(MP_QSTR___exit__), MP_ROM_PTR(&compio___exit___obj) },
+};
+
+STATIC MP_DEFINE_CONST_DICT(compio_locals_dict, compio_locals_dict_table);
+
+STATIC const mp_stream_p_t compio_stream_p = {
+    MP_PROTO_IMPLEMENT(MP_QSTR_protocol_stream)
+    .write = compio_write,
+    .ioctl = compio_ioctl,
+};
+
+STATIC const mp_obj_type_t compio_type = {
+    { &mp_type_type },
+    .name = MP_QSTR_CompIO,
+    .make_new = compio_make_new,
+    .protocol = &compio_stream_p,
+    .locals_dict = (void*)&compio_locals_dict,
+};
+
+#endif // MICROPY_PY_UZLIB_COMPIO
+
 STATIC mp_obj_t mod_uzlib_decompress(size_t n_args, const mp_obj_t *args) {
     mp_obj_t data = args[0];
     mp_buffer_info_t bufinfo;
@@ -187,6 +531,9 @@ STATIC const mp_rom_map_elem_t mp_module_uzlib_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_uzlib) },
     { MP_ROM_QSTR(MP_QSTR_decompress), MP_ROM_PTR(&mod_uzlib_decompress_obj) },
     { MP_ROM_QSTR(MP_QSTR_DecompIO), MP_ROM_PTR(&decompio_type) },
+    #if MICROPY_PY_UZLIB_COMPIO
+    { MP_ROM_QSTR(MP_QSTR_CompIO), MP_ROM_PTR(&compio_type) },
+    #endif
 };
 
 STATIC MP_DEFINE_CONST_DICT(mp_module_uzlib_globals, mp_module_uzlib_globals_table);
@@ -205,5 +552,8 @@ const mp_obj_module_t mp_module_uzlib = {
 #include "../../lib/uzlib/src/tinfgzip.c"
 #include "../../lib/uzlib/src/adler32.c"
 #include "../../lib/uzlib/src/crc32.c"
+#if MICROPY_PY_UZLIB_COMPIO
+#include "../../lib/uzlib/src/defl_static.c"
+#endif
 
 #endif // MICROPY_PY_UZLIB
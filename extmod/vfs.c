@@ -9,6 +9,7 @@
 #include "py/runtime.h"
 #include "py/objstr.h"
 #include "py/mperrno.h"
+#include "py/stream.h"
 #include "extmod/vfs.h"
 
 #if MICROPY_VFS
@@ -442,4 +443,29 @@ mp_obj_t mp_vfs_statvfs(mp_obj_t path_in) {
 }
 MP_DEFINE_CONST_FUN_OBJ_1(mp_vfs_statvfs_obj, mp_vfs_statvfs);
 
+#if MICROPY_VFS_MMAP
+// Returns a read-only view of the whole file without copying it to RAM: a
+// memoryview for VfsFat, or another object with the buffer protocol that keeps
+// the file mapped while it is alive. The view stays valid after the file is
+// closed but shows whatever is stored there if the file is later changed or
+// removed.
+mp_obj_t mp_vfs_mmap(mp_obj_t path_in) {
+    mp_obj_t args[2] = {path_in, MP_OBJ_NEW_QSTR(MP_QSTR_rb)};
+    mp_obj_t file = mp_vfs_open(MP_ARRAY_SIZE(args), args, (mp_map_t*)&mp_const_empty_map);
+    const mp_stream_p_t *stream_p = mp_get_stream(file);
+    mp_obj_t view;
+    int errcode = MP_EOPNOTSUPP;
+    mp_uint_t res = MP_STREAM_ERROR;
+    if (stream_p->ioctl != NULL) {
+        res = stream_p->ioctl(file, MP_STREAM_GET_MMAP, (uintptr_t)&view, &errcode);
+    }
+    mp_stream_close(file);
+    if (res == MP_STREAM_ERROR) {
+        mp_raise_OSError(errcode);
+    }
+    return view;
+}
+MP_DEFINE_CONST_FUN_OBJ_1(mp_vfs_mmap_obj, mp_vfs_mmap);
+#endif
+
 #endif // MICROPY_VFS
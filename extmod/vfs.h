@@ -25,6 +25,9 @@
 #define BP_IOCTL_SYNC           (3)
 #define BP_IOCTL_SEC_COUNT      (4)
 #define BP_IOCTL_SEC_SIZE       (5)
+// Memory address of sector arg, or None if the device isn't memory mapped. The
+// following sectors must lie directly after it and pending writes must be visible.
+#define BP_IOCTL_SEC_ADDR       (7)
 
 // At the moment the VFS protocol just has import_stat, but could be extended to other methods
 typedef struct _mp_vfs_proto_t {
@@ -67,6 +70,7 @@ mp_obj_t mp_vfs_rename(mp_obj_t old_path_in, mp_obj_t new_path_in);
 mp_obj_t mp_vfs_rmdir(mp_obj_t path_in);
 mp_obj_t mp_vfs_stat(mp_obj_t path_in);
 mp_obj_t mp_vfs_statvfs(mp_obj_t path_in);
+mp_obj_t mp_vfs_mmap(mp_obj_t path_in);
 
 mp_obj_t mp_vfs_ilistdir_it_iternext(mp_obj_t self_in);
 
@@ -83,5 +87,6 @@ MP_DECLARE_CONST_FUN_OBJ_2(mp_vfs_rename_obj);
 MP_DECLARE_CONST_FUN_OBJ_1(mp_vfs_rmdir_obj);
 MP_DECLARE_CONST_FUN_OBJ_1(mp_vfs_stat_obj);
 MP_DECLARE_CONST_FUN_OBJ_1(mp_vfs_statvfs_obj);
+MP_DECLARE_CONST_FUN_OBJ_1(mp_vfs_mmap_obj);
 
 #endif // MICROPY_INCLUDED_EXTMOD_VFS_H
@@ -44,6 +44,21 @@ mp_import_stat_t fat_vfs_import_stat(void *vfs_in, const char *path) {
     return MP_IMPORT_STAT_NO_EXIST;
 }
 
+void fat_vfs_load_block_device(fs_user_mount_t *vfs, mp_obj_t bdev) {
+    // load block protocol methods
+    mp_load_method(bdev, MP_QSTR_readblocks, vfs->readblocks);
+    mp_load_method_maybe(bdev, MP_QSTR_writeblocks, vfs->writeblocks);
+    mp_load_method_maybe(bdev, MP_QSTR_ioctl, vfs->u.ioctl);
+    if (vfs->u.ioctl[0] != MP_OBJ_NULL) {
+        // device supports new block protocol, so indicate it
+        vfs->flags |= FSUSER_HAVE_IOCTL;
+    } else {
+        // no ioctl method, so assume the device uses the old block protocol
+        mp_load_method_maybe(bdev, MP_QSTR_sync, vfs->u.old.sync);
+        mp_load_method(bdev, MP_QSTR_count, vfs->u.old.count);
+    }
+}
+
 STATIC mp_obj_t fat_vfs_make_new(const mp_obj_type_t *type, size_t n_args, const mp_obj_t *args, mp_map_t *kw_args) {
     mp_arg_check_num(n_args, kw_args, 1, 1, false);
 
@@ -53,18 +68,7 @@ STATIC mp_obj_t fat_vfs_make_new(const mp_obj_type_t *type, size_t n_args, const
     vfs->flags = FSUSER_FREE_OBJ;
     vfs->fatfs.drv = vfs;
 
-    // load block protocol methods
-    mp_load_method(args[0], MP_QSTR_readblocks, vfs->readblocks);
-    mp_load_method_maybe(args[0], MP_QSTR_writeblocks, vfs->writeblocks);
-    mp_load_method_maybe(args[0], MP_QSTR_ioctl, vfs->u.ioctl);
-    if (vfs->u.ioctl[0] != MP_OBJ_NULL) {
-        // device supports new block protocol, so indicate it
-        vfs->flags |= FSUSER_HAVE_IOCTL;
-    } else {
-        // no ioctl method, so assume the device uses the old block protocol
-        mp_load_method_maybe(args[0], MP_QSTR_sync, vfs->u.old.sync);
-        mp_load_method(args[0], MP_QSTR_count, vfs->u.old.count);
-    }
+    fat_vfs_load_block_device(vfs, args[0]);
 
     // mount the block device so the VFS methods can be used
     FRESULT res = f_mount(&vfs->fatfs);
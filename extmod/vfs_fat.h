@@ -40,6 +40,20 @@ typedef struct _fs_user_mount_t {
 typedef struct _pyb_file_obj_t {
     mp_obj_base_t base;
     FIL fp;
+    #if _USE_FASTSEEK
+    // Cluster link map for fp.cltbl when the file is in one piece; larger
+    // maps are allocated on the heap.
+    DWORD clmt[4];
+    #endif
+    #if MICROPY_VFS_FAT_ASYNC
+    // The transfer queued by write_async or readinto_async
+    struct _pyb_file_obj_t *async_next;
+    mp_obj_t async_buf;
+    uint8_t async_op;
+    uint8_t async_errno;
+    mp_uint_t async_len;
+    mp_uint_t async_done;
+    #endif
 } pyb_file_obj_t;
 
 extern const byte fresult_to_errno_table[20];
@@ -51,6 +65,24 @@ mp_import_stat_t fat_vfs_import_stat(void *vfs, const char *path);
 
 MP_DECLARE_CONST_FUN_OBJ_3(fat_vfs_open_obj);
 
+#if MICROPY_VFS_FAT_ASYNC
+// Nonzero while a block device call is in progress
+extern uint8_t vfs_fat_disk_busy;
+// Moves each queued transfer on by up to a sector; returns false if nothing
+// could be done, because none are queued or FatFs or the heap are in use.
+bool vfs_fat_async_service(void);
+// Ends every queued transfer that hasn't finished with the given error.
+void vfs_fat_async_cancel(int errcode);
+#endif
+
+// Points the block protocol methods of vfs at those of bdev.
+void fat_vfs_load_block_device(fs_user_mount_t *vfs, mp_obj_t bdev);
+
+#if MICROPY_VFS_FAT_BENCHMARK
+mp_obj_t fat_vfs_benchmark(mp_obj_t device, bool write, bool random, mp_int_t count, mp_int_t blocks);
+MP_DECLARE_CONST_FUN_OBJ_KW(fat_vfs_benchmark_obj);
+#endif
+
 mp_obj_t fat_vfs_ilistdir2(struct _fs_user_mount_t *vfs, const char *path, bool is_str_type);
 
 MP_DECLARE_CONST_FUN_OBJ_KW(fsuser_mount_obj);
@@ -0,0 +1,176 @@
+// SPDX-FileCopyrightText: 2020 MicroPython & CircuitPython contributors (https://github.com/adafruit/circuitpython/graphs/contributors)
+//
+// SPDX-License-Identifier: MIT
+
+#include "py/mpconfig.h"
+#if MICROPY_VFS && MICROPY_VFS_FAT && MICROPY_VFS_FAT_BENCHMARK
+
+#include "py/mperrno.h"
+#include "py/mphal.h"
+#include "py/objtuple.h"
+#include "py/runtime.h"
+#include "lib/oofatfs/ff.h"
+#include "lib/oofatfs/diskio.h"
+#include "extmod/vfs_fat.h"
+#include "supervisor/filesystem.h"
+#include "supervisor/shared/translate.h"
+
+#if _MAX_SS == _MIN_SS
+#define SECSIZE(fs) (_MIN_SS)
+#else
+#define SECSIZE(fs) ((fs)->ssize)
+#endif
+
+// Shell sort, so that finding percentiles needs neither recursion nor more memory.
+STATIC void sort_latencies(uint32_t *v, size_t n) {
+    for (size_t gap = n / 2; gap > 0; gap /= 2) {
+        for (size_t i = gap; i < n; i++) {
+            uint32_t x = v[i];
+            size_t j = i;
+            for (; j >= gap && v[j - gap] > x; j -= gap) {
+                v[j] = v[j - gap];
+            }
+            v[j] = x;
+        }
+    }
+}
+
+STATIC void check_result(DRESULT res) {
+    if (res == RES_WRPRT) {
+        mp_raise_OSError(MP_EROFS);
+    } else if (res != RES_OK) {
+        mp_raise_OSError(MP_EIO);
+    }
+}
+
+STATIC const qstr benchmark_fields[] = {
+    MP_QSTR_bytes_per_second, MP_QSTR_p50_us, MP_QSTR_p99_us, MP_QSTR_max_us, MP_QSTR_histogram,
+};
+
+// Times count reads or writes of the given number of blocks through the same
+// disk_read and disk_write that FatFs uses, so a mounted VfsFat is measured
+// with its native block functions and anything else through its block protocol
+// methods. Writes put back what was read from the blocks first, so the contents
+// of the device are unchanged; only the writes and a final sync are timed.
+mp_obj_t fat_vfs_benchmark(mp_obj_t device, bool write, bool random, mp_int_t count, mp_int_t blocks) {
+    if (count < 1) {
+        mp_raise_ValueError_varg(translate("%q must be >= 1"), MP_QSTR_count);
+    }
+    if (blocks < 1) {
+        mp_raise_ValueError_varg(translate("%q must be >= 1"), MP_QSTR_blocks);
+    }
+
+    fs_user_mount_t *vfs;
+    if (MP_OBJ_IS_TYPE(device, &mp_fat_vfs_type)) {
+        vfs = MP_OBJ_TO_PTR(device);
+        if (write && !filesystem_is_writable_by_python(vfs)) {
+            mp_raise_OSError(MP_EROFS);
+        }
+    } else {
+        vfs = m_new_obj(fs_user_mount_t);
+        vfs->base.type = &mp_fat_vfs_type;
+        vfs->flags = 0;
+        vfs->fatfs.drv = vfs;
+        fat_vfs_load_block_device(vfs, device);
+    }
+
+    DWORD block_count;
+    WORD block_size;
+    check_result(disk_ioctl(vfs->fatfs.drv, GET_SECTOR_COUNT, &block_count));
+    check_result(disk_ioctl(vfs->fatfs.drv, GET_SECTOR_SIZE, &block_size));
+    if ((DWORD)blocks > block_count) {
+        mp_raise_OSError(MP_EINVAL);
+    }
+    size_t len = blocks * SECSIZE(&vfs->fatfs);
+    byte *buf = m_new(byte, len);
+    uint32_t *latency = m_new(uint32_t, count);
+
+    // The random pattern always starts from the same seed so that runs compare.
+    uint32_t seed = 2463534242;
+    DWORD span = block_count - blocks + 1;
+    DWORD sector = 0;
+    uint64_t total_us = 0;
+    for (mp_int_t i = 0; i < count; i++) {
+        if (random) {
+            seed ^= seed << 13;
+            seed ^= seed >> 17;
+            seed ^= seed << 5;
+            sector = seed % span;
+        } else if (sector >= span) {
+            sector = 0;
+        }
+        mp_uint_t start;
+        if (write) {
+            check_result(disk_read(vfs->fatfs.drv, buf, sector, blocks));
+            start = mp_hal_ticks_us();
+            check_result(disk_write(vfs->fatfs.drv, buf, sector, blocks));
+        } else {
+            start = mp_hal_ticks_us();
+            check_result(disk_read(vfs->fatfs.drv, buf, sector, blocks));
+        }
+        latency[i] = mp_hal_ticks_us() - start;
+        total_us += latency[i];
+        sector += blocks;
+    }
+    if (write) {
+        // Include what is left in caches in the throughput.
+        mp_uint_t start = mp_hal_ticks_us();
+        check_result(disk_ioctl(vfs->fatfs.drv, CTRL_SYNC, NULL));
+        total_us += (mp_uint_t)(mp_hal_ticks_us() - start);
+    }
+
+    // Bucket i counts the operations that took less than 2**i but at least
+    // 2**(i - 1) microseconds.
+    size_t histogram[33] = {0};
+    size_t buckets = 0;
+    for (mp_int_t i = 0; i < count; i++) {
+        size_t b = 0;
+        for (uint32_t us = latency[i]; us != 0; us >>= 1) {
+            b++;
+        }
+        histogram[b]++;
+        if (b >= buckets) {
+            buckets = b + 1;
+        }
+    }
+    mp_obj_tuple_t *hist = MP_OBJ_TO_PTR(mp_obj_new_tuple(buckets, NULL));
+    for (size_t b = 0; b < buckets; b++) {
+        hist->items[b] = MP_OBJ_NEW_SMALL_INT(histogram[b]);
+    }
+
+    sort_latencies(latency, count);
+    uint64_t bytes = (uint64_t)count * len;
+    mp_obj_t items[] = {
+        mp_obj_new_int_from_ull(bytes * 1000000 / (total_us == 0 ? 1 : total_us)),
+        mp_obj_new_int_from_uint(latency[(count + 1) / 2 - 1]),
+        mp_obj_new_int_from_uint(latency[(count * 99 + 99) / 100 - 1]),
+        mp_obj_new_int_from_uint(latency[count - 1]),
+        MP_OBJ_FROM_PTR(hist),
+    };
+
+    m_del(uint32_t, latency, count);
+    m_del(byte, buf, len);
+    if (vfs != MP_OBJ_TO_PTR(device)) {
+        m_del_obj(fs_user_mount_t, vfs);
+    }
+    return mp_obj_new_attrtuple(benchmark_fields, MP_ARRAY_SIZE(items), items);
+}
+
+STATIC mp_obj_t fat_vfs_benchmark_fun(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_device, ARG_write, ARG_random, ARG_count, ARG_blocks };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_device, MP_ARG_REQUIRED | MP_ARG_OBJ },
+        { MP_QSTR_write, MP_ARG_KW_ONLY | MP_ARG_BOOL, {.u_bool = false} },
+        { MP_QSTR_random, MP_ARG_KW_ONLY | MP_ARG_BOOL, {.u_bool = false} },
+        { MP_QSTR_count, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 64} },
+        { MP_QSTR_blocks, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 1} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    return fat_vfs_benchmark(args[ARG_device].u_obj, args[ARG_write].u_bool, args[ARG_random].u_bool,
+        args[ARG_count].u_int, args[ARG_blocks].u_int);
+}
+MP_DEFINE_CONST_FUN_OBJ_KW(fat_vfs_benchmark_obj, 1, fat_vfs_benchmark_fun);
+
+#endif // MICROPY_VFS && MICROPY_VFS_FAT && MICROPY_VFS_FAT_BENCHMARK
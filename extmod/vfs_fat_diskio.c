@@ -24,6 +24,17 @@
 #define SECSIZE(fs) ((fs)->ssize)
 #endif
 
+#if MICROPY_VFS_FAT_ASYNC
+// Block device calls can run background tasks, for example the VM running a
+// Python readblocks. Queued file I/O must not start another FatFs call then.
+uint8_t vfs_fat_disk_busy;
+#define DISK_BUSY_BEGIN() (vfs_fat_disk_busy++)
+#define DISK_BUSY_END() (vfs_fat_disk_busy--)
+#else
+#define DISK_BUSY_BEGIN()
+#define DISK_BUSY_END()
+#endif
+
 typedef void *bdev_t;
 STATIC fs_user_mount_t *disk_get_device(void *bdev) {
     return (fs_user_mount_t*)bdev;
@@ -47,7 +58,10 @@ DRESULT disk_read (
 
     if (vfs->flags & FSUSER_NATIVE) {
         mp_uint_t (*f)(uint8_t*, uint32_t, uint32_t) = (void*)(uintptr_t)vfs->readblocks[2];
-        if (f(buff, sector, count) != 0) {
+        DISK_BUSY_BEGIN();
+        mp_uint_t ret = f(buff, sector, count);
+        DISK_BUSY_END();
+        if (ret != 0) {
             return RES_ERROR;
         }
     } else {
@@ -55,14 +69,17 @@ DRESULT disk_read (
         vfs->readblocks[2] = MP_OBJ_NEW_SMALL_INT(sector);
         vfs->readblocks[3] = MP_OBJ_FROM_PTR(&ar);
         nlr_buf_t nlr;
+        DISK_BUSY_BEGIN();
         if (nlr_push(&nlr) == 0) {
             mp_obj_t ret = mp_call_method_n_kw(2, 0, vfs->readblocks);
             nlr_pop();
+            DISK_BUSY_END();
             if (ret != mp_const_none && MP_OBJ_SMALL_INT_VALUE(ret) != 0) {
                 return RES_ERROR;
             }
         } else {
             // Exception thrown by readblocks or something it calls.
+            DISK_BUSY_END();
             return RES_ERROR;
         }
     }
@@ -93,7 +110,10 @@ DRESULT disk_write (
 
     if (vfs->flags & FSUSER_NATIVE) {
         mp_uint_t (*f)(const uint8_t*, uint32_t, uint32_t) = (void*)(uintptr_t)vfs->writeblocks[2];
-        if (f(buff, sector, count) != 0) {
+        DISK_BUSY_BEGIN();
+        mp_uint_t ret = f(buff, sector, count);
+        DISK_BUSY_END();
+        if (ret != 0) {
             return RES_ERROR;
         }
     } else {
@@ -101,14 +121,17 @@ DRESULT disk_write (
         vfs->writeblocks[2] = MP_OBJ_NEW_SMALL_INT(sector);
         vfs->writeblocks[3] = MP_OBJ_FROM_PTR(&ar);
         nlr_buf_t nlr;
+        DISK_BUSY_BEGIN();
         if (nlr_push(&nlr) == 0) {
             mp_obj_t ret = mp_call_method_n_kw(2, 0, vfs->writeblocks);
             nlr_pop();
+            DISK_BUSY_END();
             if (ret != mp_const_none && MP_OBJ_SMALL_INT_VALUE(ret) != 0) {
                 return RES_ERROR;
             }
         } else {
             // Exception thrown by writeblocks or something it calls.
+            DISK_BUSY_END();
             return RES_ERROR;
         }
     }
@@ -134,6 +157,14 @@ DRESULT disk_ioctl (
 
     // First part: call the relevant method of the underlying block device
     mp_obj_t ret = mp_const_none;
+    #if MICROPY_VFS_FAT_ASYNC
+    DISK_BUSY_BEGIN();
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) != 0) {
+        DISK_BUSY_END();
+        nlr_jump(nlr.ret_val);
+    }
+    #endif
     if (vfs->flags & FSUSER_HAVE_IOCTL) {
         // new protocol with ioctl
         static const uint8_t op_map[8] = {
@@ -170,6 +201,10 @@ DRESULT disk_ioctl (
                 break;
         }
     }
+    #if MICROPY_VFS_FAT_ASYNC
+    nlr_pop();
+    DISK_BUSY_END();
+    #endif
 
     // Second part: convert the result for return
     switch (cmd) {
@@ -9,6 +9,7 @@
 #include <stdio.h>
 #include <string.h>
 
+#include "py/gc.h"
 #include "py/runtime.h"
 #include "py/stream.h"
 #include "py/mperrno.h"
@@ -45,8 +46,157 @@ STATIC void file_obj_print(const mp_print_t *print, mp_obj_t self_in, mp_print_k
     mp_printf(print, "<io.%q %p>", mp_obj_get_type_qstr(self_in), MP_OBJ_TO_PTR(self_in));
 }
 
+#if _MAX_SS == _MIN_SS
+#define SECSIZE(fs) (_MIN_SS)
+#else
+#define SECSIZE(fs) ((fs)->ssize)
+#endif
+
+#if MICROPY_VFS_FAT_ASYNC
+enum {
+    ASYNC_IDLE,
+    ASYNC_READ,
+    ASYNC_WRITE,
+};
+
+// Moves the queued transfer on, at most to the end of the current sector so
+// that whole sectors go straight between the buffer and the disk. Returns
+// false once the transfer is finished.
+STATIC bool file_obj_async_step(pyb_file_obj_t *self) {
+    FIL *fp = &self->fp;
+    // Look the buffer up each time since a bytearray may have been resized.
+    mp_buffer_info_t bufinfo;
+    if (!mp_get_buffer(self->async_buf, &bufinfo, self->async_op == ASYNC_READ ? MP_BUFFER_WRITE : MP_BUFFER_READ)) {
+        self->async_errno = MP_EINVAL;
+        return false;
+    }
+    mp_uint_t len = MIN(self->async_len, bufinfo.len);
+    if (self->async_done >= len) {
+        return false;
+    }
+    UINT chunk = SECSIZE(fp->obj.fs) - f_tell(fp) % SECSIZE(fp->obj.fs);
+    if (chunk > len - self->async_done) {
+        chunk = len - self->async_done;
+    }
+    byte *p = (byte*)bufinfo.buf + self->async_done;
+    UINT sz_out;
+    FRESULT res;
+    if (self->async_op == ASYNC_READ) {
+        res = f_read(fp, p, chunk, &sz_out);
+    } else {
+        res = f_write(fp, p, chunk, &sz_out);
+    }
+    if (res != FR_OK) {
+        self->async_errno = fresult_to_errno_table[res];
+        return false;
+    }
+    self->async_done += sz_out;
+    if (sz_out != chunk) {
+        // End of file when reading, disk full when writing.
+        if (self->async_op == ASYNC_WRITE) {
+            self->async_errno = MP_ENOSPC;
+        }
+        return false;
+    }
+    return self->async_done < len;
+}
+
+STATIC void file_obj_async_finish(pyb_file_obj_t *self) {
+    self->async_op = ASYNC_IDLE;
+    self->async_buf = MP_OBJ_NULL;
+    pyb_file_obj_t **p = &MP_STATE_VM(vfs_fat_async_files);
+    while (*p != self) {
+        p = &(*p)->async_next;
+    }
+    *p = self->async_next;
+}
+
+// Synchronous operations finish the queued transfer first so that they see
+// the file as if it had been done by a plain read or write.
+STATIC void file_obj_async_wait(pyb_file_obj_t *self) {
+    if (self->async_op != ASYNC_IDLE) {
+        while (file_obj_async_step(self)) {
+        }
+        file_obj_async_finish(self);
+    }
+}
+
+bool vfs_fat_async_service(void) {
+    // FatFs can't be reentered from inside a block device call, and Python
+    // block devices need the heap.
+    if (vfs_fat_disk_busy != 0 || gc_is_locked() || MP_STATE_VM(vfs_fat_async_files) == NULL) {
+        return false;
+    }
+    pyb_file_obj_t *self = MP_STATE_VM(vfs_fat_async_files);
+    while (self != NULL) {
+        pyb_file_obj_t *next = self->async_next;
+        if (!file_obj_async_step(self)) {
+            file_obj_async_finish(self);
+        }
+        self = next;
+    }
+    return true;
+}
+
+void vfs_fat_async_cancel(int errcode) {
+    while (MP_STATE_VM(vfs_fat_async_files) != NULL) {
+        pyb_file_obj_t *self = MP_STATE_VM(vfs_fat_async_files);
+        self->async_errno = errcode;
+        file_obj_async_finish(self);
+    }
+}
+
+STATIC mp_obj_t file_obj_async_start(mp_obj_t self_in, mp_obj_t buf_in, uint8_t op) {
+    pyb_file_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    if (self->fp.obj.fs == NULL) {
+        mp_raise_OSError(MP_EINVAL);
+    }
+    if (self->async_op != ASYNC_IDLE) {
+        mp_raise_OSError(MP_EBUSY);
+    }
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(buf_in, &bufinfo, op == ASYNC_READ ? MP_BUFFER_WRITE : MP_BUFFER_READ);
+    self->async_buf = buf_in;
+    self->async_op = op;
+    self->async_errno = 0;
+    self->async_len = bufinfo.len;
+    self->async_done = 0;
+    self->async_next = MP_STATE_VM(vfs_fat_async_files);
+    MP_STATE_VM(vfs_fat_async_files) = self;
+    filesystem_schedule_async_io();
+    return mp_const_none;
+}
+
+STATIC mp_obj_t file_obj_readinto_async(mp_obj_t self_in, mp_obj_t buf_in) {
+    return file_obj_async_start(self_in, buf_in, ASYNC_READ);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_2(file_obj_readinto_async_obj, file_obj_readinto_async);
+
+STATIC mp_obj_t file_obj_write_async(mp_obj_t self_in, mp_obj_t buf_in) {
+    return file_obj_async_start(self_in, buf_in, ASYNC_WRITE);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_2(file_obj_write_async_obj, file_obj_write_async);
+
+// Returns None while the queued transfer is in progress, then the number of
+// bytes it moved, or raises the error that stopped it.
+STATIC mp_obj_t file_obj_async_result(mp_obj_t self_in) {
+    pyb_file_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    if (self->async_op != ASYNC_IDLE) {
+        return mp_const_none;
+    }
+    if (self->async_errno != 0) {
+        mp_raise_OSError(self->async_errno);
+    }
+    return mp_obj_new_int_from_uint(self->async_done);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(file_obj_async_result_obj, file_obj_async_result);
+#endif
+
 STATIC mp_uint_t file_obj_read(mp_obj_t self_in, void *buf, mp_uint_t size, int *errcode) {
     pyb_file_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    #if MICROPY_VFS_FAT_ASYNC
+    file_obj_async_wait(self);
+    #endif
     UINT sz_out;
     FRESULT res = f_read(&self->fp, buf, size, &sz_out);
     if (res != FR_OK) {
@@ -58,6 +208,9 @@ STATIC mp_uint_t file_obj_read(mp_obj_t self_in, void *buf, mp_uint_t size, int
 
 STATIC mp_uint_t file_obj_write(mp_obj_t self_in, const void *buf, mp_uint_t size, int *errcode) {
     pyb_file_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    #if MICROPY_VFS_FAT_ASYNC
+    file_obj_async_wait(self);
+    #endif
     UINT sz_out;
     FRESULT res = f_write(&self->fp, buf, size, &sz_out);
     if (res != FR_OK) {
@@ -79,8 +232,101 @@ STATIC mp_obj_t file_obj___exit__(size_t n_args, const mp_obj_t *args) {
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(file_obj___exit___obj, 4, 4, file_obj___exit__);
 
+#if _USE_FASTSEEK
+// Seeking through a file with a cluster link map looks the cluster up in the
+// map instead of following the FAT chain from the start. The map of a file in
+// one piece fits in the file object, others are put on the heap if possible.
+STATIC void file_obj_create_link_map(pyb_file_obj_t *self) {
+    FIL *fp = &self->fp;
+    FATFS *fs = fp->obj.fs;
+    if (f_size(fp) <= (FSIZE_t)fs->csize * SECSIZE(fs)) {
+        // There's no chain to follow in a single cluster.
+        return;
+    }
+    self->clmt[0] = MP_ARRAY_SIZE(self->clmt);
+    fp->cltbl = self->clmt;
+    FRESULT res = f_lseek(fp, CREATE_LINKMAP);
+    if (res == FR_OK) {
+        return;
+    }
+    fp->cltbl = NULL;
+    if (res != FR_NOT_ENOUGH_CORE) {
+        return;
+    }
+    // The failed attempt stored the size that is needed.
+    DWORD size = self->clmt[0];
+    DWORD *cltbl = m_new_maybe(DWORD, size);
+    if (cltbl == NULL) {
+        return;
+    }
+    cltbl[0] = size;
+    fp->cltbl = cltbl;
+    if (f_lseek(fp, CREATE_LINKMAP) != FR_OK) {
+        fp->cltbl = NULL;
+        m_del(DWORD, cltbl, size);
+    }
+}
+
+STATIC void file_obj_free_link_map(pyb_file_obj_t *self) {
+    DWORD *cltbl = self->fp.cltbl;
+    if (cltbl != NULL && cltbl != self->clmt) {
+        m_del(DWORD, cltbl, cltbl[0]);
+    }
+    self->fp.cltbl = NULL;
+}
+#endif
+
+#if MICROPY_VFS_MMAP
+// A file can be mapped when it is open read-only, its clusters are contiguous and
+// the block device reports where its sectors are addressable in memory. The
+// flash stays mapped, so a memoryview of it is all that is needed to hold the view.
+STATIC mp_uint_t file_obj_get_mmap(pyb_file_obj_t *self, mp_obj_t *view, int *errcode) {
+    FIL *fp = &self->fp;
+    FATFS *fs = fp->obj.fs;
+    fs_user_mount_t *vfs = fs->drv;
+    if ((fp->flag & FA_WRITE) || f_size(fp) == 0 || !(vfs->flags & FSUSER_HAVE_IOCTL)) {
+        *errcode = MP_EINVAL;
+        return MP_STREAM_ERROR;
+    }
+
+    // A contiguous chain has a single fragment: table size, length, start cluster, end mark
+    DWORD clmt[4] = {MP_ARRAY_SIZE(clmt)};
+    DWORD *cltbl = fp->cltbl;
+    if (cltbl != NULL) {
+        // The map made on open already tells.
+        if (cltbl[0] != MP_ARRAY_SIZE(clmt)) {
+            *errcode = MP_EINVAL;
+            return MP_STREAM_ERROR;
+        }
+        clmt[2] = cltbl[2];
+    } else {
+        fp->cltbl = clmt;
+        FRESULT res = f_lseek(fp, CREATE_LINKMAP);
+        fp->cltbl = NULL;
+        if (res != FR_OK) {
+            *errcode = res == FR_NOT_ENOUGH_CORE ? MP_EINVAL : fresult_to_errno_table[res];
+            return MP_STREAM_ERROR;
+        }
+    }
+
+    DWORD sector = fs->database + (clmt[2] - 2) * fs->csize;
+    vfs->u.ioctl[2] = MP_OBJ_NEW_SMALL_INT(BP_IOCTL_SEC_ADDR);
+    vfs->u.ioctl[3] = mp_obj_new_int_from_uint(sector);
+    mp_obj_t ret = mp_call_method_n_kw(2, 0, vfs->u.ioctl);
+    if (ret == mp_const_none) {
+        *errcode = MP_EINVAL;
+        return MP_STREAM_ERROR;
+    }
+    *view = mp_obj_new_memoryview('B', f_size(fp), (void*)(uintptr_t)mp_obj_int_get_truncated(ret));
+    return 0;
+}
+#endif
+
 STATIC mp_uint_t file_obj_ioctl(mp_obj_t o_in, mp_uint_t request, uintptr_t arg, int *errcode) {
     pyb_file_obj_t *self = MP_OBJ_TO_PTR(o_in);
+    #if MICROPY_VFS_FAT_ASYNC
+    file_obj_async_wait(self);
+    #endif
 
     if (request == MP_STREAM_SEEK) {
         struct mp_stream_seek_t *s = (struct mp_stream_seek_t*)(uintptr_t)arg;
@@ -110,6 +356,11 @@ STATIC mp_uint_t file_obj_ioctl(mp_obj_t o_in, mp_uint_t request, uintptr_t arg,
         }
         return 0;
 
+    #if MICROPY_VFS_MMAP
+    } else if (request == MP_STREAM_GET_MMAP) {
+        return file_obj_get_mmap(self, (mp_obj_t*)(uintptr_t)arg, errcode);
+    #endif
+
     } else if (request == MP_STREAM_CLOSE) {
         // if fs==NULL then the file is closed and in that case this method is a no-op
         if (self->fp.obj.fs != NULL) {
@@ -118,6 +369,9 @@ STATIC mp_uint_t file_obj_ioctl(mp_obj_t o_in, mp_uint_t request, uintptr_t arg,
                 *errcode = fresult_to_errno_table[res];
                 return MP_STREAM_ERROR;
             }
+            #if _USE_FASTSEEK
+            file_obj_free_link_map(self);
+            #endif
         }
         return 0;
 
@@ -174,6 +428,11 @@ STATIC mp_obj_t file_open(fs_user_mount_t *vfs, const mp_obj_type_t *type, mp_ar
 
     pyb_file_obj_t *o = m_new_obj_with_finaliser(pyb_file_obj_t);
     o->base.type = type;
+    #if MICROPY_VFS_FAT_ASYNC
+    o->async_op = ASYNC_IDLE;
+    o->async_errno = 0;
+    o->async_done = 0;
+    #endif
 
     const char *fname = mp_obj_str_get_str(args[0].u_obj);
     FRESULT res = f_open(&vfs->fatfs, &o->fp, fname, mode);
@@ -181,23 +440,12 @@ STATIC mp_obj_t file_open(fs_user_mount_t *vfs, const mp_obj_type_t *type, mp_ar
         m_del_obj(pyb_file_obj_t, o);
         mp_raise_OSError_errno_str(fresult_to_errno_table[res], args[0].u_obj);
     }
+    #if _USE_FASTSEEK
     // If we're reading, turn on fast seek.
     if (mode == FA_READ) {
-        // one call to determine how much space we need.
-        DWORD temp_table[2];
-        temp_table[0] = 2;
-        o->fp.cltbl = temp_table;
-        f_lseek(&o->fp, CREATE_LINKMAP);
-        DWORD size = (temp_table[0] + 1) * 2;
-        o->fp.cltbl = m_malloc_maybe(size * sizeof(DWORD), false);
-        if (o->fp.cltbl != NULL) {
-            o->fp.cltbl[0] = size;
-            res = f_lseek(&o->fp, CREATE_LINKMAP);
-            if (res != FR_OK) {
-                o->fp.cltbl = NULL;
-            }
-        }
+        file_obj_create_link_map(o);
     }
+    #endif
 
     // for 'a' mode, we must begin at the end of the file
     if ((mode & FA_OPEN_ALWAYS) != 0) {
@@ -225,6 +473,11 @@ STATIC const mp_rom_map_elem_t rawfile_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_close), MP_ROM_PTR(&mp_stream_close_obj) },
     { MP_ROM_QSTR(MP_QSTR_seek), MP_ROM_PTR(&mp_stream_seek_obj) },
     { MP_ROM_QSTR(MP_QSTR_tell), MP_ROM_PTR(&mp_stream_tell_obj) },
+    #if MICROPY_VFS_FAT_ASYNC
+    { MP_ROM_QSTR(MP_QSTR_readinto_async), MP_ROM_PTR(&file_obj_readinto_async_obj) },
+    { MP_ROM_QSTR(MP_QSTR_write_async), MP_ROM_PTR(&file_obj_write_async_obj) },
+    { MP_ROM_QSTR(MP_QSTR_async_result), MP_ROM_PTR(&file_obj_async_result_obj) },
+    #endif
     { MP_ROM_QSTR(MP_QSTR___del__), MP_ROM_PTR(&mp_stream_close_obj) },
     { MP_ROM_QSTR(MP_QSTR___enter__), MP_ROM_PTR(&mp_identity_obj) },
     { MP_ROM_QSTR(MP_QSTR___exit__), MP_ROM_PTR(&file_obj___exit___obj) },
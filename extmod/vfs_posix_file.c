@@ -11,6 +11,10 @@
 #if defined(MICROPY_VFS_POSIX) && MICROPY_VFS_POSIX
 
 #include <fcntl.h>
+#ifndef _WIN32
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
 
 #ifdef _WIN32
 #define fsync _commit
@@ -148,6 +152,59 @@ STATIC mp_uint_t vfs_posix_file_write(mp_obj_t o_in, const void *buf, mp_uint_t
     return r;
 }
 
+#ifndef _WIN32
+// A read-only mapping of a file, which is removed when the object is collected.
+typedef struct _vfs_posix_mmap_t {
+    mp_obj_base_t base;
+    void *buf;
+    size_t len;
+} vfs_posix_mmap_t;
+
+STATIC mp_obj_t vfs_posix_mmap_del(mp_obj_t self_in) {
+    vfs_posix_mmap_t *self = MP_OBJ_TO_PTR(self_in);
+    if (self->buf != NULL) {
+        munmap(self->buf, self->len);
+        self->buf = NULL;
+    }
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(vfs_posix_mmap_del_obj, vfs_posix_mmap_del);
+
+STATIC mp_obj_t vfs_posix_mmap_unary_op(mp_unary_op_t op, mp_obj_t self_in) {
+    vfs_posix_mmap_t *self = MP_OBJ_TO_PTR(self_in);
+    switch (op) {
+        case MP_UNARY_OP_LEN:
+            return MP_OBJ_NEW_SMALL_INT(self->len);
+        default:
+            return MP_OBJ_NULL; // op not supported
+    }
+}
+
+STATIC mp_int_t vfs_posix_mmap_get_buffer(mp_obj_t self_in, mp_buffer_info_t *bufinfo, mp_uint_t flags) {
+    vfs_posix_mmap_t *self = MP_OBJ_TO_PTR(self_in);
+    if ((flags & MP_BUFFER_WRITE) || self->buf == NULL) {
+        return 1;
+    }
+    bufinfo->buf = self->buf;
+    bufinfo->len = self->len;
+    bufinfo->typecode = 'B';
+    return 0;
+}
+
+STATIC const mp_rom_map_elem_t vfs_posix_mmap_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR___del__), MP_ROM_PTR(&vfs_posix_mmap_del_obj) },
+};
+STATIC MP_DEFINE_CONST_DICT(vfs_posix_mmap_locals_dict, vfs_posix_mmap_locals_dict_table);
+
+STATIC const mp_obj_type_t vfs_posix_mmap_type = {
+    { &mp_type_type },
+    .name = MP_QSTR_mmap,
+    .unary_op = vfs_posix_mmap_unary_op,
+    .buffer_p = { .get_buffer = vfs_posix_mmap_get_buffer },
+    .locals_dict = (mp_obj_dict_t*)&vfs_posix_mmap_locals_dict,
+};
+#endif
+
 STATIC mp_uint_t vfs_posix_file_ioctl(mp_obj_t o_in, mp_uint_t request, uintptr_t arg, int *errcode) {
     mp_obj_vfs_posix_file_t *o = MP_OBJ_TO_PTR(o_in);
     check_fd_is_open(o);
@@ -168,6 +225,31 @@ STATIC mp_uint_t vfs_posix_file_ioctl(mp_obj_t o_in, mp_uint_t request, uintptr_
             s->offset = off;
             return 0;
         }
+        #ifndef _WIN32
+        case MP_STREAM_GET_MMAP: {
+            struct stat st;
+            if (fstat(o->fd, &st) < 0) {
+                *errcode = errno;
+                return MP_STREAM_ERROR;
+            }
+            if (st.st_size == 0) {
+                *errcode = MP_EINVAL;
+                return MP_STREAM_ERROR;
+            }
+            // allocate first so that a failed allocation doesn't leak the mapping
+            vfs_posix_mmap_t *map = m_new_obj_with_finaliser(vfs_posix_mmap_t);
+            map->base.type = &vfs_posix_mmap_type;
+            map->buf = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, o->fd, 0);
+            if (map->buf == MAP_FAILED) {
+                map->buf = NULL;
+                *errcode = errno;
+                return MP_STREAM_ERROR;
+            }
+            map->len = st.st_size;
+            *(mp_obj_t*)arg = MP_OBJ_FROM_PTR(map);
+            return 0;
+        }
+        #endif
         case MP_STREAM_CLOSE:
             close(o->fd);
             #ifdef MICROPY_CPYTHON_COMPAT
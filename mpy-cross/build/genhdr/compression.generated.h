@@ -0,0 +1,3 @@
+const uint8_t lengths[] = { 0, 0, 2, 7, 4, 6, 7, 5, 2, 6, 12, 16, 0 };
+const uint8_t values[] = { 32, 101, 97, 105, 110, 111, 114, 115, 116, 99, 100, 108, 117, 39, 98, 102, 103, 109, 112, 37, 104, 113, 118, 119, 120, 121, 40, 41, 45, 106, 107, 44, 95, 42, 47, 48, 49, 58, 78, 10, 35, 46, 50, 51, 61, 67, 69, 73, 85, 122, 125, 13, 34, 54, 59, 60, 62, 66, 70, 71, 72, 76, 80, 82, 83, 84, 123 };
+#define compress_max_length_bits (7)
@@ -0,0 +1,568 @@
+// 32   823 000 0
+// 101 e 605 001 1
+// 97 a 344 0100 4
+// 105 i 339 0101 5
+// 110 n 454 0110 6
+// 111 o 419 0111 7
+// 114 r 334 1000 8
+// 115 s 308 1001 9
+// 116 t 527 1010 10
+// 99 c 222 10110 22
+// 100 d 195 10111 23
+// 108 l 188 11000 24
+// 117 u 208 11001 25
+// 39 \' 120 110100 52
+// 98 b 105 110101 53
+// 102 f 125 110110 54
+// 103 g 129 110111 55
+// 109 m 146 111000 56
+// 112 p 149 111001 57
+// 37 % 71 1110100 116
+// 104 h 52 1110101 117
+// 113 q 60 1110110 118
+// 118 v 46 1110111 119
+// 119 w 48 1111000 120
+// 120 x 46 1111001 121
+// 121 y 74 1111010 122
+// 40 ( 23 11110110 246
+// 41 ) 23 11110111 247
+// 45 - 22 11111000 248
+// 106 j 33 11111001 249
+// 107 k 31 11111010 250
+// 44 , 12 111110110 502
+// 95 _ 16 111110111 503
+// 42 * 8 1111110000 1008
+// 47 / 8 1111110001 1009
+// 48 0 8 1111110010 1010
+// 49 1 5 1111110011 1011
+// 58 : 8 1111110100 1012
+// 78 N 8 1111110101 1013
+// 10 \n 2 11111101100 2028
+// 35 # 2 11111101101 2029
+// 46 . 3 11111101110 2030
+// 50 2 3 11111101111 2031
+// 51 3 3 11111110000 2032
+// 61 = 4 11111110001 2033
+// 67 C 2 11111110010 2034
+// 69 E 2 11111110011 2035
+// 73 I 2 11111110100 2036
+// 85 U 2 11111110101 2037
+// 122 z 4 11111110110 2038
+// 125 } 3 11111110111 2039
+// 13 \r 2 111111110000 4080
+// 34 \" 2 111111110001 4081
+// 54 6 1 111111110010 4082
+// 59 ; 1 111111110011 4083
+// 60 < 1 111111110100 4084
+// 62 > 1 111111110101 4085
+// 66 B 1 111111110110 4086
+// 70 F 2 111111110111 4087
+// 71 G 1 111111111000 4088
+// 72 H 1 111111111001 4089
+// 76 L 1 111111111010 4090
+// 80 P 1 111111111011 4091
+// 82 R 1 111111111100 4092
+// 83 S 1 111111111101 4093
+// 84 T 1 111111111110 4094
+// 123 { 1 111111111111 4095
+// length count {3: 2, 4: 7, 5: 4, 6: 6, 7: 7, 8: 5, 9: 2, 10: 6, 11: 12, 12: 16}
+// values [' ', 'e', 'a', 'i', 'n', 'o', 'r', 's', 't', 'c', 'd', 'l', 'u', "'", 'b', 'f', 'g', 'm', 'p', '%', 'h', 'q', 'v', 'w', 'x', 'y', '(', ')', '-', 'j', 'k', ',', '_', '*', '/', '0', '1', ':', 'N', '\n', '#', '.', '2', '3', '=', 'C', 'E', 'I', 'U', 'z', '}', '\r', '"', '6', ';', '<', '>', 'B', 'F', 'G', 'H', 'L', 'P', 'R', 'S', 'T', '{'] lengths 13 bytearray(b'\x00\x00\x02\x07\x04\x06\x07\x05\x02\x06\x0c\x10\x00')
+// estimated total memory size 29157
+// [' ', 'e', 'a', 'i', 'n', 'o', 'r', 's', 't', 'c', 'd', 'l', 'u', "'", 'b', 'f', 'g', 'm', 'p', '%', 'h', 'q', 'v', 'w', 'x', 'y', '(', ')', '-', 'j', 'k', ',', '_', '*', '/', '0', '1', ':', 'N', '\n', '#', '.', '2', '3', '=', 'C', 'E', 'I', 'U', 'z', '}', '\r', '"', '6', ';', '<', '>', 'B', 'F', 'G', 'H', 'L', 'P', 'R', 'S', 'T', '{'] bytearray(b'\x00\x00\x02\x07\x04\x06\x07\x05\x02\x06\x0c\x10\x00')
+// This file was automatically generated by makeqstrdata.py
+
+QDEF(MP_QSTR_NULL, (const byte*)"\x00\x00\x00" "")
+QDEF(MP_QSTR_, (const byte*)"\x05\x15\x00" "")
+QDEF(MP_QSTR___add__, (const byte*)"\xc4\x82\x07" "__add__")
+QDEF(MP_QSTR___aenter__, (const byte*)"\x4c\x84\x0a" "__aenter__")
+QDEF(MP_QSTR___aexit__, (const byte*)"\xc4\xcf\x09" "__aexit__")
+QDEF(MP_QSTR___aiter__, (const byte*)"\x4e\x2b\x09" "__aiter__")
+QDEF(MP_QSTR___anext__, (const byte*)"\x83\xb4\x09" "__anext__")
+QDEF(MP_QSTR___bool__, (const byte*)"\x2b\x65\x08" "__bool__")
+QDEF(MP_QSTR___build_class__, (const byte*)"\x42\x88\x0f" "__build_class__")
+QDEF(MP_QSTR___bytes__, (const byte*)"\xdc\x81\x09" "__bytes__")
+QDEF(MP_QSTR___call__, (const byte*)"\xa7\xf9\x08" "__call__")
+QDEF(MP_QSTR___class__, (const byte*)"\x2b\xc5\x09" "__class__")
+QDEF(MP_QSTR___contains__, (const byte*)"\xc6\x5f\x0c" "__contains__")
+QDEF(MP_QSTR___delitem__, (const byte*)"\xfd\x35\x0b" "__delitem__")
+QDEF(MP_QSTR___dict__, (const byte*)"\x7f\x54\x08" "__dict__")
+QDEF(MP_QSTR___enter__, (const byte*)"\x6d\xba\x09" "__enter__")
+QDEF(MP_QSTR___eq__, (const byte*)"\x71\x3e\x06" "__eq__")
+QDEF(MP_QSTR___exit__, (const byte*)"\x45\xf8\x08" "__exit__")
+QDEF(MP_QSTR___ge__, (const byte*)"\xa7\x46\x06" "__ge__")
+QDEF(MP_QSTR___getattr__, (const byte*)"\x40\xf8\x0b" "__getattr__")
+QDEF(MP_QSTR___getitem__, (const byte*)"\x26\x39\x0b" "__getitem__")
+QDEF(MP_QSTR___gt__, (const byte*)"\xb6\x82\x06" "__gt__")
+QDEF(MP_QSTR___hash__, (const byte*)"\xf7\xc8\x08" "__hash__")
+QDEF(MP_QSTR___iadd__, (const byte*)"\x6d\x4a\x08" "__iadd__")
+QDEF(MP_QSTR___import__, (const byte*)"\x38\x3e\x0a" "__import__")
+QDEF(MP_QSTR___init__, (const byte*)"\x5f\xa5\x08" "__init__")
+QDEF(MP_QSTR___isub__, (const byte*)"\x08\x78\x08" "__isub__")
+QDEF(MP_QSTR___iter__, (const byte*)"\xcf\x32\x08" "__iter__")
+QDEF(MP_QSTR___le__, (const byte*)"\xcc\x13\x06" "__le__")
+QDEF(MP_QSTR___len__, (const byte*)"\xe2\xb0\x07" "__len__")
+QDEF(MP_QSTR___lt__, (const byte*)"\x5d\x68\x06" "__lt__")
+QDEF(MP_QSTR___main__, (const byte*)"\x8e\x13\x08" "__main__")
+QDEF(MP_QSTR___module__, (const byte*)"\xff\x30\x0a" "__module__")
+QDEF(MP_QSTR___name__, (const byte*)"\xe2\x38\x08" "__name__")
+QDEF(MP_QSTR___new__, (const byte*)"\x79\x15\x07" "__new__")
+QDEF(MP_QSTR___next__, (const byte*)"\x02\x73\x08" "__next__")
+QDEF(MP_QSTR___path__, (const byte*)"\xc8\x23\x08" "__path__")
+QDEF(MP_QSTR___qualname__, (const byte*)"\x6b\x00\x0c" "__qualname__")
+QDEF(MP_QSTR___repl_print__, (const byte*)"\x00\xbb\x0e" "__repl_print__")
+QDEF(MP_QSTR___repr__, (const byte*)"\x10\x0b\x08" "__repr__")
+QDEF(MP_QSTR___reversed__, (const byte*)"\x61\xff\x0c" "__reversed__")
+QDEF(MP_QSTR___setitem__, (const byte*)"\x32\x3e\x0b" "__setitem__")
+QDEF(MP_QSTR___str__, (const byte*)"\xd0\xcd\x07" "__str__")
+QDEF(MP_QSTR___sub__, (const byte*)"\x21\x09\x07" "__sub__")
+QDEF(MP_QSTR___traceback__, (const byte*)"\x4f\xcf\x0d" "__traceback__")
+QDEF(MP_QSTR__star_, (const byte*)"\x8f\xb5\x01" "*")
+QDEF(MP_QSTR__, (const byte*)"\xfa\xb5\x01" "_")
+QDEF(MP_QSTR__slash_, (const byte*)"\x8a\xb5\x01" "/")
+QDEF(MP_QSTR__percent__hash_o, (const byte*)"\x6c\x1a\x03" "%#o")
+QDEF(MP_QSTR__percent__hash_x, (const byte*)"\x7b\x1a\x03" "%#x")
+QDEF(MP_QSTR__brace_open__colon__hash_b_brace_close_, (const byte*)"\x58\x37\x05" "{:#b}")
+QDEF(MP_QSTR__space_, (const byte*)"\x85\xb5\x01" " ")
+QDEF(MP_QSTR__0x0a_, (const byte*)"\xaf\xb5\x01" "\x0a")
+QDEF(MP_QSTR_maximum_space_recursion_space_depth_space_exceeded, (const byte*)"\x73\x1e\x20" "maximum recursion depth exceeded")
+QDEF(MP_QSTR__lt_module_gt_, (const byte*)"\xbd\x94\x08" "<module>")
+QDEF(MP_QSTR__lt_lambda_gt_, (const byte*)"\x80\x8c\x08" "<lambda>")
+QDEF(MP_QSTR__lt_listcomp_gt_, (const byte*)"\xd4\x15\x0a" "<listcomp>")
+QDEF(MP_QSTR__lt_dictcomp_gt_, (const byte*)"\xcc\x8d\x0a" "<dictcomp>")
+QDEF(MP_QSTR__lt_setcomp_gt_, (const byte*)"\x54\x51\x09" "<setcomp>")
+QDEF(MP_QSTR__lt_genexpr_gt_, (const byte*)"\x34\x6a\x09" "<genexpr>")
+QDEF(MP_QSTR__lt_string_gt_, (const byte*)"\x52\x53\x08" "<string>")
+QDEF(MP_QSTR__lt_stdin_gt_, (const byte*)"\xe3\x63\x07" "<stdin>")
+QDEF(MP_QSTR_utf_hyphen_8, (const byte*)"\xb7\x82\x05" "utf-8")
+QDEF(MP_QSTR_ArithmeticError, (const byte*)"\x2d\x8c\x0f" "ArithmeticError")
+QDEF(MP_QSTR_AssertionError, (const byte*)"\x97\x5a\x0e" "AssertionError")
+QDEF(MP_QSTR_AttributeError, (const byte*)"\x21\xde\x0e" "AttributeError")
+QDEF(MP_QSTR_BaseException, (const byte*)"\x07\x92\x0d" "BaseException")
+QDEF(MP_QSTR_EACCES, (const byte*)"\x37\xc2\x06" "EACCES")
+QDEF(MP_QSTR_EADDRINUSE, (const byte*)"\x17\x11\x0a" "EADDRINUSE")
+QDEF(MP_QSTR_EAGAIN, (const byte*)"\x20\xec\x06" "EAGAIN")
+QDEF(MP_QSTR_EALREADY, (const byte*)"\x46\x15\x08" "EALREADY")
+QDEF(MP_QSTR_EBADF, (const byte*)"\x61\xa3\x05" "EBADF")
+QDEF(MP_QSTR_ECONNABORTED, (const byte*)"\x27\xab\x0c" "ECONNABORTED")
+QDEF(MP_QSTR_ECONNREFUSED, (const byte*)"\x3a\x2c\x0c" "ECONNREFUSED")
+QDEF(MP_QSTR_ECONNRESET, (const byte*)"\x19\xfb\x0a" "ECONNRESET")
+QDEF(MP_QSTR_EEXIST, (const byte*)"\x53\xad\x06" "EEXIST")
+QDEF(MP_QSTR_EHOSTUNREACH, (const byte*)"\x86\x25\x0c" "EHOSTUNREACH")
+QDEF(MP_QSTR_EINPROGRESS, (const byte*)"\x9a\xa0\x0b" "EINPROGRESS")
+QDEF(MP_QSTR_EINVAL, (const byte*)"\x5c\xff\x06" "EINVAL")
+QDEF(MP_QSTR_EIO, (const byte*)"\x86\xa6\x03" "EIO")
+QDEF(MP_QSTR_EISDIR, (const byte*)"\xa5\x4f\x06" "EISDIR")
+QDEF(MP_QSTR_ENOBUFS, (const byte*)"\xe3\x87\x07" "ENOBUFS")
+QDEF(MP_QSTR_ENODEV, (const byte*)"\xb6\x67\x06" "ENODEV")
+QDEF(MP_QSTR_ENOENT, (const byte*)"\x5e\x65\x06" "ENOENT")
+QDEF(MP_QSTR_ENOMEM, (const byte*)"\xa4\x85\x06" "ENOMEM")
+QDEF(MP_QSTR_ENOTCONN, (const byte*)"\x79\xd7\x08" "ENOTCONN")
+QDEF(MP_QSTR_EOFError, (const byte*)"\x91\xbf\x08" "EOFError")
+QDEF(MP_QSTR_EOPNOTSUPP, (const byte*)"\xac\x97\x0a" "EOPNOTSUPP")
+QDEF(MP_QSTR_EPERM, (const byte*)"\xea\x7f\x05" "EPERM")
+QDEF(MP_QSTR_ETIMEDOUT, (const byte*)"\xff\xf8\x09" "ETIMEDOUT")
+QDEF(MP_QSTR_Ellipsis, (const byte*)"\xf0\xe0\x08" "Ellipsis")
+QDEF(MP_QSTR_Exception, (const byte*)"\xf2\x29\x09" "Exception")
+QDEF(MP_QSTR_GeneratorExit, (const byte*)"\x16\x62\x0d" "GeneratorExit")
+QDEF(MP_QSTR_ImportError, (const byte*)"\x20\x9c\x0b" "ImportError")
+QDEF(MP_QSTR_IndentationError, (const byte*)"\x5c\x20\x10" "IndentationError")
+QDEF(MP_QSTR_IndexError, (const byte*)"\x83\xad\x0a" "IndexError")
+QDEF(MP_QSTR_KeyError, (const byte*)"\xea\x00\x08" "KeyError")
+QDEF(MP_QSTR_KeyboardInterrupt, (const byte*)"\xaf\xe2\x11" "KeyboardInterrupt")
+QDEF(MP_QSTR_LookupError, (const byte*)"\xff\x69\x0b" "LookupError")
+QDEF(MP_QSTR_MemoryError, (const byte*)"\xdc\x83\x0b" "MemoryError")
+QDEF(MP_QSTR_MpyError, (const byte*)"\x39\x7f\x08" "MpyError")
+QDEF(MP_QSTR_NaN, (const byte*)"\x24\xd8\x03" "NaN")
+QDEF(MP_QSTR_NameError, (const byte*)"\xba\x2d\x09" "NameError")
+QDEF(MP_QSTR_NoneType, (const byte*)"\x17\x68\x08" "NoneType")
+QDEF(MP_QSTR_NotImplementedError, (const byte*)"\xc6\x98\x13" "NotImplementedError")
+QDEF(MP_QSTR_OSError, (const byte*)"\xa1\x65\x07" "OSError")
+QDEF(MP_QSTR_OverflowError, (const byte*)"\x81\xe1\x0d" "OverflowError")
+QDEF(MP_QSTR_ReloadException, (const byte*)"\x03\xc2\x0f" "ReloadException")
+QDEF(MP_QSTR_RuntimeError, (const byte*)"\x61\xf1\x0c" "RuntimeError")
+QDEF(MP_QSTR_StopAsyncIteration, (const byte*)"\xec\xf0\x12" "StopAsyncIteration")
+QDEF(MP_QSTR_StopIteration, (const byte*)"\xea\x1c\x0d" "StopIteration")
+QDEF(MP_QSTR_SyntaxError, (const byte*)"\x94\x8f\x0b" "SyntaxError")
+QDEF(MP_QSTR_SystemExit, (const byte*)"\x20\xff\x0a" "SystemExit")
+QDEF(MP_QSTR_TimeoutError, (const byte*)"\x66\x4b\x0c" "TimeoutError")
+QDEF(MP_QSTR_TypeError, (const byte*)"\x25\x96\x09" "TypeError")
+QDEF(MP_QSTR_UnicodeError, (const byte*)"\x22\xd1\x0c" "UnicodeError")
+QDEF(MP_QSTR_ValueError, (const byte*)"\x96\x87\x0a" "ValueError")
+QDEF(MP_QSTR_ZeroDivisionError, (const byte*)"\xb6\x27\x11" "ZeroDivisionError")
+QDEF(MP_QSTR_abs, (const byte*)"\x95\x32\x03" "abs")
+QDEF(MP_QSTR_add, (const byte*)"\x44\x32\x03" "add")
+QDEF(MP_QSTR_all, (const byte*)"\x44\x33\x03" "all")
+QDEF(MP_QSTR_any, (const byte*)"\x13\x33\x03" "any")
+QDEF(MP_QSTR_append, (const byte*)"\x6b\x97\x06" "append")
+QDEF(MP_QSTR_args, (const byte*)"\xc2\xc6\x04" "args")
+QDEF(MP_QSTR_bin, (const byte*)"\xe0\x48\x03" "bin")
+QDEF(MP_QSTR_bool, (const byte*)"\xeb\x3c\x04" "bool")
+QDEF(MP_QSTR_bound_method, (const byte*)"\x97\xa2\x0c" "bound_method")
+QDEF(MP_QSTR_builtins, (const byte*)"\xf7\x31\x08" "builtins")
+QDEF(MP_QSTR_bytearray, (const byte*)"\x76\xa3\x09" "bytearray")
+QDEF(MP_QSTR_bytecode, (const byte*)"\x22\x7d\x08" "bytecode")
+QDEF(MP_QSTR_byteorder, (const byte*)"\x61\x99\x09" "byteorder")
+QDEF(MP_QSTR_bytes, (const byte*)"\x5c\xb2\x05" "bytes")
+QDEF(MP_QSTR_calcsize, (const byte*)"\x4d\x38\x08" "calcsize")
+QDEF(MP_QSTR_callable, (const byte*)"\x0d\x70\x08" "callable")
+QDEF(MP_QSTR_chr, (const byte*)"\xdc\x4c\x03" "chr")
+QDEF(MP_QSTR_classmethod, (const byte*)"\xb4\x8c\x0b" "classmethod")
+QDEF(MP_QSTR_clear, (const byte*)"\x7c\xa0\x05" "clear")
+QDEF(MP_QSTR_close, (const byte*)"\x33\x67\x05" "close")
+QDEF(MP_QSTR_closure, (const byte*)"\x74\xca\x07" "closure")
+QDEF(MP_QSTR_complex, (const byte*)"\xc5\x9d\x07" "complex")
+QDEF(MP_QSTR_const, (const byte*)"\xc0\xff\x05" "const")
+QDEF(MP_QSTR_copy, (const byte*)"\xe0\xdb\x04" "copy")
+QDEF(MP_QSTR_count, (const byte*)"\xa6\x4d\x05" "count")
+QDEF(MP_QSTR_decode, (const byte*)"\xa9\x59\x06" "decode")
+QDEF(MP_QSTR_default, (const byte*)"\xce\x7d\x07" "default")
+QDEF(MP_QSTR_delattr, (const byte*)"\xdb\xc8\x07" "delattr")
+QDEF(MP_QSTR_deleter, (const byte*)"\x6e\xdb\x07" "deleter")
+QDEF(MP_QSTR_dict, (const byte*)"\x3f\xfc\x04" "dict")
+QDEF(MP_QSTR_dict_view, (const byte*)"\x2d\xa9\x09" "dict_view")
+QDEF(MP_QSTR_difference, (const byte*)"\x72\x24\x0a" "difference")
+QDEF(MP_QSTR_difference_update, (const byte*)"\x9c\xfa\x11" "difference_update")
+QDEF(MP_QSTR_dir, (const byte*)"\xfa\x1e\x03" "dir")
+QDEF(MP_QSTR_discard, (const byte*)"\x0f\x71\x07" "discard")
+QDEF(MP_QSTR_divmod, (const byte*)"\xb8\x04\x06" "divmod")
+QDEF(MP_QSTR_doc, (const byte*)"\x2d\x1f\x03" "doc")
+QDEF(MP_QSTR_encode, (const byte*)"\x43\xca\x06" "encode")
+QDEF(MP_QSTR_end, (const byte*)"\x0a\x23\x03" "end")
+QDEF(MP_QSTR_endswith, (const byte*)"\x1b\xa3\x08" "endswith")
+QDEF(MP_QSTR_enumerate, (const byte*)"\x71\xba\x09" "enumerate")
+QDEF(MP_QSTR_errno, (const byte*)"\xc1\x11\x05" "errno")
+QDEF(MP_QSTR_eval, (const byte*)"\x9b\xa6\x04" "eval")
+QDEF(MP_QSTR_exec, (const byte*)"\x1e\xc0\x04" "exec")
+QDEF(MP_QSTR_extend, (const byte*)"\x63\xe8\x06" "extend")
+QDEF(MP_QSTR_filename, (const byte*)"\xe4\x54\x08" "filename")
+QDEF(MP_QSTR_filename2, (const byte*)"\x56\xf1\x09" "filename2")
+QDEF(MP_QSTR_filter, (const byte*)"\x25\xbe\x06" "filter")
+QDEF(MP_QSTR_find, (const byte*)"\x00\x34\x04" "find")
+QDEF(MP_QSTR_float, (const byte*)"\x35\x44\x05" "float")
+QDEF(MP_QSTR_flush, (const byte*)"\x61\xc1\x05" "flush")
+QDEF(MP_QSTR_format, (const byte*)"\x26\x33\x06" "format")
+QDEF(MP_QSTR_from_bytes, (const byte*)"\x35\x74\x0a" "from_bytes")
+QDEF(MP_QSTR_fromkeys, (const byte*)"\x37\xbd\x08" "fromkeys")
+QDEF(MP_QSTR_function, (const byte*)"\x27\x02\x08" "function")
+QDEF(MP_QSTR_generator, (const byte*)"\x96\xc3\x09" "generator")
+QDEF(MP_QSTR_get, (const byte*)"\x33\x3b\x03" "get")
+QDEF(MP_QSTR_getattr, (const byte*)"\xc0\x17\x07" "getattr")
+QDEF(MP_QSTR_getter, (const byte*)"\x90\xb2\x06" "getter")
+QDEF(MP_QSTR_globals, (const byte*)"\x9d\x49\x07" "globals")
+QDEF(MP_QSTR_hasattr, (const byte*)"\x8c\xb0\x07" "hasattr")
+QDEF(MP_QSTR_hash, (const byte*)"\xb7\x70\x04" "hash")
+QDEF(MP_QSTR_heap_lock, (const byte*)"\xad\x8c\x09" "heap_lock")
+QDEF(MP_QSTR_heap_unlock, (const byte*)"\x56\x2d\x0b" "heap_unlock")
+QDEF(MP_QSTR_hex, (const byte*)"\x70\x50\x03" "hex")
+QDEF(MP_QSTR_id, (const byte*)"\x28\x6f\x02" "id")
+QDEF(MP_QSTR_imag, (const byte*)"\x47\xb7\x04" "imag")
+QDEF(MP_QSTR_index, (const byte*)"\x7b\x28\x05" "index")
+QDEF(MP_QSTR_inf, (const byte*)"\x04\x53\x03" "inf")
+QDEF(MP_QSTR_insert, (const byte*)"\x12\x54\x06" "insert")
+QDEF(MP_QSTR_int, (const byte*)"\x16\x53\x03" "int")
+QDEF(MP_QSTR_intersection, (const byte*)"\x28\x2a\x0c" "intersection")
+QDEF(MP_QSTR_intersection_update, (const byte*)"\x06\xdd\x13" "intersection_update")
+QDEF(MP_QSTR_isalpha, (const byte*)"\xeb\x37\x07" "isalpha")
+QDEF(MP_QSTR_isdigit, (const byte*)"\xa8\x9a\x07" "isdigit")
+QDEF(MP_QSTR_isdisjoint, (const byte*)"\xf7\x68\x0a" "isdisjoint")
+QDEF(MP_QSTR_isinstance, (const byte*)"\xb6\xbe\x0a" "isinstance")
+QDEF(MP_QSTR_islower, (const byte*)"\xfc\x80\x07" "islower")
+QDEF(MP_QSTR_isspace, (const byte*)"\x5b\xf8\x07" "isspace")
+QDEF(MP_QSTR_issubclass, (const byte*)"\xb5\x7f\x0a" "issubclass")
+QDEF(MP_QSTR_issubset, (const byte*)"\xb9\xc1\x08" "issubset")
+QDEF(MP_QSTR_issuperset, (const byte*)"\xfc\xec\x0a" "issuperset")
+QDEF(MP_QSTR_isupper, (const byte*)"\xdd\xa7\x07" "isupper")
+QDEF(MP_QSTR_items, (const byte*)"\xe3\x53\x05" "items")
+QDEF(MP_QSTR_iter, (const byte*)"\x8f\x21\x04" "iter")
+QDEF(MP_QSTR_iterable, (const byte*)"\x25\x92\x08" "iterable")
+QDEF(MP_QSTR_iterator, (const byte*)"\x47\xbe\x08" "iterator")
+QDEF(MP_QSTR_join, (const byte*)"\xa7\x5c\x04" "join")
+QDEF(MP_QSTR_key, (const byte*)"\x32\x6d\x03" "key")
+QDEF(MP_QSTR_keys, (const byte*)"\x01\x13\x04" "keys")
+QDEF(MP_QSTR_len, (const byte*)"\x62\x40\x03" "len")
+QDEF(MP_QSTR_length, (const byte*)"\x59\x87\x06" "length")
+QDEF(MP_QSTR_list, (const byte*)"\x27\x1d\x04" "list")
+QDEF(MP_QSTR_little, (const byte*)"\x89\x6a\x06" "little")
+QDEF(MP_QSTR_locals, (const byte*)"\x3b\xa1\x06" "locals")
+QDEF(MP_QSTR_lower, (const byte*)"\xc6\xcb\x05" "lower")
+QDEF(MP_QSTR_lstrip, (const byte*)"\xe5\xb9\x06" "lstrip")
+QDEF(MP_QSTR_map, (const byte*)"\xb9\x43\x03" "map")
+QDEF(MP_QSTR_max, (const byte*)"\xb1\x43\x03" "max")
+QDEF(MP_QSTR_micropython, (const byte*)"\x0b\x7c\x0b" "micropython")
+QDEF(MP_QSTR_min, (const byte*)"\xaf\x42\x03" "min")
+QDEF(MP_QSTR_module, (const byte*)"\xbf\x99\x06" "module")
+QDEF(MP_QSTR_native, (const byte*)"\x84\x0b\x06" "native")
+QDEF(MP_QSTR_next, (const byte*)"\x42\x88\x04" "next")
+QDEF(MP_QSTR_object, (const byte*)"\x90\x8d\x06" "object")
+QDEF(MP_QSTR_oct, (const byte*)"\xfd\x5c\x03" "oct")
+QDEF(MP_QSTR_opt_level, (const byte*)"\x87\x67\x09" "opt_level")
+QDEF(MP_QSTR_ord, (const byte*)"\x1c\x5e\x03" "ord")
+QDEF(MP_QSTR_pack, (const byte*)"\xbc\xd1\x04" "pack")
+QDEF(MP_QSTR_pack_into, (const byte*)"\x1f\xa9\x09" "pack_into")
+QDEF(MP_QSTR_pend_throw, (const byte*)"\xf3\x74\x0a" "pend_throw")
+QDEF(MP_QSTR_pop, (const byte*)"\x2a\x73\x03" "pop")
+QDEF(MP_QSTR_popitem, (const byte*)"\xbf\x2c\x07" "popitem")
+QDEF(MP_QSTR_pow, (const byte*)"\x2d\x73\x03" "pow")
+QDEF(MP_QSTR_print, (const byte*)"\x54\xc6\x05" "print")
+QDEF(MP_QSTR_property, (const byte*)"\xc2\x29\x08" "property")
+QDEF(MP_QSTR_protocol_pin, (const byte*)"\x1b\x57\x0c" "protocol_pin")
+QDEF(MP_QSTR_protocol_stream, (const byte*)"\x90\x24\x0f" "protocol_stream")
+QDEF(MP_QSTR_range, (const byte*)"\x1a\x5e\x05" "range")
+QDEF(MP_QSTR_real, (const byte*)"\xbf\xf9\x04" "real")
+QDEF(MP_QSTR_remove, (const byte*)"\x63\x8a\x06" "remove")
+QDEF(MP_QSTR_replace, (const byte*)"\x49\x25\x07" "replace")
+QDEF(MP_QSTR_repr, (const byte*)"\xd0\xf7\x04" "repr")
+QDEF(MP_QSTR_reverse, (const byte*)"\x25\x2a\x07" "reverse")
+QDEF(MP_QSTR_reversed, (const byte*)"\xa1\x6e\x08" "reversed")
+QDEF(MP_QSTR_rfind, (const byte*)"\xd2\x9c\x05" "rfind")
+QDEF(MP_QSTR_rindex, (const byte*)"\xe9\x2b\x06" "rindex")
+QDEF(MP_QSTR_round, (const byte*)"\xe7\x25\x05" "round")
+QDEF(MP_QSTR_rsplit, (const byte*)"\xa5\x00\x06" "rsplit")
+QDEF(MP_QSTR_rstrip, (const byte*)"\x3b\x95\x06" "rstrip")
+QDEF(MP_QSTR_send, (const byte*)"\xb9\x76\x04" "send")
+QDEF(MP_QSTR_sep, (const byte*)"\x23\x8f\x03" "sep")
+QDEF(MP_QSTR_set, (const byte*)"\x27\x8f\x03" "set")
+QDEF(MP_QSTR_setattr, (const byte*)"\xd4\xa8\x07" "setattr")
+QDEF(MP_QSTR_setdefault, (const byte*)"\x6c\xa3\x0a" "setdefault")
+QDEF(MP_QSTR_setter, (const byte*)"\x04\x59\x06" "setter")
+QDEF(MP_QSTR_signed, (const byte*)"\x37\x01\x06" "signed")
+QDEF(MP_QSTR_slice, (const byte*)"\xb5\xf4\x05" "slice")
+QDEF(MP_QSTR_sort, (const byte*)"\xbf\x9d\x04" "sort")
+QDEF(MP_QSTR_sorted, (const byte*)"\x5e\x15\x06" "sorted")
+QDEF(MP_QSTR_split, (const byte*)"\xb7\x33\x05" "split")
+QDEF(MP_QSTR_start, (const byte*)"\x85\xef\x05" "start")
+QDEF(MP_QSTR_startswith, (const byte*)"\x74\xe8\x0a" "startswith")
+QDEF(MP_QSTR_staticmethod, (const byte*)"\x62\xaf\x0c" "staticmethod")
+QDEF(MP_QSTR_step, (const byte*)"\x57\x36\x04" "step")
+QDEF(MP_QSTR_stop, (const byte*)"\x9d\x36\x04" "stop")
+QDEF(MP_QSTR_str, (const byte*)"\x50\x8d\x03" "str")
+QDEF(MP_QSTR_strerror, (const byte*)"\x48\x71\x08" "strerror")
+QDEF(MP_QSTR_strip, (const byte*)"\x29\x1e\x05" "strip")
+QDEF(MP_QSTR_sum, (const byte*)"\x2e\x8d\x03" "sum")
+QDEF(MP_QSTR_super, (const byte*)"\xc4\xb2\x05" "super")
+QDEF(MP_QSTR_symmetric_difference, (const byte*)"\xce\x67\x14" "symmetric_difference")
+QDEF(MP_QSTR_symmetric_difference_update, (const byte*)"\x60\xf8\x1b" "symmetric_difference_update")
+QDEF(MP_QSTR_throw, (const byte*)"\xb3\x44\x05" "throw")
+QDEF(MP_QSTR_to_bytes, (const byte*)"\xd8\x3e\x08" "to_bytes")
+QDEF(MP_QSTR_tuple, (const byte*)"\xfd\x41\x05" "tuple")
+QDEF(MP_QSTR_type, (const byte*)"\x9d\x7f\x04" "type")
+QDEF(MP_QSTR_union, (const byte*)"\xf6\x7c\x05" "union")
+QDEF(MP_QSTR_unpack, (const byte*)"\x07\x3c\x06" "unpack")
+QDEF(MP_QSTR_unpack_from, (const byte*)"\x0e\x6d\x0b" "unpack_from")
+QDEF(MP_QSTR_update, (const byte*)"\xb4\x76\x06" "update")
+QDEF(MP_QSTR_upper, (const byte*)"\x27\x94\x05" "upper")
+QDEF(MP_QSTR_ustruct, (const byte*)"\x47\x08\x07" "ustruct")
+QDEF(MP_QSTR_value, (const byte*)"\x4e\x34\x05" "value")
+QDEF(MP_QSTR_values, (const byte*)"\x7d\xbe\x06" "values")
+QDEF(MP_QSTR_zip, (const byte*)"\xe6\xac\x03" "zip")
+TRANSLATION("  File \"%q\", line %d", 40, 7, 251, 174, 8, 255, 30, 157, 191, 199, 236, 48, 172, 71, 75, 128) //   File \"%q\", line %d
+TRANSLATION("%%c requires int or char", 49, 211, 165, 132, 30, 217, 88, 50, 21, 168, 60, 11, 117, 72) // %%c requires int or char
+TRANSLATION("%q index out of range", 43, 211, 176, 86, 185, 242, 31, 52, 31, 97, 8, 219, 144) // %q index out of range
+TRANSLATION("%q indices must be integers, not %q", 71, 211, 176, 86, 186, 216, 200, 227, 51, 67, 82, 21, 168, 238, 98, 126, 193, 158, 135, 78, 192) // %q indices must be integers, not %q
+TRANSLATION("%q() takes %d positional arguments but %d were given", 105, 211, 183, 183, 184, 164, 250, 50, 58, 92, 114, 242, 180, 174, 201, 128, 145, 190, 120, 45, 82, 53, 205, 14, 151, 30, 12, 17, 186, 247, 44) // %q() takes %d positional arguments but %d were given
+TRANSLATION("'%q' argument required", 45, 167, 78, 218, 4, 141, 243, 193, 106, 16, 123, 101, 96, 220) // \'%q\' argument required
+TRANSLATION("'%q' object cannot assign attribute '%q'", 81, 167, 78, 218, 7, 215, 228, 218, 133, 145, 153, 232, 36, 202, 238, 193, 42, 161, 117, 205, 17, 167, 78, 218, 0) // \'%q\' object cannot assign attribute \'%q\'
+TRANSLATION("'%q' object does not support '%q'", 67, 167, 78, 218, 7, 215, 228, 218, 133, 220, 200, 103, 161, 57, 231, 151, 138, 26, 116, 237, 160) // \'%q\' object does not support \'%q\'
+TRANSLATION("'%q' object does not support item assignment", 89, 167, 78, 218, 7, 215, 228, 218, 133, 220, 200, 103, 161, 57, 231, 151, 138, 11, 71, 128, 147, 43, 187, 112, 90, 128) // \'%q\' object does not support item assignment
+TRANSLATION("'%q' object does not support item deletion", 85, 167, 78, 218, 7, 215, 228, 218, 133, 220, 200, 103, 161, 57, 231, 151, 138, 11, 71, 129, 115, 131, 74, 236) // \'%q\' object does not support item deletion
+TRANSLATION("'%q' object has no attribute '%q'", 67, 167, 78, 218, 7, 215, 228, 218, 135, 84, 144, 206, 18, 170, 23, 92, 209, 26, 116, 237, 160) // \'%q\' object has no attribute \'%q\'
+TRANSLATION("'%q' object is not an iterator", 61, 167, 78, 218, 7, 215, 228, 218, 130, 200, 103, 160, 140, 22, 140, 37, 60, 0) // \'%q\' object is not an iterator
+TRANSLATION("'%q' object is not callable", 55, 167, 78, 218, 7, 215, 228, 218, 130, 200, 103, 161, 100, 198, 19, 92, 16) // \'%q\' object is not callable
+TRANSLATION("'%q' object is not iterable", 55, 167, 78, 218, 7, 215, 228, 218, 130, 200, 103, 160, 180, 97, 53, 193) // \'%q\' object is not iterable
+TRANSLATION("'%q' object is not subscriptable", 65, 167, 78, 218, 7, 215, 228, 218, 130, 200, 103, 161, 57, 214, 109, 11, 205, 38, 184, 32) // \'%q\' object is not subscriptable
+TRANSLATION("'=' alignment not allowed in string format specifier", 105, 167, 241, 208, 38, 23, 118, 224, 181, 6, 122, 9, 140, 63, 131, 112, 172, 38, 161, 91, 113, 179, 199, 9, 66, 121, 54, 93, 148, 192) // \'=\' alignment not allowed in string format specifier
+TRANSLATION("'await' outside function", 49, 162, 120, 69, 173, 3, 230, 165, 110, 70, 217, 107, 82, 187, 0) // \'await\' outside function
+TRANSLATION("'await', 'async for' or 'async with' outside async function", 119, 162, 120, 69, 173, 62, 195, 68, 159, 77, 97, 179, 198, 129, 224, 104, 147, 233, 172, 60, 45, 117, 208, 62, 106, 86, 228, 36, 250, 107, 13, 178, 214, 165, 118) // \'await\', \'async for\' or \'async with\' outside async function
+TRANSLATION("'break' outside loop", 41, 166, 176, 83, 235, 64, 249, 169, 91, 145, 135, 126, 64) // \'break\' outside loop
+TRANSLATION("'continue' outside loop", 47, 165, 157, 169, 91, 39, 64, 249, 169, 91, 145, 135, 126, 64) // \'continue\' outside loop
+TRANSLATION("'coroutine' object is not an iterator", 75, 165, 158, 31, 52, 172, 116, 15, 175, 201, 181, 5, 144, 207, 65, 24, 45, 24, 74, 120) // \'coroutine\' object is not an iterator
+TRANSLATION("'return' outside function", 51, 164, 26, 204, 54, 129, 243, 82, 183, 35, 108, 181, 169, 93, 128) // \'return\' outside function
+TRANSLATION("'yield' outside function", 49, 167, 165, 56, 190, 129, 243, 82, 183, 35, 108, 181, 169, 93, 128) // \'yield\' outside function
+TRANSLATION("*x must be assignment target", 57, 248, 121, 28, 102, 104, 106, 66, 76, 174, 237, 193, 106, 20, 145, 185, 160) // *x must be assignment target
+TRANSLATION(", in %q\n", 19, 246, 10, 195, 167, 111, 240, 253, 128) // , in %q\r\n
+TRANSLATION("0.0 to a complex power", 45, 249, 126, 239, 200, 83, 132, 22, 126, 57, 193, 242, 57, 127, 6, 0) // 0.0 to a complex power
+TRANSLATION("3-arg pow() not supported", 51, 252, 62, 18, 55, 28, 191, 143, 111, 112, 207, 66, 115, 207, 47, 20, 110) // 3-arg pow() not supported
+TRANSLATION("Call super().__init__() before accessing native object.", 111, 252, 147, 24, 19, 158, 76, 123, 123, 254, 239, 191, 221, 89, 107, 239, 247, 246, 247, 26, 157, 158, 8, 75, 88, 204, 171, 110, 25, 41, 123, 144, 250, 252, 155, 87, 238) // Call super().__init__() before accessing native object.
+TRANSLATION("Corrupt raw code", 33, 252, 158, 35, 60, 208, 132, 240, 44, 247, 32) // Corrupt raw code
+TRANSLATION("File exists", 23, 254, 235, 130, 15, 149, 154, 144) // File exists
+TRANSLATION("Input/output error", 37, 253, 27, 156, 215, 226, 249, 174, 115, 64, 196, 60, 0) // Input/output error
+TRANSLATION("Invalid argument", 33, 253, 27, 186, 97, 110, 18, 55, 207, 5, 168) // Invalid argument
+TRANSLATION("LHS of keyword arg must be an id", 65, 255, 95, 243, 255, 161, 246, 31, 71, 215, 135, 139, 132, 141, 199, 25, 154, 26, 144, 140, 22, 224) // LHS of keyword arg must be an id
+TRANSLATION("Name too long", 27, 250, 167, 4, 83, 184, 195, 182, 224) // Name too long
+TRANSLATION("No space left on device", 47, 250, 184, 158, 82, 196, 96, 237, 65, 216, 92, 247, 91, 16) // No space left on device
+TRANSLATION("No such file/directory", 45, 250, 184, 156, 219, 168, 217, 112, 127, 27, 172, 27, 83, 199, 160) // No such file/directory
+TRANSLATION("Permission denied", 35, 255, 102, 56, 89, 149, 118, 23, 44, 166, 224) // Permission denied
+TRANSLATION("Read-only filesystem", 41, 255, 133, 47, 240, 237, 143, 67, 101, 193, 159, 83, 71, 128) // Read-only filesystem
+TRANSLATION("Traceback (most recent call last):\n", 73, 255, 208, 150, 58, 165, 190, 135, 183, 15, 52, 32, 216, 181, 11, 38, 48, 48, 147, 94, 255, 167, 248, 126, 192) // Traceback (most recent call last):\r\n
+TRANSLATION("Unable to init parser", 43, 253, 89, 53, 193, 20, 225, 89, 104, 114, 145, 38, 0) // Unable to init parser
+TRANSLATION("Unsupported operation", 43, 253, 90, 115, 207, 47, 20, 110, 31, 147, 9, 74, 236) // Unsupported operation
+TRANSLATION("__init__() should return None", 59, 247, 251, 171, 45, 125, 254, 254, 222, 226, 122, 190, 113, 113, 6, 179, 12, 63, 87, 98) // __init__() should return None
+TRANSLATION("__init__() should return None, not '%q'", 79, 247, 251, 171, 45, 125, 254, 254, 222, 226, 122, 190, 113, 113, 6, 179, 12, 63, 87, 99, 246, 12, 244, 52, 233, 219, 64) // __init__() should return None, not \'%q\'
+TRANSLATION("__new__ arg must be a user-type", 63, 247, 251, 177, 241, 247, 251, 132, 141, 199, 25, 154, 26, 144, 131, 50, 99, 226, 189, 114, 64) // __new__ arg must be a user-type
+TRANSLATION("a bytes-like object is required", 62, 131, 95, 84, 103, 227, 11, 244, 67, 235, 242, 109, 65, 100, 65, 237, 149, 131, 112) // a bytes-like object is required
+TRANSLATION("abort() called", 28, 154, 188, 87, 183, 184, 178, 99, 6, 224) // abort() called
+TRANSLATION("arg is an empty sequence", 48, 145, 184, 89, 8, 192, 241, 205, 122, 18, 123, 100, 181, 136) // arg is an empty sequence
+TRANSLATION("argument has wrong type", 46, 145, 190, 120, 45, 67, 170, 72, 241, 14, 219, 138, 245, 201) // argument has wrong type
+TRANSLATION("argument num/types mismatch", 54, 145, 190, 120, 45, 65, 179, 199, 227, 94, 185, 50, 56, 89, 225, 42, 221, 64) // argument num/types mismatch
+TRANSLATION("argument should be a '%q' not a '%q'", 72, 145, 190, 120, 45, 66, 122, 190, 113, 113, 169, 8, 52, 233, 219, 64, 207, 65, 6, 157, 59, 104) // argument should be a \'%q\' not a \'%q\'
+TRANSLATION("attributes not supported yet", 56, 149, 80, 186, 230, 140, 134, 122, 19, 158, 121, 120, 163, 113, 232, 208) // attributes not supported yet
+TRANSLATION("bad conversion specifier", 49, 170, 92, 89, 219, 185, 137, 87, 97, 60, 155, 46, 202, 96) // bad conversion specifier
+TRANSLATION("bad typecode", 25, 170, 92, 87, 174, 77, 158, 228) // bad typecode
+TRANSLATION("buffer too small", 33, 174, 118, 216, 192, 167, 113, 60, 38, 48) // buffer too small
+TRANSLATION("byte code not implemented", 51, 175, 170, 34, 207, 114, 25, 232, 47, 28, 224, 240, 90, 141, 192) // byte code not implemented
+TRANSLATION("bytes value out of range", 49, 175, 170, 50, 59, 166, 50, 67, 230, 131, 236, 33, 27, 114) // bytes value out of range
+TRANSLATION("can only save bytecode", 45, 100, 96, 237, 143, 66, 83, 185, 26, 250, 163, 103, 185) // can only save bytecode
+TRANSLATION("can't add special method to already-subclassed class", 105, 100, 109, 40, 37, 238, 39, 147, 101, 76, 14, 13, 117, 123, 138, 112, 152, 130, 151, 245, 241, 57, 214, 216, 73, 147, 113, 108, 36, 200) // can\'t add special method to already-subclassed class
+TRANSLATION("can't assign to expression", 53, 100, 109, 40, 36, 202, 238, 194, 156, 31, 60, 193, 153, 87, 96) // can\'t assign to expression
+TRANSLATION("can't convert %q to %q", 45, 100, 109, 40, 89, 219, 185, 138, 29, 59, 10, 113, 211, 176) // can\'t convert %q to %q
+TRANSLATION("can't convert '%q' object to %q implicitly", 85, 100, 109, 40, 89, 219, 185, 138, 26, 116, 237, 160, 125, 126, 77, 168, 83, 142, 157, 130, 241, 206, 22, 203, 88, 244) // can\'t convert \'%q\' object to %q implicitly
+TRANSLATION("can't convert to %q", 39, 100, 109, 40, 89, 219, 185, 138, 20, 227, 167, 96) // can\'t convert to %q
+TRANSLATION("can't convert to str implicitly", 63, 100, 109, 40, 89, 219, 185, 138, 20, 226, 106, 2, 241, 206, 22, 203, 88, 244) // can\'t convert to str implicitly
+TRANSLATION("can't declare nonlocal in outer code", 73, 100, 109, 40, 92, 219, 9, 4, 51, 182, 30, 201, 128, 172, 31, 52, 96, 89, 238, 64) // can\'t declare nonlocal in outer code
+TRANSLATION("can't delete expression", 47, 100, 109, 40, 92, 224, 209, 7, 207, 48, 102, 85, 216) // can\'t delete expression
+TRANSLATION("can't do truncated division of a complex number", 95, 100, 109, 40, 93, 197, 70, 90, 201, 70, 226, 235, 221, 101, 93, 131, 236, 16, 89, 248, 231, 7, 200, 108, 241, 169, 128) // can\'t do truncated division of a complex number
+TRANSLATION("can't have multiple **x", 47, 100, 109, 40, 117, 78, 228, 113, 156, 82, 243, 130, 63, 15, 195, 200) // can\'t have multiple **x
+TRANSLATION("can't have multiple *x", 45, 100, 109, 40, 117, 78, 228, 113, 156, 82, 243, 130, 63, 15, 32) // can\'t have multiple *x
+TRANSLATION("can't pend throw to just-started generator", 85, 100, 109, 40, 114, 90, 226, 186, 195, 248, 20, 227, 231, 51, 95, 19, 73, 20, 110, 55, 44, 97, 41, 224) // can\'t pend throw to just-started generator
+TRANSLATION("can't send non-None value to a just-started generator", 107, 100, 109, 40, 73, 107, 134, 118, 248, 253, 93, 136, 238, 152, 201, 20, 225, 7, 206, 102, 190, 38, 146, 40, 220, 110, 88, 194, 83, 192) // can\'t send non-None value to a just-started generator
+TRANSLATION("can't switch from automatic field numbering to manual field specification", 147, 100, 109, 40, 79, 133, 171, 117, 27, 67, 240, 19, 52, 252, 37, 45, 134, 202, 113, 112, 217, 227, 83, 10, 219, 138, 113, 194, 54, 83, 3, 101, 56, 184, 158, 77, 151, 101, 178, 82, 187, 0) // can\'t switch from automatic field numbering to manual field specification
+TRANSLATION("can't switch from manual field specification to automatic field numbering", 147, 100, 109, 40, 79, 133, 171, 117, 27, 67, 240, 56, 70, 202, 96, 108, 167, 23, 19, 201, 178, 236, 182, 74, 87, 97, 78, 19, 52, 252, 37, 45, 134, 202, 113, 112, 217, 227, 83, 10, 219, 128) // can\'t switch from manual field specification to automatic field numbering
+TRANSLATION("cannot create '%q' instances", 57, 100, 102, 122, 22, 130, 148, 70, 157, 59, 104, 21, 166, 145, 172, 100) // cannot create \'%q\' instances
+TRANSLATION("cannot create instance", 45, 100, 102, 122, 22, 130, 148, 66, 180, 210, 53, 136) // cannot create instance
+TRANSLATION("cannot import name %q", 43, 100, 102, 122, 11, 199, 47, 20, 25, 56, 35, 167, 96) // cannot import name %q
+TRANSLATION("cannot perform relative import", 61, 100, 102, 122, 28, 152, 217, 227, 129, 7, 9, 75, 220, 133, 227, 151, 138) // cannot perform relative import
+TRANSLATION("chr() arg not in range(0x110000)", 65, 110, 177, 237, 238, 18, 55, 12, 244, 21, 132, 35, 110, 125, 191, 47, 63, 159, 231, 249, 126, 95, 151, 229, 238) // chr() arg not in range(0x110000)
+TRANSLATION("complex division by zero", 49, 103, 227, 156, 31, 34, 235, 221, 101, 93, 134, 190, 135, 246, 48, 224) // complex division by zero
+TRANSLATION("constant must be an integer", 55, 103, 105, 164, 106, 28, 102, 104, 106, 66, 48, 86, 163, 185, 128) // constant must be an integer
+TRANSLATION("default 'except' must be last", 59, 115, 178, 103, 20, 52, 62, 108, 121, 173, 7, 25, 154, 26, 145, 132, 154) // default \'except\' must be last
+TRANSLATION("dict update sequence has wrong length", 75, 117, 181, 12, 243, 116, 162, 36, 246, 201, 107, 17, 213, 36, 120, 135, 109, 198, 11, 111, 93, 64) // dict update sequence has wrong length
+TRANSLATION("division by zero", 33, 117, 238, 178, 174, 195, 95, 67, 251, 24, 112) // division by zero
+TRANSLATION("empty separator", 30, 120, 230, 189, 9, 60, 164, 37, 60, 0) // empty separator
+TRANSLATION("end of format while looking for conversion specifier", 104, 90, 225, 246, 27, 60, 112, 148, 60, 117, 92, 17, 135, 127, 165, 109, 198, 207, 2, 206, 221, 204, 74, 187, 9, 228, 217, 118, 83, 0) // end of format while looking for conversion specifier
+TRANSLATION("exceptions must derive from BaseException", 82, 124, 216, 243, 74, 237, 35, 140, 205, 11, 152, 94, 228, 109, 15, 192, 255, 100, 147, 252, 252, 216, 243, 74, 236) // exceptions must derive from BaseException
+TRANSLATION("expected ':' after format specifier", 70, 124, 242, 109, 70, 227, 79, 211, 64, 155, 81, 129, 179, 199, 9, 66, 121, 54, 93, 148, 192) // expected \':\' after format specifier
+TRANSLATION("expected tuple/list", 38, 124, 242, 109, 70, 226, 179, 206, 15, 227, 133, 154) // expected tuple/list
+TRANSLATION("expecting just a value for set", 60, 124, 242, 109, 74, 219, 143, 156, 205, 4, 29, 211, 25, 35, 103, 129, 38, 128) // expecting just a value for set
+TRANSLATION("expecting key:value for dict", 56, 124, 242, 109, 74, 219, 143, 163, 235, 244, 238, 152, 201, 27, 60, 11, 173, 168) // expecting key:value for dict
+TRANSLATION("extra keyword arguments given", 58, 124, 212, 32, 250, 62, 188, 60, 92, 36, 111, 158, 11, 84, 141, 215, 185, 96) // extra keyword arguments given
+TRANSLATION("extra positional arguments given", 64, 124, 212, 32, 229, 229, 105, 93, 147, 1, 35, 124, 240, 90, 164, 110, 189, 203, 0) // extra positional arguments given
+TRANSLATION("f-string expression part cannot include a '#'", 91, 183, 196, 212, 43, 110, 15, 158, 96, 204, 171, 176, 229, 34, 133, 145, 153, 232, 43, 91, 25, 185, 8, 52, 253, 186, 0) // f-string expression part cannot include a \'#\'
+TRANSLATION("f-string expression part cannot include a backslash", 103, 183, 196, 212, 43, 110, 15, 158, 96, 204, 171, 176, 229, 34, 133, 145, 153, 232, 43, 91, 25, 185, 8, 53, 75, 125, 78, 18, 122, 128) // f-string expression part cannot include a backslash
+TRANSLATION("f-string: empty expression not allowed", 77, 183, 196, 212, 43, 111, 250, 3, 199, 53, 232, 31, 60, 193, 153, 87, 96, 207, 65, 49, 135, 240, 110) // f-string: empty expression not allowed
+TRANSLATION("f-string: expecting '}'", 47, 183, 196, 212, 43, 111, 250, 3, 231, 147, 106, 86, 220, 105, 253, 244) // f-string: expecting \'}\'
+TRANSLATION("f-string: single '}' is not allowed", 71, 183, 196, 212, 43, 111, 250, 9, 86, 223, 4, 105, 253, 244, 11, 33, 158, 130, 99, 15, 224, 220) // f-string: single \'}\' is not allowed
+TRANSLATION("first argument to super() must be type", 77, 178, 196, 208, 72, 223, 60, 22, 161, 78, 39, 60, 152, 246, 247, 28, 102, 104, 106, 69, 122, 228, 128) // first argument to super() must be type
+TRANSLATION("format requires a dict", 45, 179, 199, 9, 66, 15, 108, 172, 25, 8, 46, 182, 160) // format requires a dict
+TRANSLATION("function does not take keyword arguments", 81, 182, 90, 212, 174, 194, 238, 100, 51, 208, 164, 250, 35, 232, 250, 240, 241, 112, 145, 190, 120, 45, 82) // function does not take keyword arguments
+TRANSLATION("function expected at most %d arguments, got %d", 93, 182, 90, 212, 174, 192, 249, 228, 218, 141, 194, 80, 225, 230, 135, 75, 132, 141, 243, 193, 106, 159, 176, 221, 232, 116, 184) // function expected at most %d arguments, got %d
+TRANSLATION("function got multiple values for argument '%q'", 93, 182, 90, 212, 174, 195, 119, 161, 198, 113, 75, 206, 8, 238, 152, 201, 145, 179, 192, 72, 223, 60, 22, 161, 167, 78, 218, 0) // function got multiple values for argument \'%q\'
+TRANSLATION("function missing %d required positional arguments", 99, 182, 90, 212, 174, 195, 133, 153, 86, 220, 116, 184, 131, 219, 43, 6, 227, 151, 149, 165, 118, 76, 4, 141, 243, 193, 106, 144) // function missing %d required positional arguments
+TRANSLATION("function missing keyword-only argument", 77, 182, 90, 212, 174, 195, 133, 153, 86, 220, 125, 31, 94, 30, 47, 240, 237, 143, 65, 35, 124, 240, 90, 128) // function missing keyword-only argument
+TRANSLATION("function missing required keyword argument '%q'", 95, 182, 90, 212, 174, 195, 133, 153, 86, 220, 65, 237, 149, 131, 113, 244, 125, 120, 120, 184, 72, 223, 60, 22, 161, 167, 78, 218, 0) // function missing required keyword argument \'%q\'
+TRANSLATION("function missing required positional argument #%d", 99, 182, 90, 212, 174, 195, 133, 153, 86, 220, 65, 237, 149, 131, 113, 203, 202, 210, 187, 38, 2, 70, 249, 224, 181, 15, 219, 210, 224) // function missing required positional argument #%d
+TRANSLATION("function takes %d positional arguments but %d were given", 113, 182, 90, 212, 174, 194, 147, 232, 200, 233, 113, 203, 202, 210, 187, 38, 2, 70, 249, 224, 181, 72, 215, 52, 58, 92, 120, 48, 70, 235, 220, 176) // function takes %d positional arguments but %d were given
+TRANSLATION("generator already executing", 55, 185, 99, 9, 79, 1, 49, 5, 47, 232, 31, 38, 217, 165, 109, 192) // generator already executing
+TRANSLATION("generator ignored GeneratorExit", 63, 185, 99, 9, 79, 1, 119, 103, 131, 113, 255, 5, 140, 37, 60, 127, 63, 43, 64) // generator ignored GeneratorExit
+TRANSLATION("identifier redefined as global", 60, 183, 45, 75, 178, 152, 16, 110, 118, 86, 55, 9, 35, 124, 62, 169, 128) // identifier redefined as global
+TRANSLATION("identifier redefined as nonlocal", 64, 183, 45, 75, 178, 152, 16, 110, 118, 86, 55, 9, 33, 157, 176, 246, 76, 0) // identifier redefined as nonlocal
+TRANSLATION("incomplete format", 34, 173, 103, 227, 156, 26, 35, 103, 142, 18, 128) // incomplete format
+TRANSLATION("incomplete format key", 42, 173, 103, 227, 156, 26, 35, 103, 142, 18, 135, 209, 244) // incomplete format key
+TRANSLATION("incorrect padding", 34, 173, 103, 136, 54, 161, 202, 94, 234, 219, 128) // incorrect padding
+TRANSLATION("index out of range", 36, 173, 115, 228, 62, 104, 62, 194, 17, 183, 32) // index out of range
+TRANSLATION("indices must be integers", 48, 173, 117, 177, 145, 198, 102, 134, 164, 43, 81, 220, 196, 128) // indices must be integers
+TRANSLATION("int() arg 2 must be >= 2 and <= 36", 68, 173, 94, 222, 225, 35, 113, 251, 199, 25, 154, 26, 145, 254, 191, 196, 126, 240, 141, 113, 254, 159, 196, 127, 15, 242) // int() arg 2 must be >= 2 and <= 36
+TRANSLATION("integer required", 32, 173, 71, 115, 2, 15, 108, 172, 27, 128) // integer required
+TRANSLATION("invalid format specifier", 48, 173, 221, 48, 183, 27, 60, 112, 148, 39, 147, 101, 217, 76, 0) // invalid format specifier
+TRANSLATION("invalid micropython decorator", 58, 173, 221, 48, 183, 28, 45, 161, 249, 245, 93, 93, 133, 205, 158, 18, 158, 0) // invalid micropython decorator
+TRANSLATION("invalid syntax", 28, 173, 221, 48, 183, 19, 233, 169, 60, 128) // invalid syntax
+TRANSLATION("invalid syntax for integer", 52, 173, 221, 48, 183, 19, 233, 169, 60, 141, 158, 2, 181, 29, 204, 0) // invalid syntax for integer
+TRANSLATION("invalid syntax for integer with base %d", 78, 173, 221, 48, 183, 19, 233, 169, 60, 141, 158, 2, 181, 29, 204, 15, 11, 93, 70, 169, 36, 116, 184) // invalid syntax for integer with base %d
+TRANSLATION("invalid syntax for number", 50, 173, 221, 48, 183, 19, 233, 169, 60, 141, 158, 3, 103, 141, 76, 0) // invalid syntax for number
+TRANSLATION("issubclass() arg 1 must be a class", 68, 179, 57, 214, 216, 73, 159, 111, 112, 145, 184, 252, 199, 25, 154, 26, 144, 130, 216, 73, 144) // issubclass() arg 1 must be a class
+TRANSLATION("issubclass() arg 2 must be a class or a tuple of classes", 112, 179, 57, 214, 216, 73, 159, 111, 112, 145, 184, 253, 227, 140, 205, 13, 72, 65, 108, 36, 200, 120, 8, 43, 60, 224, 135, 216, 91, 9, 50, 100) // issubclass() arg 2 must be a class or a tuple of classes
+TRANSLATION("join expects a list of str/bytes objects consistent with self object", 137, 242, 234, 192, 249, 228, 218, 164, 32, 194, 205, 7, 216, 77, 71, 227, 175, 170, 50, 31, 95, 147, 106, 145, 103, 105, 89, 162, 212, 60, 45, 117, 18, 113, 176, 125, 126, 77, 168) // join expects a list of str/bytes objects consistent with self object
+TRANSLATION("keyword argument(s) not yet implemented - use normal args instead", 131, 244, 125, 120, 120, 184, 72, 223, 60, 22, 175, 105, 247, 12, 244, 61, 26, 11, 199, 56, 60, 22, 163, 113, 240, 51, 36, 51, 199, 9, 128, 145, 188, 133, 105, 162, 151) // keyword argument(s) not yet implemented - use normal args instead
+TRANSLATION("keywords must be strings", 49, 244, 125, 120, 120, 188, 142, 51, 52, 53, 34, 106, 21, 183, 144) // keywords must be strings
+TRANSLATION("length argument not allowed for this type", 83, 130, 219, 215, 80, 145, 190, 120, 45, 65, 158, 130, 99, 15, 224, 220, 108, 240, 43, 170, 200, 175, 92, 144) // length argument not allowed for this type
+TRANSLATION("local variable referenced before assignment", 87, 135, 178, 96, 119, 72, 84, 215, 4, 65, 216, 193, 107, 27, 141, 78, 207, 4, 36, 202, 238, 220, 22, 160) // local variable referenced before assignment
+TRANSLATION("maximum recursion depth exceeded", 65, 194, 121, 94, 51, 192, 131, 108, 196, 171, 176, 185, 230, 186, 131, 230, 196, 220, 220) // maximum recursion depth exceeded
+TRANSLATION("memory allocation failed, allocating %u bytes", 91, 193, 225, 227, 208, 76, 97, 236, 148, 174, 195, 100, 92, 27, 253, 130, 99, 15, 100, 165, 109, 199, 76, 141, 125, 81, 144) // memory allocation failed, allocating %u bytes
+TRANSLATION("memory allocation failed, heap is locked", 81, 193, 225, 227, 208, 76, 97, 236, 148, 174, 195, 100, 92, 27, 253, 135, 82, 156, 133, 145, 135, 183, 209, 184) // memory allocation failed, heap is locked
+TRANSLATION("module not found", 33, 195, 223, 56, 33, 158, 134, 207, 150, 184) // module not found
+TRANSLATION("multiple *x in assignment", 51, 198, 113, 75, 206, 8, 252, 60, 133, 96, 147, 43, 187, 112, 90, 128) // multiple *x in assignment
+TRANSLATION("multiple bases have instance lay-out conflict", 91, 198, 113, 75, 206, 8, 213, 36, 200, 234, 157, 200, 86, 154, 70, 177, 24, 79, 95, 15, 154, 22, 118, 219, 11, 106) // multiple bases have instance lay-out conflict
+TRANSLATION("must use keyword argument for key function", 85, 198, 102, 134, 100, 143, 163, 235, 195, 197, 194, 70, 249, 224, 181, 13, 158, 7, 209, 244, 54, 203, 90, 149, 216) // must use keyword argument for key function
+TRANSLATION("name '%q' is not defined", 48, 201, 193, 26, 116, 237, 160, 89, 12, 244, 46, 118, 86, 55) // name \'%q\' is not defined
+TRANSLATION("name not defined", 32, 201, 193, 12, 244, 46, 118, 86, 55) // name not defined
+TRANSLATION("name reused for argument", 48, 201, 193, 16, 115, 38, 227, 103, 128, 145, 190, 120, 45, 64) // name reused for argument
+TRANSLATION("need more than %d values to unpack", 68, 196, 220, 112, 240, 69, 117, 70, 29, 46, 59, 166, 50, 100, 83, 140, 183, 41, 111, 160) // need more than %d values to unpack
+TRANSLATION("negative shift count", 40, 199, 116, 165, 238, 68, 245, 93, 168, 89, 242, 212) // negative shift count
+TRANSLATION("no active exception to reraise", 60, 206, 18, 212, 189, 200, 62, 108, 121, 165, 118, 20, 226, 12, 34, 201) // no active exception to reraise
+TRANSLATION("no binding for nonlocal found", 58, 206, 53, 86, 186, 182, 227, 103, 128, 206, 216, 123, 38, 6, 207, 150, 184) // no binding for nonlocal found
+TRANSLATION("no module named '%q'", 40, 206, 56, 123, 231, 4, 50, 112, 110, 52, 233, 219, 64) // no module named \'%q\'
+TRANSLATION("no such attribute", 34, 206, 39, 54, 234, 18, 170, 23, 92, 209) // no such attribute
+TRANSLATION("non-default argument follows default argument", 90, 206, 223, 23, 59, 38, 113, 65, 35, 124, 240, 90, 134, 207, 140, 63, 137, 23, 59, 38, 113, 65, 35, 124, 240, 90, 128) // non-default argument follows default argument
+TRANSLATION("non-hex digit found", 38, 206, 223, 29, 79, 145, 117, 221, 104, 108, 249, 107, 128) // non-hex digit found
+TRANSLATION("non-keyword arg after */**", 52, 206, 223, 31, 71, 215, 135, 139, 132, 141, 194, 109, 70, 7, 225, 248, 254, 31, 128) // non-keyword arg after */**
+TRANSLATION("non-keyword arg after keyword arg", 66, 206, 223, 31, 71, 215, 135, 139, 132, 141, 194, 109, 70, 7, 209, 245, 225, 226, 225, 35, 112) // non-keyword arg after keyword arg
+TRANSLATION("not all arguments converted during string formatting", 104, 207, 65, 49, 128, 145, 190, 120, 45, 82, 44, 237, 220, 197, 27, 139, 230, 21, 183, 19, 80, 173, 184, 217, 227, 132, 170, 86, 220) // not all arguments converted during string formatting
+TRANSLATION("not enough arguments for format string", 76, 207, 64, 179, 231, 126, 161, 35, 124, 240, 90, 164, 108, 240, 54, 120, 225, 40, 77, 66, 182, 224) // not enough arguments for format string
+TRANSLATION("object '%q' is not a tuple or list", 68, 250, 252, 155, 80, 211, 167, 109, 2, 200, 103, 160, 130, 179, 206, 8, 120, 24, 89, 160) // object \'%q\' is not a tuple or list
+TRANSLATION("object does not support item assignment", 78, 250, 252, 155, 80, 187, 153, 12, 244, 39, 60, 242, 241, 65, 104, 240, 18, 101, 119, 110, 11, 80) // object does not support item assignment
+TRANSLATION("object does not support item deletion", 74, 250, 252, 155, 80, 187, 153, 12, 244, 39, 60, 242, 241, 65, 104, 240, 46, 112, 105, 93, 128) // object does not support item deletion
+TRANSLATION("object has no len", 34, 250, 252, 155, 80, 234, 146, 25, 198, 11, 0) // object has no len
+TRANSLATION("object is not subscriptable", 54, 250, 252, 155, 80, 89, 12, 244, 39, 58, 205, 161, 121, 164, 215, 4) // object is not subscriptable
+TRANSLATION("object not an iterator", 44, 250, 252, 155, 80, 103, 160, 140, 22, 140, 37, 60, 0) // object not an iterator
+TRANSLATION("object not callable", 38, 250, 252, 155, 80, 103, 161, 100, 198, 19, 92, 16) // object not callable
+TRANSLATION("object not in sequence", 44, 250, 252, 155, 80, 103, 160, 172, 36, 246, 201, 107, 16) // object not in sequence
+TRANSLATION("object not iterable", 38, 250, 252, 155, 80, 103, 160, 180, 97, 53, 193) // object not iterable
+TRANSLATION("object of type '%q' has no len()", 64, 250, 252, 155, 80, 125, 133, 122, 228, 141, 58, 118, 208, 117, 73, 12, 227, 5, 189, 189, 192) // object of type \'%q\' has no len()
+TRANSLATION("object with buffer protocol required", 72, 250, 252, 155, 80, 240, 181, 212, 107, 157, 182, 48, 57, 135, 167, 179, 224, 65, 237, 149, 131, 112) // object with buffer protocol required
+TRANSLATION("odd-length string", 34, 247, 191, 198, 11, 111, 93, 68, 212, 43, 110) // odd-length string
+TRANSLATION("offset out of bounds", 40, 251, 109, 38, 131, 230, 131, 236, 53, 124, 181, 228) // offset out of bounds
+TRANSLATION("only slices with step=1 (aka None) are supported", 96, 237, 143, 66, 112, 182, 50, 60, 45, 117, 19, 71, 159, 227, 249, 143, 100, 250, 65, 250, 187, 31, 112, 144, 68, 231, 158, 94, 40, 220) // only slices with step=1 (aka None) are supported
+TRANSLATION("ord expects a character", 46, 241, 112, 124, 242, 109, 82, 16, 91, 170, 66, 90, 140, 0) // ord expects a character
+TRANSLATION("ord() expected a character, but string of length %d found", 114, 241, 127, 111, 112, 124, 242, 109, 70, 225, 5, 186, 164, 37, 168, 199, 216, 107, 154, 19, 80, 173, 184, 125, 134, 11, 111, 93, 71, 75, 141, 159, 45, 112) // ord() expected a character, but string of length %d found
+TRANSLATION("overflow converting long int to machine word", 88, 253, 204, 109, 135, 240, 44, 237, 220, 197, 43, 110, 48, 237, 184, 86, 161, 78, 56, 75, 117, 86, 35, 195, 197, 192) // overflow converting long int to machine word
+TRANSLATION("pop from empty %q", 35, 203, 242, 54, 135, 224, 30, 57, 175, 67, 167, 96) // pop from empty %q
+TRANSLATION("raw f-strings are not implemented", 67, 9, 224, 109, 241, 53, 10, 219, 200, 72, 33, 158, 130, 241, 206, 15, 5, 168, 220) // raw f-strings are not implemented
+TRANSLATION("requested length %d but object has length %d", 89, 7, 182, 76, 209, 184, 193, 109, 235, 168, 233, 113, 174, 104, 62, 191, 38, 212, 58, 164, 140, 22, 222, 186, 142, 151) // requested length %d but object has length %d
+TRANSLATION("rsplit(None,n)", 29, 19, 206, 22, 189, 191, 87, 99, 246, 111, 112) // rsplit(None,n)
+TRANSLATION("sign not allowed in string format specifier", 87, 43, 187, 6, 122, 9, 140, 63, 131, 112, 172, 38, 161, 91, 113, 179, 199, 9, 66, 121, 54, 93, 148, 192) // sign not allowed in string format specifier
+TRANSLATION("sign not allowed with integer format specifier 'c'", 101, 43, 187, 6, 122, 9, 140, 63, 131, 113, 225, 107, 168, 86, 163, 185, 129, 179, 199, 9, 66, 121, 54, 93, 148, 192, 210, 218, 0) // sign not allowed with integer format specifier \'c\'
+TRANSLATION("single '}' encountered in format string", 79, 42, 219, 224, 141, 63, 190, 128, 181, 159, 45, 70, 13, 194, 176, 217, 227, 132, 161, 53, 10, 219, 128) // single \'}\' encountered in format string
+TRANSLATION("slice step cannot be zero", 51, 56, 91, 17, 52, 121, 22, 70, 103, 161, 169, 31, 216, 195, 128) // slice step cannot be zero
+TRANSLATION("small int overflow", 37, 60, 38, 48, 21, 168, 63, 115, 27, 97, 252, 0) // small int overflow
+TRANSLATION("start/end indices", 35, 52, 145, 95, 137, 107, 133, 107, 173, 140, 128) // start/end indices
+TRANSLATION("stream operation not supported", 61, 53, 5, 56, 15, 201, 132, 165, 118, 12, 244, 39, 60, 242, 241, 70, 224) // stream operation not supported
+TRANSLATION("string indices must be integers, not %q", 79, 53, 10, 219, 133, 107, 173, 140, 142, 51, 52, 53, 33, 90, 142, 230, 39, 236, 25, 232, 116, 236) // string indices must be integers, not %q
+TRANSLATION("string not supported; use bytes or bytearray", 89, 53, 10, 219, 134, 122, 19, 158, 121, 120, 163, 127, 243, 25, 146, 53, 245, 70, 67, 192, 215, 213, 20, 136, 79, 64) // string not supported; use bytes or bytearray
+TRANSLATION("substring not found", 39, 57, 214, 106, 21, 183, 12, 244, 54, 124, 181, 192) // substring not found
+TRANSLATION("super() can't find self", 47, 57, 228, 199, 183, 184, 178, 54, 148, 54, 86, 184, 147, 141, 128) // super() can\'t find self
+TRANSLATION("too many values to unpack (expected %d)", 79, 78, 227, 132, 111, 67, 186, 99, 38, 69, 56, 203, 114, 150, 250, 30, 199, 207, 38, 212, 110, 58, 95, 220) // too many values to unpack (expected %d)
+TRANSLATION("tuple/list has wrong length", 55, 89, 231, 7, 241, 194, 205, 14, 169, 35, 196, 59, 110, 48, 91, 122, 234) // tuple/list has wrong length
+TRANSLATION("type '%q' is not an acceptable base type", 81, 94, 185, 35, 78, 157, 180, 11, 33, 158, 130, 48, 75, 88, 243, 73, 174, 8, 213, 36, 138, 245, 201) // type \'%q\' is not an acceptable base type
+TRANSLATION("type is not an acceptable base type", 71, 94, 185, 33, 100, 51, 208, 70, 9, 107, 30, 105, 53, 193, 26, 164, 145, 94, 185, 32) // type is not an acceptable base type
+TRANSLATION("type object '%q' has no attribute '%q'", 77, 94, 185, 33, 245, 249, 54, 161, 167, 78, 218, 14, 169, 33, 156, 37, 84, 46, 185, 162, 52, 233, 219, 64) // type object \'%q\' has no attribute \'%q\'
+TRANSLATION("type takes 1 or 3 arguments", 55, 94, 185, 34, 147, 232, 200, 252, 195, 192, 254, 1, 35, 124, 240, 90, 164) // type takes 1 or 3 arguments
+TRANSLATION("unexpected indent", 35, 150, 62, 121, 54, 163, 112, 173, 114, 212) // unexpected indent
+TRANSLATION("unexpected keyword argument '%q'", 65, 150, 62, 121, 54, 163, 113, 244, 125, 120, 120, 184, 72, 223, 60, 22, 161, 167, 78, 218, 0) // unexpected keyword argument \'%q\'
+TRANSLATION("unicode name escapes", 41, 150, 91, 61, 200, 100, 224, 131, 54, 78, 76, 128) // unicode name escapes
+TRANSLATION("unindent does not match any outer indentation level", 103, 150, 86, 185, 106, 23, 115, 33, 158, 135, 9, 86, 234, 17, 189, 7, 205, 24, 10, 215, 45, 73, 74, 236, 48, 123, 156, 0) // unindent does not match any outer indentation level
+TRANSLATION("unknown conversion specifier %c", 63, 150, 250, 103, 240, 194, 206, 221, 204, 74, 187, 9, 228, 217, 118, 83, 3, 165, 128) // unknown conversion specifier %c
+TRANSLATION("unknown format code '%c' for object of type '%q'", 97, 150, 250, 103, 240, 195, 103, 142, 18, 133, 158, 228, 105, 210, 218, 13, 158, 3, 235, 242, 109, 65, 246, 21, 235, 146, 52, 233, 219, 64) // unknown format code \'%c\' for object of type \'%q\'
+TRANSLATION("unmatched '{' in format", 47, 150, 225, 42, 221, 77, 198, 159, 255, 160, 86, 27, 60, 112, 148) // unmatched \'{\' in format
+TRANSLATION("unreadable attribute", 41, 150, 130, 151, 77, 112, 66, 85, 66, 235, 154, 32) // unreadable attribute
+TRANSLATION("unsupported format character '%c' (0x%x) at index %d", 105, 150, 156, 243, 203, 197, 27, 141, 158, 56, 74, 22, 234, 144, 150, 163, 3, 78, 150, 208, 123, 126, 94, 122, 121, 247, 9, 65, 90, 231, 200, 233, 112) // unsupported format character \'%c\' (0x%x) at index %d
+TRANSLATION("unsupported type for %q: '%q'", 59, 150, 156, 243, 203, 197, 27, 138, 245, 201, 27, 60, 14, 157, 191, 65, 167, 78, 218, 0) // unsupported type for %q: \'%q\'
+TRANSLATION("unsupported type for operator", 59, 150, 156, 243, 203, 197, 27, 138, 245, 201, 27, 60, 7, 228, 194, 83, 192) // unsupported type for operator
+TRANSLATION("unsupported types for %q: '%q', '%q'", 73, 150, 156, 243, 203, 197, 27, 138, 245, 201, 145, 179, 192, 233, 219, 244, 26, 116, 237, 167, 216, 105, 211, 182, 128) // unsupported types for %q: \'%q\', \'%q\'
+TRANSLATION("value must fit in %d byte(s)", 57, 221, 49, 146, 56, 204, 208, 217, 104, 43, 14, 151, 26, 250, 163, 237, 62, 224) // value must fit in %d byte(s)
+TRANSLATION("wrong number of arguments", 51, 226, 29, 183, 13, 158, 53, 48, 31, 96, 145, 190, 120, 45, 82) // wrong number of arguments
+TRANSLATION("wrong number of values to unpack", 65, 226, 29, 183, 13, 158, 53, 48, 31, 97, 221, 49, 147, 34, 156, 101, 185, 75, 125, 0) // wrong number of values to unpack
+TRANSLATION("zero step", 19, 253, 140, 56, 154, 60, 128) // zero step
+
+// 2125 bytes worth of qstr
+// 6393 bytes worth of translations
+// 3906 bytes worth of translations compressed
+// 2487 bytes saved
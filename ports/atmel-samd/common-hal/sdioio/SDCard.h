@@ -28,6 +28,8 @@
 
 #include "hal_mci_sync.h"
 
+#include "shared-module/sdioio/BlockCache.h"
+
 typedef struct {
     mp_obj_base_t base;
     struct mci_sync_desc IO_BUS;
@@ -37,4 +39,5 @@ typedef struct {
     uint8_t command_pin;
     uint8_t clock_pin;
     uint8_t data_pins[4];
+    sdioio_block_cache_t cache;
 } sdioio_sdcard_obj_t;
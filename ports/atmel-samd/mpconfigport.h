@@ -77,6 +77,7 @@
 #define MICROPY_PY_SYS_PLATFORM                     "MicroChip SAME54"
 #endif
 #define SPI_FLASH_MAX_BAUDRATE 24000000
+#define CIRCUITPY_USB_MSC_WRITE_CACHE_BLOCKS        (8)
 #define MICROPY_PY_BUILTINS_NOTIMPLEMENTED          (1)
 #define MICROPY_PY_COLLECTIONS_ORDEREDDICT          (1)
 #define MICROPY_PY_FUNCTION_ATTRS                   (1)
@@ -88,6 +88,11 @@ endif
 
 endif # samd51
 
+# Internal flash is memory mapped, so .mpy files on it can run in place.
+ifeq ($(INTERNAL_FLASH_FILESYSTEM),1)
+CIRCUITPY_PERSISTENT_CODE_XIP ?= $(CIRCUITPY_FULL_BUILD)
+endif
+
 INTERNAL_LIBM = 1
 
 USB_SERIAL_NUMBER_LENGTH = 32
@@ -32,6 +32,7 @@
 #include "py/obj.h"
 
 #include "common-hal/microcontroller/Pin.h"
+#include "shared-module/sdioio/BlockCache.h"
 
 typedef struct {
     mp_obj_base_t base;
@@ -42,6 +43,7 @@ typedef struct {
     const mcu_pin_obj_t *command_pin;
     const mcu_pin_obj_t *clock_pin;
     const mcu_pin_obj_t *data_pins[4];
+    sdioio_block_cache_t cache;
 } sdioio_sdcard_obj_t;
 
 #endif // MICROPY_INCLUDED_CXD56_SDIOIO_SDCARD_H
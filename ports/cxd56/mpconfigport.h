@@ -32,6 +32,8 @@
 // 64kiB stack
 #define CIRCUITPY_DEFAULT_STACK_SIZE            0x10000
 
+#define CIRCUITPY_USB_MSC_WRITE_CACHE_BLOCKS    (16)
+
 #include "py/circuitpy_mpconfig.h"
 
 #define MICROPY_PORT_ROOT_POINTERS \
@@ -33,6 +33,7 @@
 
 #define MICROPY_PY_UJSON            (0)
 #define MICROPY_USE_INTERNAL_PRINTF      (0)
+#define CIRCUITPY_USB_MSC_WRITE_CACHE_BLOCKS (16)
 
 #include "py/circuitpy_mpconfig.h"
 
@@ -45,6 +45,7 @@ extern uint8_t _ld_default_stack_size;
 #define MICROPY_PY_IO                               (1)
 #define MICROPY_PY_UJSON                            (1)
 #define MICROPY_PY_REVERSE_SPECIAL_METHODS          (1)
+#define CIRCUITPY_USB_MSC_WRITE_CACHE_BLOCKS        (16)
 
 
 #define CIRCUITPY_INTERNAL_FLASH_FILESYSTEM_START_ADDR ((uint32_t) &_ld_filesystem_start)
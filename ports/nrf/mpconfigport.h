@@ -52,6 +52,7 @@
 // Special RAM area for SPIM3 transmit buffer, to work around hardware bug.
 // See common.template.ld.
 #define SPIM3_BUFFER_RAM_SIZE       (8*1024)     // 8 KiB
+#define CIRCUITPY_USB_MSC_WRITE_CACHE_BLOCKS (8)
 #endif
 
 #ifdef NRF52833
@@ -39,6 +39,11 @@ CIRCUITPY_FRAMEBUFFERIO ?= 1
 CIRCUITPY_COUNTIO = 0
 CIRCUITPY_WATCHDOG ?= 1
 
+# Internal flash is memory mapped, so .mpy files on it can run in place.
+ifeq ($(INTERNAL_FLASH_FILESYSTEM),1)
+CIRCUITPY_PERSISTENT_CODE_XIP ?= $(CIRCUITPY_FULL_BUILD)
+endif
+
 # nRF52840-specific
 
 ifeq ($(MCU_CHIP),nrf52840)
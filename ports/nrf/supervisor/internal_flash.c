@@ -87,6 +87,13 @@ mp_uint_t supervisor_flash_read_blocks(uint8_t *dest, uint32_t block, uint32_t n
     return 0; // success
 }
 
+const uint8_t *supervisor_flash_get_block_address(uint32_t block) {
+    if (block >= supervisor_flash_get_block_count()) {
+        return NULL;
+    }
+    return (const uint8_t*) lba2addr(block);
+}
+
 mp_uint_t supervisor_flash_write_blocks(const uint8_t *src, uint32_t lba, uint32_t num_blocks) {
     while (num_blocks) {
         uint32_t const addr      = lba2addr(lba);
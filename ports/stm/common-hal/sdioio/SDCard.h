@@ -28,6 +28,7 @@
 #define MICROPY_INCLUDED_STM32_COMMON_HAL_BUSIO_SDIO_H
 
 #include "common-hal/microcontroller/Pin.h"
+#include "shared-module/sdioio/BlockCache.h"
 
 #include "peripherals/periph.h"
 
@@ -43,6 +44,7 @@ typedef struct {
     const mcu_periph_obj_t *data[4];
     uint32_t frequency;
     uint32_t capacity;
+    sdioio_block_cache_t cache;
 } sdioio_sdcard_obj_t;
 
 void sdioio_reset(void);
@@ -3,6 +3,11 @@ LONGINT_IMPL ?= MPZ
 INTERNAL_LIBM ?= 1
 USB_SERIAL_NUMBER_LENGTH ?= 24
 
+# Internal flash is memory mapped, so .mpy files on it can run in place.
+ifeq ($(INTERNAL_FLASH_FILESYSTEM),1)
+	CIRCUITPY_PERSISTENT_CODE_XIP ?= $(CIRCUITPY_FULL_BUILD)
+endif
+
 ifeq ($(MCU_VARIANT),STM32F405xx)
 	CIRCUITPY_FRAMEBUFFERIO ?= 1
 	CIRCUITPY_RGBMATRIX ?= 1
@@ -0,0 +1,3 @@
+const uint8_t lengths[] = { 0, 0, 1, 8, 6, 7, 4, 5, 5, 10, 8, 8, 16, 0 };
+const uint8_t values[] = { 32, 97, 101, 105, 110, 111, 114, 115, 116, 99, 100, 108, 109, 112, 117, 37, 39, 98, 102, 103, 113, 121, 104, 118, 119, 120, 40, 41, 45, 106, 107, 44, 46, 47, 58, 95, 10, 13, 42, 48, 49, 67, 73, 78, 80, 122, 34, 50, 51, 61, 69, 76, 83, 125, 35, 70, 74, 79, 84, 85, 96, 123, 33, 52, 54, 56, 59, 60, 62, 65, 66, 71, 72, 82, 86, 87, 91, 93 };
+#define compress_max_length_bits (8)
@@ -0,0 +1,1044 @@
+// 32   1012 000 0
+// 97 a 423 0010 2
+// 101 e 730 0011 3
+// 105 i 420 0100 4
+// 110 n 545 0101 5
+// 111 o 504 0110 6
+// 114 r 414 0111 7
+// 115 s 373 1000 8
+// 116 t 644 1001 9
+// 99 c 265 10100 20
+// 100 d 241 10101 21
+// 108 l 241 10110 22
+// 109 m 184 10111 23
+// 112 p 187 11000 24
+// 117 u 259 11001 25
+// 37 % 93 110100 52
+// 39 \' 161 110101 53
+// 98 b 130 110110 54
+// 102 f 149 110111 55
+// 103 g 147 111000 56
+// 113 q 81 111001 57
+// 121 y 100 111010 58
+// 104 h 73 1110110 118
+// 118 v 53 1110111 119
+// 119 w 58 1111000 120
+// 120 x 55 1111001 121
+// 40 ( 25 11110100 244
+// 41 ) 25 11110101 245
+// 45 - 25 11110110 246
+// 106 j 36 11110111 247
+// 107 k 35 11111000 248
+// 44 , 12 111110010 498
+// 46 . 14 111110011 499
+// 47 / 15 111110100 500
+// 58 : 11 111110101 501
+// 95 _ 16 111110110 502
+// 10 \n 8 1111101110 1006
+// 13 \r 8 1111101111 1007
+// 42 * 8 1111110000 1008
+// 48 0 10 1111110001 1009
+// 49 1 5 1111110010 1010
+// 67 C 6 1111110011 1011
+// 73 I 5 1111110100 1012
+// 78 N 9 1111110101 1013
+// 80 P 5 1111110110 1014
+// 122 z 5 1111110111 1015
+// 34 \" 4 11111110000 2032
+// 50 2 3 11111110001 2033
+// 51 3 4 11111110010 2034
+// 61 = 4 11111110011 2035
+// 69 E 3 11111110100 2036
+// 76 L 3 11111110101 2037
+// 83 S 4 11111110110 2038
+// 125 } 3 11111110111 2039
+// 35 # 2 111111110000 4080
+// 70 F 2 111111110001 4081
+// 74 J 1 111111110010 4082
+// 79 O 2 111111110011 4083
+// 84 T 2 111111110100 4084
+// 85 U 2 111111110101 4085
+// 96 ` 2 111111110110 4086
+// 123 { 1 111111110111 4087
+// 33 ! 1 1111111110000 8176
+// 52 4 1 1111111110001 8177
+// 54 6 1 1111111110010 8178
+// 56 8 1 1111111110011 8179
+// 59 ; 1 1111111110100 8180
+// 60 < 1 1111111110101 8181
+// 62 > 1 1111111110110 8182
+// 65 A 1 1111111110111 8183
+// 66 B 1 1111111111000 8184
+// 71 G 1 1111111111001 8185
+// 72 H 1 1111111111010 8186
+// 82 R 1 1111111111011 8187
+// 86 V 1 1111111111100 8188
+// 87 W 1 1111111111101 8189
+// 91 [ 1 1111111111110 8190
+// 93 ] 1 1111111111111 8191
+// length count {3: 1, 4: 8, 5: 6, 6: 7, 7: 4, 8: 5, 9: 5, 10: 10, 11: 8, 12: 8, 13: 16}
+// values [' ', 'a', 'e', 'i', 'n', 'o', 'r', 's', 't', 'c', 'd', 'l', 'm', 'p', 'u', '%', "'", 'b', 'f', 'g', 'q', 'y', 'h', 'v', 'w', 'x', '(', ')', '-', 'j', 'k', ',', '.', '/', ':', '_', '\n', '\r', '*', '0', '1', 'C', 'I', 'N', 'P', 'z', '"', '2', '3', '=', 'E', 'L', 'S', '}', '#', 'F', 'J', 'O', 'T', 'U', '`', '{', '!', '4', '6', '8', ';', '<', '>', 'A', 'B', 'G', 'H', 'R', 'V', 'W', '[', ']'] lengths 14 bytearray(b'\x00\x00\x01\x08\x06\x07\x04\x05\x05\n\x08\x08\x10\x00')
+// estimated total memory size 36296
+// [' ', 'a', 'e', 'i', 'n', 'o', 'r', 's', 't', 'c', 'd', 'l', 'm', 'p', 'u', '%', "'", 'b', 'f', 'g', 'q', 'y', 'h', 'v', 'w', 'x', '(', ')', '-', 'j', 'k', ',', '.', '/', ':', '_', '\n', '\r', '*', '0', '1', 'C', 'I', 'N', 'P', 'z', '"', '2', '3', '=', 'E', 'L', 'S', '}', '#', 'F', 'J', 'O', 'T', 'U', '`', '{', '!', '4', '6', '8', ';', '<', '>', 'A', 'B', 'G', 'H', 'R', 'V', 'W', '[', ']'] bytearray(b'\x00\x00\x01\x08\x06\x07\x04\x05\x05\n\x08\x08\x10\x00')
+// This file was automatically generated by makeqstrdata.py
+
+QDEF(MP_QSTR_NULL, (const byte*)"\x00\x00\x00" "")
+QDEF(MP_QSTR_, (const byte*)"\x05\x15\x00" "")
+QDEF(MP_QSTR___dir__, (const byte*)"\x7a\x8f\x07" "__dir__")
+QDEF(MP_QSTR___abs__, (const byte*)"\x95\xd6\x07" "__abs__")
+QDEF(MP_QSTR___add__, (const byte*)"\xc4\x82\x07" "__add__")
+QDEF(MP_QSTR___aenter__, (const byte*)"\x4c\x84\x0a" "__aenter__")
+QDEF(MP_QSTR___aexit__, (const byte*)"\xc4\xcf\x09" "__aexit__")
+QDEF(MP_QSTR___aiter__, (const byte*)"\x4e\x2b\x09" "__aiter__")
+QDEF(MP_QSTR___and__, (const byte*)"\x0e\xdb\x07" "__and__")
+QDEF(MP_QSTR___anext__, (const byte*)"\x83\xb4\x09" "__anext__")
+QDEF(MP_QSTR___bool__, (const byte*)"\x2b\x65\x08" "__bool__")
+QDEF(MP_QSTR___build_class__, (const byte*)"\x42\x88\x0f" "__build_class__")
+QDEF(MP_QSTR___bytes__, (const byte*)"\xdc\x81\x09" "__bytes__")
+QDEF(MP_QSTR___call__, (const byte*)"\xa7\xf9\x08" "__call__")
+QDEF(MP_QSTR___class__, (const byte*)"\x2b\xc5\x09" "__class__")
+QDEF(MP_QSTR___contains__, (const byte*)"\xc6\x5f\x0c" "__contains__")
+QDEF(MP_QSTR___del__, (const byte*)"\x68\x37\x07" "__del__")
+QDEF(MP_QSTR___delattr__, (const byte*)"\x5b\x77\x0b" "__delattr__")
+QDEF(MP_QSTR___delete__, (const byte*)"\xdc\xed\x0a" "__delete__")
+QDEF(MP_QSTR___delitem__, (const byte*)"\xfd\x35\x0b" "__delitem__")
+QDEF(MP_QSTR___dict__, (const byte*)"\x7f\x54\x08" "__dict__")
+QDEF(MP_QSTR___divmod__, (const byte*)"\x78\x11\x0a" "__divmod__")
+QDEF(MP_QSTR___enter__, (const byte*)"\x6d\xba\x09" "__enter__")
+QDEF(MP_QSTR___eq__, (const byte*)"\x71\x3e\x06" "__eq__")
+QDEF(MP_QSTR___exit__, (const byte*)"\x45\xf8\x08" "__exit__")
+QDEF(MP_QSTR___file__, (const byte*)"\x03\x54\x08" "__file__")
+QDEF(MP_QSTR___floordiv__, (const byte*)"\x46\x5f\x0c" "__floordiv__")
+QDEF(MP_QSTR___func__, (const byte*)"\x5b\xe8\x08" "__func__")
+QDEF(MP_QSTR___ge__, (const byte*)"\xa7\x46\x06" "__ge__")
+QDEF(MP_QSTR___get__, (const byte*)"\xb3\x8f\x07" "__get__")
+QDEF(MP_QSTR___getattr__, (const byte*)"\x40\xf8\x0b" "__getattr__")
+QDEF(MP_QSTR___getitem__, (const byte*)"\x26\x39\x0b" "__getitem__")
+QDEF(MP_QSTR___gt__, (const byte*)"\xb6\x82\x06" "__gt__")
+QDEF(MP_QSTR___hash__, (const byte*)"\xf7\xc8\x08" "__hash__")
+QDEF(MP_QSTR___iadd__, (const byte*)"\x6d\x4a\x08" "__iadd__")
+QDEF(MP_QSTR___import__, (const byte*)"\x38\x3e\x0a" "__import__")
+QDEF(MP_QSTR___init__, (const byte*)"\x5f\xa5\x08" "__init__")
+QDEF(MP_QSTR___invert__, (const byte*)"\xf7\x77\x0a" "__invert__")
+QDEF(MP_QSTR___isub__, (const byte*)"\x08\x78\x08" "__isub__")
+QDEF(MP_QSTR___iter__, (const byte*)"\xcf\x32\x08" "__iter__")
+QDEF(MP_QSTR___le__, (const byte*)"\xcc\x13\x06" "__le__")
+QDEF(MP_QSTR___len__, (const byte*)"\xe2\xb0\x07" "__len__")
+QDEF(MP_QSTR___lshift__, (const byte*)"\x09\x88\x0a" "__lshift__")
+QDEF(MP_QSTR___lt__, (const byte*)"\x5d\x68\x06" "__lt__")
+QDEF(MP_QSTR___main__, (const byte*)"\x8e\x13\x08" "__main__")
+QDEF(MP_QSTR___mod__, (const byte*)"\x63\x37\x07" "__mod__")
+QDEF(MP_QSTR___module__, (const byte*)"\xff\x30\x0a" "__module__")
+QDEF(MP_QSTR___mul__, (const byte*)"\x31\x42\x07" "__mul__")
+QDEF(MP_QSTR___name__, (const byte*)"\xe2\x38\x08" "__name__")
+QDEF(MP_QSTR___neg__, (const byte*)"\x69\xd5\x07" "__neg__")
+QDEF(MP_QSTR___new__, (const byte*)"\x79\x15\x07" "__new__")
+QDEF(MP_QSTR___next__, (const byte*)"\x02\x73\x08" "__next__")
+QDEF(MP_QSTR___or__, (const byte*)"\x38\xbb\x06" "__or__")
+QDEF(MP_QSTR___path__, (const byte*)"\xc8\x23\x08" "__path__")
+QDEF(MP_QSTR___pos__, (const byte*)"\x29\xf0\x07" "__pos__")
+QDEF(MP_QSTR___pow__, (const byte*)"\x2d\x00\x07" "__pow__")
+QDEF(MP_QSTR___qualname__, (const byte*)"\x6b\x00\x0c" "__qualname__")
+QDEF(MP_QSTR___radd__, (const byte*)"\x16\xc5\x08" "__radd__")
+QDEF(MP_QSTR___rand__, (const byte*)"\xdc\x2e\x08" "__rand__")
+QDEF(MP_QSTR___repl_print__, (const byte*)"\x00\xbb\x0e" "__repl_print__")
+QDEF(MP_QSTR___repr__, (const byte*)"\x10\x0b\x08" "__repr__")
+QDEF(MP_QSTR___reversed__, (const byte*)"\x61\xff\x0c" "__reversed__")
+QDEF(MP_QSTR___rfloordiv__, (const byte*)"\x54\x98\x0d" "__rfloordiv__")
+QDEF(MP_QSTR___rlshift__, (const byte*)"\x1b\xd1\x0b" "__rlshift__")
+QDEF(MP_QSTR___rmod__, (const byte*)"\x31\x8a\x08" "__rmod__")
+QDEF(MP_QSTR___rmul__, (const byte*)"\x63\x01\x08" "__rmul__")
+QDEF(MP_QSTR___ror__, (const byte*)"\x2a\xdc\x07" "__ror__")
+QDEF(MP_QSTR___rpow__, (const byte*)"\xff\x9a\x08" "__rpow__")
+QDEF(MP_QSTR___rrshift__, (const byte*)"\xc5\x9d\x0b" "__rrshift__")
+QDEF(MP_QSTR___rshift__, (const byte*)"\x57\x98\x0a" "__rshift__")
+QDEF(MP_QSTR___rsub__, (const byte*)"\x73\x77\x08" "__rsub__")
+QDEF(MP_QSTR___rtruediv__, (const byte*)"\x5a\xd7\x0c" "__rtruediv__")
+QDEF(MP_QSTR___rxor__, (const byte*)"\xf2\x86\x08" "__rxor__")
+QDEF(MP_QSTR___set__, (const byte*)"\xa7\xb3\x07" "__set__")
+QDEF(MP_QSTR___setattr__, (const byte*)"\x54\x19\x0b" "__setattr__")
+QDEF(MP_QSTR___setitem__, (const byte*)"\x32\x3e\x0b" "__setitem__")
+QDEF(MP_QSTR___sizeof__, (const byte*)"\x09\x3b\x0a" "__sizeof__")
+QDEF(MP_QSTR___str__, (const byte*)"\xd0\xcd\x07" "__str__")
+QDEF(MP_QSTR___sub__, (const byte*)"\x21\x09\x07" "__sub__")
+QDEF(MP_QSTR___traceback__, (const byte*)"\x4f\xcf\x0d" "__traceback__")
+QDEF(MP_QSTR___truediv__, (const byte*)"\x88\xef\x0b" "__truediv__")
+QDEF(MP_QSTR___xor__, (const byte*)"\x20\xec\x07" "__xor__")
+QDEF(MP_QSTR__star_, (const byte*)"\x8f\xb5\x01" "*")
+QDEF(MP_QSTR__, (const byte*)"\xfa\xb5\x01" "_")
+QDEF(MP_QSTR__slash_, (const byte*)"\x8a\xb5\x01" "/")
+QDEF(MP_QSTR__percent__hash_o, (const byte*)"\x6c\x1a\x03" "%#o")
+QDEF(MP_QSTR__percent__hash_x, (const byte*)"\x7b\x1a\x03" "%#x")
+QDEF(MP_QSTR__brace_open__colon__hash_b_brace_close_, (const byte*)"\x58\x37\x05" "{:#b}")
+QDEF(MP_QSTR__space_, (const byte*)"\x85\xb5\x01" " ")
+QDEF(MP_QSTR__0x0a_, (const byte*)"\xaf\xb5\x01" "\x0a")
+QDEF(MP_QSTR_maximum_space_recursion_space_depth_space_exceeded, (const byte*)"\x73\x1e\x20" "maximum recursion depth exceeded")
+QDEF(MP_QSTR__lt_module_gt_, (const byte*)"\xbd\x94\x08" "<module>")
+QDEF(MP_QSTR__lt_lambda_gt_, (const byte*)"\x80\x8c\x08" "<lambda>")
+QDEF(MP_QSTR__lt_listcomp_gt_, (const byte*)"\xd4\x15\x0a" "<listcomp>")
+QDEF(MP_QSTR__lt_dictcomp_gt_, (const byte*)"\xcc\x8d\x0a" "<dictcomp>")
+QDEF(MP_QSTR__lt_setcomp_gt_, (const byte*)"\x54\x51\x09" "<setcomp>")
+QDEF(MP_QSTR__lt_genexpr_gt_, (const byte*)"\x34\x6a\x09" "<genexpr>")
+QDEF(MP_QSTR__lt_string_gt_, (const byte*)"\x52\x53\x08" "<string>")
+QDEF(MP_QSTR__lt_stdin_gt_, (const byte*)"\xe3\x63\x07" "<stdin>")
+QDEF(MP_QSTR_utf_hyphen_8, (const byte*)"\xb7\x82\x05" "utf-8")
+QDEF(MP_QSTR__dot_frozen, (const byte*)"\x81\xf4\x07" ".frozen")
+QDEF(MP_QSTR_AF_INET, (const byte*)"\xeb\xb7\x07" "AF_INET")
+QDEF(MP_QSTR_AF_INET6, (const byte*)"\x7d\xb5\x08" "AF_INET6")
+QDEF(MP_QSTR_AF_UNIX, (const byte*)"\xf7\x01\x07" "AF_UNIX")
+QDEF(MP_QSTR_ARRAY, (const byte*)"\x5c\x7a\x05" "ARRAY")
+QDEF(MP_QSTR_ArithmeticError, (const byte*)"\x2d\x8c\x0f" "ArithmeticError")
+QDEF(MP_QSTR_AssertionError, (const byte*)"\x97\x5a\x0e" "AssertionError")
+QDEF(MP_QSTR_AttributeError, (const byte*)"\x21\xde\x0e" "AttributeError")
+QDEF(MP_QSTR_B115200, (const byte*)"\xa0\xf2\x07" "B115200")
+QDEF(MP_QSTR_B57600, (const byte*)"\x13\x9c\x06" "B57600")
+QDEF(MP_QSTR_B9600, (const byte*)"\x88\x9a\x05" "B9600")
+QDEF(MP_QSTR_BFINT16, (const byte*)"\x95\xe2\x07" "BFINT16")
+QDEF(MP_QSTR_BFINT32, (const byte*)"\x53\xe2\x07" "BFINT32")
+QDEF(MP_QSTR_BFINT8, (const byte*)"\x4a\x9a\x06" "BFINT8")
+QDEF(MP_QSTR_BFUINT16, (const byte*)"\x40\xa6\x08" "BFUINT16")
+QDEF(MP_QSTR_BFUINT32, (const byte*)"\x06\xa6\x08" "BFUINT32")
+QDEF(MP_QSTR_BFUINT8, (const byte*)"\xbf\xaf\x07" "BFUINT8")
+QDEF(MP_QSTR_BF_LEN, (const byte*)"\x19\xb0\x06" "BF_LEN")
+QDEF(MP_QSTR_BF_POS, (const byte*)"\x52\x9d\x06" "BF_POS")
+QDEF(MP_QSTR_BIG_ENDIAN, (const byte*)"\xff\x51\x0a" "BIG_ENDIAN")
+QDEF(MP_QSTR_BaseException, (const byte*)"\x07\x92\x0d" "BaseException")
+QDEF(MP_QSTR_BufferedWriter, (const byte*)"\xeb\x2c\x0e" "BufferedWriter")
+QDEF(MP_QSTR_BytesIO, (const byte*)"\x1a\xb7\x07" "BytesIO")
+QDEF(MP_QSTR_DEBUG, (const byte*)"\x34\x6d\x05" "DEBUG")
+QDEF(MP_QSTR_EACCES, (const byte*)"\x37\xc2\x06" "EACCES")
+QDEF(MP_QSTR_EADDRINUSE, (const byte*)"\x17\x11\x0a" "EADDRINUSE")
+QDEF(MP_QSTR_EAGAIN, (const byte*)"\x20\xec\x06" "EAGAIN")
+QDEF(MP_QSTR_EALREADY, (const byte*)"\x46\x15\x08" "EALREADY")
+QDEF(MP_QSTR_EBADF, (const byte*)"\x61\xa3\x05" "EBADF")
+QDEF(MP_QSTR_ECONNABORTED, (const byte*)"\x27\xab\x0c" "ECONNABORTED")
+QDEF(MP_QSTR_ECONNREFUSED, (const byte*)"\x3a\x2c\x0c" "ECONNREFUSED")
+QDEF(MP_QSTR_ECONNRESET, (const byte*)"\x19\xfb\x0a" "ECONNRESET")
+QDEF(MP_QSTR_EEXIST, (const byte*)"\x53\xad\x06" "EEXIST")
+QDEF(MP_QSTR_EHOSTUNREACH, (const byte*)"\x86\x25\x0c" "EHOSTUNREACH")
+QDEF(MP_QSTR_EINPROGRESS, (const byte*)"\x9a\xa0\x0b" "EINPROGRESS")
+QDEF(MP_QSTR_EINVAL, (const byte*)"\x5c\xff\x06" "EINVAL")
+QDEF(MP_QSTR_EIO, (const byte*)"\x86\xa6\x03" "EIO")
+QDEF(MP_QSTR_EISDIR, (const byte*)"\xa5\x4f\x06" "EISDIR")
+QDEF(MP_QSTR_ENOBUFS, (const byte*)"\xe3\x87\x07" "ENOBUFS")
+QDEF(MP_QSTR_ENODEV, (const byte*)"\xb6\x67\x06" "ENODEV")
+QDEF(MP_QSTR_ENOENT, (const byte*)"\x5e\x65\x06" "ENOENT")
+QDEF(MP_QSTR_ENOMEM, (const byte*)"\xa4\x85\x06" "ENOMEM")
+QDEF(MP_QSTR_ENOTCONN, (const byte*)"\x79\xd7\x08" "ENOTCONN")
+QDEF(MP_QSTR_EOFError, (const byte*)"\x91\xbf\x08" "EOFError")
+QDEF(MP_QSTR_EOPNOTSUPP, (const byte*)"\xac\x97\x0a" "EOPNOTSUPP")
+QDEF(MP_QSTR_EPERM, (const byte*)"\xea\x7f\x05" "EPERM")
+QDEF(MP_QSTR_ETIMEDOUT, (const byte*)"\xff\xf8\x09" "ETIMEDOUT")
+QDEF(MP_QSTR_Ellipsis, (const byte*)"\xf0\xe0\x08" "Ellipsis")
+QDEF(MP_QSTR_Exception, (const byte*)"\xf2\x29\x09" "Exception")
+QDEF(MP_QSTR_FLOAT32, (const byte*)"\xb4\x87\x07" "FLOAT32")
+QDEF(MP_QSTR_FLOAT64, (const byte*)"\x17\x87\x07" "FLOAT64")
+QDEF(MP_QSTR_FTLRamFlash, (const byte*)"\xf5\xdf\x0b" "FTLRamFlash")
+QDEF(MP_QSTR_FileIO, (const byte*)"\xc5\x15\x06" "FileIO")
+QDEF(MP_QSTR_FrameBuffer, (const byte*)"\xd8\xbe\x0b" "FrameBuffer")
+QDEF(MP_QSTR_FrameBuffer1, (const byte*)"\xe9\x99\x0c" "FrameBuffer1")
+QDEF(MP_QSTR_GS2_HMSB, (const byte*)"\x28\xc3\x08" "GS2_HMSB")
+QDEF(MP_QSTR_GS4_HMSB, (const byte*)"\x6e\x73\x08" "GS4_HMSB")
+QDEF(MP_QSTR_GS8, (const byte*)"\xa9\xc0\x03" "GS8")
+QDEF(MP_QSTR_GeneratorExit, (const byte*)"\x16\x62\x0d" "GeneratorExit")
+QDEF(MP_QSTR_INT16, (const byte*)"\x91\x76\x05" "INT16")
+QDEF(MP_QSTR_INT32, (const byte*)"\x57\x76\x05" "INT32")
+QDEF(MP_QSTR_INT64, (const byte*)"\xf4\x75\x05" "INT64")
+QDEF(MP_QSTR_INT8, (const byte*)"\xce\xbd\x04" "INT8")
+QDEF(MP_QSTR_IOBase, (const byte*)"\x36\xbe\x06" "IOBase")
+QDEF(MP_QSTR_ImportError, (const byte*)"\x20\x9c\x0b" "ImportError")
+QDEF(MP_QSTR_IndentationError, (const byte*)"\x5c\x20\x10" "IndentationError")
+QDEF(MP_QSTR_IndexError, (const byte*)"\x83\xad\x0a" "IndexError")
+QDEF(MP_QSTR_KeyError, (const byte*)"\xea\x00\x08" "KeyError")
+QDEF(MP_QSTR_KeyboardInterrupt, (const byte*)"\xaf\xe2\x11" "KeyboardInterrupt")
+QDEF(MP_QSTR_LITTLE_ENDIAN, (const byte*)"\xbf\x5b\x0d" "LITTLE_ENDIAN")
+QDEF(MP_QSTR_LockType, (const byte*)"\x36\x20\x08" "LockType")
+QDEF(MP_QSTR_LookupError, (const byte*)"\xff\x69\x0b" "LookupError")
+QDEF(MP_QSTR_MONO_HLSB, (const byte*)"\x4c\x98\x09" "MONO_HLSB")
+QDEF(MP_QSTR_MONO_HMSB, (const byte*)"\xcd\x83\x09" "MONO_HMSB")
+QDEF(MP_QSTR_MONO_VLSB, (const byte*)"\x12\xfc\x09" "MONO_VLSB")
+QDEF(MP_QSTR_MSG_DONTROUTE, (const byte*)"\xeb\x5d\x0d" "MSG_DONTROUTE")
+QDEF(MP_QSTR_MSG_DONTWAIT, (const byte*)"\x99\xc8\x0c" "MSG_DONTWAIT")
+QDEF(MP_QSTR_MVLSB, (const byte*)"\x03\x14\x05" "MVLSB")
+QDEF(MP_QSTR_MemoryError, (const byte*)"\xdc\x83\x0b" "MemoryError")
+QDEF(MP_QSTR_MpyError, (const byte*)"\x39\x7f\x08" "MpyError")
+QDEF(MP_QSTR_NATIVE, (const byte*)"\x04\x8e\x06" "NATIVE")
+QDEF(MP_QSTR_NaN, (const byte*)"\x24\xd8\x03" "NaN")
+QDEF(MP_QSTR_NameError, (const byte*)"\xba\x2d\x09" "NameError")
+QDEF(MP_QSTR_None, (const byte*)"\x6f\xd1\x04" "None")
+QDEF(MP_QSTR_NoneType, (const byte*)"\x17\x68\x08" "NoneType")
+QDEF(MP_QSTR_NotImplemented, (const byte*)"\x3e\xc6\x0e" "NotImplemented")
+QDEF(MP_QSTR_NotImplementedError, (const byte*)"\xc6\x98\x13" "NotImplementedError")
+QDEF(MP_QSTR_OSError, (const byte*)"\xa1\x65\x07" "OSError")
+QDEF(MP_QSTR_OrderedDict, (const byte*)"\xf0\x7e\x0b" "OrderedDict")
+QDEF(MP_QSTR_OverflowError, (const byte*)"\x81\xe1\x0d" "OverflowError")
+QDEF(MP_QSTR_POLLERR, (const byte*)"\xdf\xc0\x07" "POLLERR")
+QDEF(MP_QSTR_POLLHUP, (const byte*)"\x77\x8a\x07" "POLLHUP")
+QDEF(MP_QSTR_POLLIN, (const byte*)"\x7d\x61\x06" "POLLIN")
+QDEF(MP_QSTR_POLLOUT, (const byte*)"\x74\x85\x07" "POLLOUT")
+QDEF(MP_QSTR_PTR, (const byte*)"\xb3\x0c\x03" "PTR")
+QDEF(MP_QSTR_Parser, (const byte*)"\x42\x30\x06" "Parser")
+QDEF(MP_QSTR_PinBase, (const byte*)"\x47\x43\x07" "PinBase")
+QDEF(MP_QSTR_RGB565, (const byte*)"\x64\xcc\x06" "RGB565")
+QDEF(MP_QSTR_ReloadException, (const byte*)"\x03\xc2\x0f" "ReloadException")
+QDEF(MP_QSTR_RuntimeError, (const byte*)"\x61\xf1\x0c" "RuntimeError")
+QDEF(MP_QSTR_SOCK_DGRAM, (const byte*)"\xb3\x14\x0a" "SOCK_DGRAM")
+QDEF(MP_QSTR_SOCK_RAW, (const byte*)"\xca\x96\x08" "SOCK_RAW")
+QDEF(MP_QSTR_SOCK_STREAM, (const byte*)"\x32\xbe\x0b" "SOCK_STREAM")
+QDEF(MP_QSTR_SOL_SOCKET, (const byte*)"\x0f\xdf\x0a" "SOL_SOCKET")
+QDEF(MP_QSTR_SO_BROADCAST, (const byte*)"\xf9\xc6\x0c" "SO_BROADCAST")
+QDEF(MP_QSTR_SO_ERROR, (const byte*)"\x3e\x2a\x08" "SO_ERROR")
+QDEF(MP_QSTR_SO_KEEPALIVE, (const byte*)"\x2a\xa3\x0c" "SO_KEEPALIVE")
+QDEF(MP_QSTR_SO_LINGER, (const byte*)"\xfd\x90\x09" "SO_LINGER")
+QDEF(MP_QSTR_SO_REUSEADDR, (const byte*)"\x21\x53\x0c" "SO_REUSEADDR")
+QDEF(MP_QSTR_Signal, (const byte*)"\x9b\xe4\x06" "Signal")
+QDEF(MP_QSTR_SimSDCard, (const byte*)"\x71\x9c\x09" "SimSDCard")
+QDEF(MP_QSTR_StopAsyncIteration, (const byte*)"\xec\xf0\x12" "StopAsyncIteration")
+QDEF(MP_QSTR_StopIteration, (const byte*)"\xea\x1c\x0d" "StopIteration")
+QDEF(MP_QSTR_StringIO, (const byte*)"\x76\x76\x08" "StringIO")
+QDEF(MP_QSTR_SyntaxError, (const byte*)"\x94\x8f\x0b" "SyntaxError")
+QDEF(MP_QSTR_SystemExit, (const byte*)"\x20\xff\x0a" "SystemExit")
+QDEF(MP_QSTR_TCSANOW, (const byte*)"\x56\x25\x07" "TCSANOW")
+QDEF(MP_QSTR_TextIOWrapper, (const byte*)"\xad\x8d\x0d" "TextIOWrapper")
+QDEF(MP_QSTR_TimeoutError, (const byte*)"\x66\x4b\x0c" "TimeoutError")
+QDEF(MP_QSTR_TypeError, (const byte*)"\x25\x96\x09" "TypeError")
+QDEF(MP_QSTR_UINT16, (const byte*)"\xc4\x17\x06" "UINT16")
+QDEF(MP_QSTR_UINT32, (const byte*)"\x82\x17\x06" "UINT32")
+QDEF(MP_QSTR_UINT64, (const byte*)"\x61\x18\x06" "UINT64")
+QDEF(MP_QSTR_UINT8, (const byte*)"\xbb\xe1\x05" "UINT8")
+QDEF(MP_QSTR_UnicodeError, (const byte*)"\x22\xd1\x0c" "UnicodeError")
+QDEF(MP_QSTR_VOID, (const byte*)"\x31\xf2\x04" "VOID")
+QDEF(MP_QSTR_ValueError, (const byte*)"\x96\x87\x0a" "ValueError")
+QDEF(MP_QSTR_VfsFat, (const byte*)"\x15\x9b\x06" "VfsFat")
+QDEF(MP_QSTR_VfsPosix, (const byte*)"\xbb\x4e\x08" "VfsPosix")
+QDEF(MP_QSTR_ViperTypeError, (const byte*)"\xdd\x05\x0e" "ViperTypeError")
+QDEF(MP_QSTR_ZeroDivisionError, (const byte*)"\xb6\x27\x11" "ZeroDivisionError")
+QDEF(MP_QSTR__asdict, (const byte*)"\x32\x48\x07" "_asdict")
+QDEF(MP_QSTR__thread, (const byte*)"\xd4\x02\x07" "_thread")
+QDEF(MP_QSTR_a2b_base64, (const byte*)"\x3c\x0b\x0a" "a2b_base64")
+QDEF(MP_QSTR_abs, (const byte*)"\x95\x32\x03" "abs")
+QDEF(MP_QSTR_accept, (const byte*)"\x85\x89\x06" "accept")
+QDEF(MP_QSTR_acos, (const byte*)"\x1b\xa0\x04" "acos")
+QDEF(MP_QSTR_acosh, (const byte*)"\x13\xa3\x05" "acosh")
+QDEF(MP_QSTR_acquire, (const byte*)"\x1d\xd3\x07" "acquire")
+QDEF(MP_QSTR_add, (const byte*)"\x44\x32\x03" "add")
+QDEF(MP_QSTR_addressof, (const byte*)"\x5a\xf9\x09" "addressof")
+QDEF(MP_QSTR_all, (const byte*)"\x44\x33\x03" "all")
+QDEF(MP_QSTR_allocate_lock, (const byte*)"\xec\xed\x0d" "allocate_lock")
+QDEF(MP_QSTR_any, (const byte*)"\x13\x33\x03" "any")
+QDEF(MP_QSTR_append, (const byte*)"\x6b\x97\x06" "append")
+QDEF(MP_QSTR_args, (const byte*)"\xc2\xc6\x04" "args")
+QDEF(MP_QSTR_argv, (const byte*)"\xc7\xc6\x04" "argv")
+QDEF(MP_QSTR_array, (const byte*)"\x7c\x72\x05" "array")
+QDEF(MP_QSTR_asin, (const byte*)"\x50\xe5\x04" "asin")
+QDEF(MP_QSTR_asinh, (const byte*)"\x38\x8f\x05" "asinh")
+QDEF(MP_QSTR_atan, (const byte*)"\x1f\xbe\x04" "atan")
+QDEF(MP_QSTR_atan2, (const byte*)"\xcd\x81\x05" "atan2")
+QDEF(MP_QSTR_atanh, (const byte*)"\x97\x81\x05" "atanh")
+QDEF(MP_QSTR_b2a_base64, (const byte*)"\x3c\x8f\x0a" "b2a_base64")
+QDEF(MP_QSTR_bin, (const byte*)"\xe0\x48\x03" "bin")
+QDEF(MP_QSTR_binascii, (const byte*)"\x91\x3c\x08" "binascii")
+QDEF(MP_QSTR_bind, (const byte*)"\x84\x64\x04" "bind")
+QDEF(MP_QSTR_blit, (const byte*)"\xf6\x50\x04" "blit")
+QDEF(MP_QSTR_bool, (const byte*)"\xeb\x3c\x04" "bool")
+QDEF(MP_QSTR_boolean, (const byte*)"\x01\x11\x07" "boolean")
+QDEF(MP_QSTR_bound_method, (const byte*)"\x97\xa2\x0c" "bound_method")
+QDEF(MP_QSTR_buffering, (const byte*)"\x25\xdb\x09" "buffering")
+QDEF(MP_QSTR_bufsize, (const byte*)"\x51\xa0\x07" "bufsize")
+QDEF(MP_QSTR_builtins, (const byte*)"\xf7\x31\x08" "builtins")
+QDEF(MP_QSTR_bytearray, (const byte*)"\x76\xa3\x09" "bytearray")
+QDEF(MP_QSTR_bytearray_at, (const byte*)"\x9c\x5c\x0c" "bytearray_at")
+QDEF(MP_QSTR_bytecode, (const byte*)"\x22\x7d\x08" "bytecode")
+QDEF(MP_QSTR_byteorder, (const byte*)"\x61\x99\x09" "byteorder")
+QDEF(MP_QSTR_bytes, (const byte*)"\x5c\xb2\x05" "bytes")
+QDEF(MP_QSTR_bytes_at, (const byte*)"\xb6\x5d\x08" "bytes_at")
+QDEF(MP_QSTR_calcsize, (const byte*)"\x4d\x38\x08" "calcsize")
+QDEF(MP_QSTR_callable, (const byte*)"\x0d\x70\x08" "callable")
+QDEF(MP_QSTR_card, (const byte*)"\x31\xc2\x04" "card")
+QDEF(MP_QSTR_ceil, (const byte*)"\x06\xb0\x04" "ceil")
+QDEF(MP_QSTR_center, (const byte*)"\x4e\xbf\x06" "center")
+QDEF(MP_QSTR_chdir, (const byte*)"\xb1\xb2\x05" "chdir")
+QDEF(MP_QSTR_choice, (const byte*)"\x2e\x33\x06" "choice")
+QDEF(MP_QSTR_chr, (const byte*)"\xdc\x4c\x03" "chr")
+QDEF(MP_QSTR_circuitpython, (const byte*)"\x02\x3b\x0d" "circuitpython")
+QDEF(MP_QSTR_classmethod, (const byte*)"\xb4\x8c\x0b" "classmethod")
+QDEF(MP_QSTR_clear, (const byte*)"\x7c\xa0\x05" "clear")
+QDEF(MP_QSTR_clock, (const byte*)"\x2d\x65\x05" "clock")
+QDEF(MP_QSTR_close, (const byte*)"\x33\x67\x05" "close")
+QDEF(MP_QSTR_closure, (const byte*)"\x74\xca\x07" "closure")
+QDEF(MP_QSTR_cmath, (const byte*)"\xb6\xf4\x05" "cmath")
+QDEF(MP_QSTR_co_argcount, (const byte*)"\xa1\xae\x0b" "co_argcount")
+QDEF(MP_QSTR_co_cellvars, (const byte*)"\x66\xfa\x0b" "co_cellvars")
+QDEF(MP_QSTR_co_code, (const byte*)"\xfb\x51\x07" "co_code")
+QDEF(MP_QSTR_co_consts, (const byte*)"\xa0\x03\x09" "co_consts")
+QDEF(MP_QSTR_co_filename, (const byte*)"\x77\x1b\x0b" "co_filename")
+QDEF(MP_QSTR_co_firstlineno, (const byte*)"\x23\x5a\x0e" "co_firstlineno")
+QDEF(MP_QSTR_co_flags, (const byte*)"\x49\xa8\x08" "co_flags")
+QDEF(MP_QSTR_co_freevars, (const byte*)"\xf4\x4c\x0b" "co_freevars")
+QDEF(MP_QSTR_co_kwonlyargcount, (const byte*)"\xe9\x55\x11" "co_kwonlyargcount")
+QDEF(MP_QSTR_co_lnotab, (const byte*)"\x0c\xbc\x09" "co_lnotab")
+QDEF(MP_QSTR_co_name, (const byte*)"\xb1\xb3\x07" "co_name")
+QDEF(MP_QSTR_co_names, (const byte*)"\xa2\x29\x08" "co_names")
+QDEF(MP_QSTR_co_nlocals, (const byte*)"\xc6\xdc\x0a" "co_nlocals")
+QDEF(MP_QSTR_co_stacksize, (const byte*)"\x7d\x1a\x0c" "co_stacksize")
+QDEF(MP_QSTR_co_varnames, (const byte*)"\x87\x79\x0b" "co_varnames")
+QDEF(MP_QSTR_code, (const byte*)"\x68\xda\x04" "code")
+QDEF(MP_QSTR_collect, (const byte*)"\x9b\x65\x07" "collect")
+QDEF(MP_QSTR_collections, (const byte*)"\xe0\xc8\x0b" "collections")
+QDEF(MP_QSTR_compile, (const byte*)"\xf4\xc9\x07" "compile")
+QDEF(MP_QSTR_complex, (const byte*)"\xc5\x9d\x07" "complex")
+QDEF(MP_QSTR_connect, (const byte*)"\xdb\x3d\x07" "connect")
+QDEF(MP_QSTR_const, (const byte*)"\xc0\xff\x05" "const")
+QDEF(MP_QSTR_copy, (const byte*)"\xe0\xdb\x04" "copy")
+QDEF(MP_QSTR_copysign, (const byte*)"\x33\x14\x08" "copysign")
+QDEF(MP_QSTR_cos, (const byte*)"\x7a\x4c\x03" "cos")
+QDEF(MP_QSTR_cosh, (const byte*)"\xd2\xdb\x04" "cosh")
+QDEF(MP_QSTR_count, (const byte*)"\xa6\x4d\x05" "count")
+QDEF(MP_QSTR_decode, (const byte*)"\xa9\x59\x06" "decode")
+QDEF(MP_QSTR_default, (const byte*)"\xce\x7d\x07" "default")
+QDEF(MP_QSTR_degrees, (const byte*)"\x02\x41\x07" "degrees")
+QDEF(MP_QSTR_delattr, (const byte*)"\xdb\xc8\x07" "delattr")
+QDEF(MP_QSTR_deleter, (const byte*)"\x6e\xdb\x07" "deleter")
+QDEF(MP_QSTR_depth, (const byte*)"\xe8\x7c\x05" "depth")
+QDEF(MP_QSTR_deque, (const byte*)"\x05\x99\x05" "deque")
+QDEF(MP_QSTR_dict, (const byte*)"\x3f\xfc\x04" "dict")
+QDEF(MP_QSTR_dict_view, (const byte*)"\x2d\xa9\x09" "dict_view")
+QDEF(MP_QSTR_difference, (const byte*)"\x72\x24\x0a" "difference")
+QDEF(MP_QSTR_difference_update, (const byte*)"\x9c\xfa\x11" "difference_update")
+QDEF(MP_QSTR_digest, (const byte*)"\xcd\xc4\x06" "digest")
+QDEF(MP_QSTR_dir, (const byte*)"\xfa\x1e\x03" "dir")
+QDEF(MP_QSTR_disable, (const byte*)"\x91\x76\x07" "disable")
+QDEF(MP_QSTR_discard, (const byte*)"\x0f\x71\x07" "discard")
+QDEF(MP_QSTR_divmod, (const byte*)"\xb8\x04\x06" "divmod")
+QDEF(MP_QSTR_doc, (const byte*)"\x2d\x1f\x03" "doc")
+QDEF(MP_QSTR_dump, (const byte*)"\xe9\x2f\x04" "dump")
+QDEF(MP_QSTR_dumps, (const byte*)"\x7a\x2d\x05" "dumps")
+QDEF(MP_QSTR_e, (const byte*)"\xc0\xb5\x01" "e")
+QDEF(MP_QSTR_enable, (const byte*)"\x04\xde\x06" "enable")
+QDEF(MP_QSTR_encode, (const byte*)"\x43\xca\x06" "encode")
+QDEF(MP_QSTR_encoding, (const byte*)"\x06\x9c\x08" "encoding")
+QDEF(MP_QSTR_end, (const byte*)"\x0a\x23\x03" "end")
+QDEF(MP_QSTR_end_array, (const byte*)"\x6c\xc7\x09" "end_array")
+QDEF(MP_QSTR_end_map, (const byte*)"\xa9\x18\x07" "end_map")
+QDEF(MP_QSTR_endswith, (const byte*)"\x1b\xa3\x08" "endswith")
+QDEF(MP_QSTR_enumerate, (const byte*)"\x71\xba\x09" "enumerate")
+QDEF(MP_QSTR_erf, (const byte*)"\x94\x23\x03" "erf")
+QDEF(MP_QSTR_erfc, (const byte*)"\x77\x96\x04" "erfc")
+QDEF(MP_QSTR_errno, (const byte*)"\xc1\x11\x05" "errno")
+QDEF(MP_QSTR_errorcode, (const byte*)"\x10\xdd\x09" "errorcode")
+QDEF(MP_QSTR_eval, (const byte*)"\x9b\xa6\x04" "eval")
+QDEF(MP_QSTR_exc_info, (const byte*)"\x0a\xff\x08" "exc_info")
+QDEF(MP_QSTR_exec, (const byte*)"\x1e\xc0\x04" "exec")
+QDEF(MP_QSTR_exit, (const byte*)"\x85\xbe\x04" "exit")
+QDEF(MP_QSTR_exp, (const byte*)"\xc8\x24\x03" "exp")
+QDEF(MP_QSTR_expm1, (const byte*)"\x74\x72\x05" "expm1")
+QDEF(MP_QSTR_extend, (const byte*)"\x63\xe8\x06" "extend")
+QDEF(MP_QSTR_f_back, (const byte*)"\x97\x48\x06" "f_back")
+QDEF(MP_QSTR_f_builtins, (const byte*)"\x8e\x92\x0a" "f_builtins")
+QDEF(MP_QSTR_f_code, (const byte*)"\x91\x81\x06" "f_code")
+QDEF(MP_QSTR_f_globals, (const byte*)"\x44\x1c\x09" "f_globals")
+QDEF(MP_QSTR_f_lasti, (const byte*)"\xff\x15\x07" "f_lasti")
+QDEF(MP_QSTR_f_lineno, (const byte*)"\xf3\x27\x08" "f_lineno")
+QDEF(MP_QSTR_f_locals, (const byte*)"\xc2\x24\x08" "f_locals")
+QDEF(MP_QSTR_f_trace, (const byte*)"\xbd\xd4\x07" "f_trace")
+QDEF(MP_QSTR_fabs, (const byte*)"\x93\x12\x04" "fabs")
+QDEF(MP_QSTR_fail_after, (const byte*)"\x1c\x36\x0a" "fail_after")
+QDEF(MP_QSTR_file, (const byte*)"\xc3\x34\x04" "file")
+QDEF(MP_QSTR_filename, (const byte*)"\xe4\x54\x08" "filename")
+QDEF(MP_QSTR_filename2, (const byte*)"\x56\xf1\x09" "filename2")
+QDEF(MP_QSTR_fileno, (const byte*)"\x82\x76\x06" "fileno")
+QDEF(MP_QSTR_fill, (const byte*)"\xca\x34\x04" "fill")
+QDEF(MP_QSTR_fill_rect, (const byte*)"\x35\xed\x09" "fill_rect")
+QDEF(MP_QSTR_filter, (const byte*)"\x25\xbe\x06" "filter")
+QDEF(MP_QSTR_find, (const byte*)"\x00\x34\x04" "find")
+QDEF(MP_QSTR_float, (const byte*)"\x35\x44\x05" "float")
+QDEF(MP_QSTR_floor, (const byte*)"\x7d\x46\x05" "floor")
+QDEF(MP_QSTR_flush, (const byte*)"\x61\xc1\x05" "flush")
+QDEF(MP_QSTR_fmod, (const byte*)"\xe5\x44\x04" "fmod")
+QDEF(MP_QSTR_format, (const byte*)"\x26\x33\x06" "format")
+QDEF(MP_QSTR_frame, (const byte*)"\x78\x8a\x05" "frame")
+QDEF(MP_QSTR_framebuf, (const byte*)"\x69\x82\x08" "framebuf")
+QDEF(MP_QSTR_frexp, (const byte*)"\x1c\x98\x05" "frexp")
+QDEF(MP_QSTR_from_bytes, (const byte*)"\x35\x74\x0a" "from_bytes")
+QDEF(MP_QSTR_fromkeys, (const byte*)"\x37\xbd\x08" "fromkeys")
+QDEF(MP_QSTR_frozenset, (const byte*)"\xed\x9c\x09" "frozenset")
+QDEF(MP_QSTR_function, (const byte*)"\x27\x02\x08" "function")
+QDEF(MP_QSTR_gamma, (const byte*)"\x02\x90\x05" "gamma")
+QDEF(MP_QSTR_gc, (const byte*)"\x61\x6e\x02" "gc")
+QDEF(MP_QSTR_generator, (const byte*)"\x96\xc3\x09" "generator")
+QDEF(MP_QSTR_get, (const byte*)"\x33\x3b\x03" "get")
+QDEF(MP_QSTR_get_ident, (const byte*)"\xfe\xb1\x09" "get_ident")
+QDEF(MP_QSTR_getaddrinfo, (const byte*)"\x6e\x18\x0b" "getaddrinfo")
+QDEF(MP_QSTR_getattr, (const byte*)"\xc0\x17\x07" "getattr")
+QDEF(MP_QSTR_getcwd, (const byte*)"\x03\xd0\x06" "getcwd")
+QDEF(MP_QSTR_getenv, (const byte*)"\xae\xfb\x06" "getenv")
+QDEF(MP_QSTR_getrandbits, (const byte*)"\x66\x7d\x0b" "getrandbits")
+QDEF(MP_QSTR_getsizeof, (const byte*)"\xff\x23\x09" "getsizeof")
+QDEF(MP_QSTR_getter, (const byte*)"\x90\xb2\x06" "getter")
+QDEF(MP_QSTR_getvalue, (const byte*)"\x78\xac\x08" "getvalue")
+QDEF(MP_QSTR_globals, (const byte*)"\x9d\x49\x07" "globals")
+QDEF(MP_QSTR_group, (const byte*)"\xba\xb0\x05" "group")
+QDEF(MP_QSTR_hasattr, (const byte*)"\x8c\xb0\x07" "hasattr")
+QDEF(MP_QSTR_hash, (const byte*)"\xb7\x70\x04" "hash")
+QDEF(MP_QSTR_hashlib, (const byte*)"\x10\x6d\x07" "hashlib")
+QDEF(MP_QSTR_heap_lock, (const byte*)"\xad\x8c\x09" "heap_lock")
+QDEF(MP_QSTR_heap_unlock, (const byte*)"\x56\x2d\x0b" "heap_unlock")
+QDEF(MP_QSTR_heapify, (const byte*)"\xaf\x2d\x07" "heapify")
+QDEF(MP_QSTR_heappop, (const byte*)"\xd6\x27\x07" "heappop")
+QDEF(MP_QSTR_heappush, (const byte*)"\x87\x6b\x08" "heappush")
+QDEF(MP_QSTR_help, (const byte*)"\x94\x5c\x04" "help")
+QDEF(MP_QSTR_hex, (const byte*)"\x70\x50\x03" "hex")
+QDEF(MP_QSTR_hexlify, (const byte*)"\x2a\x7f\x07" "hexlify")
+QDEF(MP_QSTR_hline, (const byte*)"\x83\x3c\x05" "hline")
+QDEF(MP_QSTR_id, (const byte*)"\x28\x6f\x02" "id")
+QDEF(MP_QSTR_ilistdir, (const byte*)"\x71\x6a\x08" "ilistdir")
+QDEF(MP_QSTR_imag, (const byte*)"\x47\xb7\x04" "imag")
+QDEF(MP_QSTR_implementation, (const byte*)"\x17\x2d\x0e" "implementation")
+QDEF(MP_QSTR_index, (const byte*)"\x7b\x28\x05" "index")
+QDEF(MP_QSTR_indices, (const byte*)"\x5a\x48\x07" "indices")
+QDEF(MP_QSTR_inet_ntop, (const byte*)"\x89\x1d\x09" "inet_ntop")
+QDEF(MP_QSTR_inet_pton, (const byte*)"\xc9\x94\x09" "inet_pton")
+QDEF(MP_QSTR_inf, (const byte*)"\x04\x53\x03" "inf")
+QDEF(MP_QSTR_input, (const byte*)"\x73\x5a\x05" "input")
+QDEF(MP_QSTR_insert, (const byte*)"\x12\x54\x06" "insert")
+QDEF(MP_QSTR_int, (const byte*)"\x16\x53\x03" "int")
+QDEF(MP_QSTR_intersection, (const byte*)"\x28\x2a\x0c" "intersection")
+QDEF(MP_QSTR_intersection_update, (const byte*)"\x06\xdd\x13" "intersection_update")
+QDEF(MP_QSTR_invert, (const byte*)"\xb7\x00\x06" "invert")
+QDEF(MP_QSTR_ioctl, (const byte*)"\x78\xc2\x05" "ioctl")
+QDEF(MP_QSTR_ipoll, (const byte*)"\x53\x5d\x05" "ipoll")
+QDEF(MP_QSTR_isalpha, (const byte*)"\xeb\x37\x07" "isalpha")
+QDEF(MP_QSTR_isdigit, (const byte*)"\xa8\x9a\x07" "isdigit")
+QDEF(MP_QSTR_isdisjoint, (const byte*)"\xf7\x68\x0a" "isdisjoint")
+QDEF(MP_QSTR_isenabled, (const byte*)"\x9a\xe5\x09" "isenabled")
+QDEF(MP_QSTR_isfinite, (const byte*)"\xa6\xab\x08" "isfinite")
+QDEF(MP_QSTR_isinf, (const byte*)"\x3e\x11\x05" "isinf")
+QDEF(MP_QSTR_isinstance, (const byte*)"\xb6\xbe\x0a" "isinstance")
+QDEF(MP_QSTR_islower, (const byte*)"\xfc\x80\x07" "islower")
+QDEF(MP_QSTR_isnan, (const byte*)"\x9e\x03\x05" "isnan")
+QDEF(MP_QSTR_isspace, (const byte*)"\x5b\xf8\x07" "isspace")
+QDEF(MP_QSTR_issubclass, (const byte*)"\xb5\x7f\x0a" "issubclass")
+QDEF(MP_QSTR_issubset, (const byte*)"\xb9\xc1\x08" "issubset")
+QDEF(MP_QSTR_issuperset, (const byte*)"\xfc\xec\x0a" "issuperset")
+QDEF(MP_QSTR_isupper, (const byte*)"\xdd\xa7\x07" "isupper")
+QDEF(MP_QSTR_items, (const byte*)"\xe3\x53\x05" "items")
+QDEF(MP_QSTR_iter, (const byte*)"\x8f\x21\x04" "iter")
+QDEF(MP_QSTR_iterable, (const byte*)"\x25\x92\x08" "iterable")
+QDEF(MP_QSTR_iterator, (const byte*)"\x47\xbe\x08" "iterator")
+QDEF(MP_QSTR_join, (const byte*)"\xa7\x5c\x04" "join")
+QDEF(MP_QSTR_kbd_intr, (const byte*)"\xf6\x13\x08" "kbd_intr")
+QDEF(MP_QSTR_keepends, (const byte*)"\x62\x8b\x08" "keepends")
+QDEF(MP_QSTR_key, (const byte*)"\x32\x6d\x03" "key")
+QDEF(MP_QSTR_keys, (const byte*)"\x01\x13\x04" "keys")
+QDEF(MP_QSTR_label, (const byte*)"\x43\xe7\x05" "label")
+QDEF(MP_QSTR_ldexp, (const byte*)"\x40\x6f\x05" "ldexp")
+QDEF(MP_QSTR_len, (const byte*)"\x62\x40\x03" "len")
+QDEF(MP_QSTR_length, (const byte*)"\x59\x87\x06" "length")
+QDEF(MP_QSTR_lgamma, (const byte*)"\xce\x6c\x06" "lgamma")
+QDEF(MP_QSTR_line, (const byte*)"\xcb\x1c\x04" "line")
+QDEF(MP_QSTR_list, (const byte*)"\x27\x1d\x04" "list")
+QDEF(MP_QSTR_listdir, (const byte*)"\x98\xe3\x07" "listdir")
+QDEF(MP_QSTR_listen, (const byte*)"\xcc\x0e\x06" "listen")
+QDEF(MP_QSTR_little, (const byte*)"\x89\x6a\x06" "little")
+QDEF(MP_QSTR_load, (const byte*)"\x63\x24\x04" "load")
+QDEF(MP_QSTR_loads, (const byte*)"\xb0\xb0\x05" "loads")
+QDEF(MP_QSTR_locals, (const byte*)"\x3b\xa1\x06" "locals")
+QDEF(MP_QSTR_localtime, (const byte*)"\x7d\x46\x09" "localtime")
+QDEF(MP_QSTR_lock, (const byte*)"\xae\x23\x04" "lock")
+QDEF(MP_QSTR_locked, (const byte*)"\x0f\xba\x06" "locked")
+QDEF(MP_QSTR_log, (const byte*)"\x21\x3f\x03" "log")
+QDEF(MP_QSTR_log10, (const byte*)"\x40\x91\x05" "log10")
+QDEF(MP_QSTR_log2, (const byte*)"\x73\x23\x04" "log2")
+QDEF(MP_QSTR_lower, (const byte*)"\xc6\xcb\x05" "lower")
+QDEF(MP_QSTR_lstrip, (const byte*)"\xe5\xb9\x06" "lstrip")
+QDEF(MP_QSTR_makefile, (const byte*)"\xc1\xd5\x08" "makefile")
+QDEF(MP_QSTR_map, (const byte*)"\xb9\x43\x03" "map")
+QDEF(MP_QSTR_map_key, (const byte*)"\xd1\x85\x07" "map_key")
+QDEF(MP_QSTR_match, (const byte*)"\x96\x22\x05" "match")
+QDEF(MP_QSTR_math, (const byte*)"\x35\xbb\x04" "math")
+QDEF(MP_QSTR_max, (const byte*)"\xb1\x43\x03" "max")
+QDEF(MP_QSTR_maxsize, (const byte*)"\xd4\x70\x07" "maxsize")
+QDEF(MP_QSTR_mem, (const byte*)"\x20\x44\x03" "mem")
+QDEF(MP_QSTR_mem16, (const byte*)"\x07\xca\x05" "mem16")
+QDEF(MP_QSTR_mem32, (const byte*)"\x41\xca\x05" "mem32")
+QDEF(MP_QSTR_mem8, (const byte*)"\x18\xc8\x04" "mem8")
+QDEF(MP_QSTR_mem_alloc, (const byte*)"\x52\x2b\x09" "mem_alloc")
+QDEF(MP_QSTR_mem_current, (const byte*)"\x16\xba\x0b" "mem_current")
+QDEF(MP_QSTR_mem_free, (const byte*)"\xcb\x62\x08" "mem_free")
+QDEF(MP_QSTR_mem_info, (const byte*)"\xd1\xf1\x08" "mem_info")
+QDEF(MP_QSTR_mem_peak, (const byte*)"\x40\x25\x08" "mem_peak")
+QDEF(MP_QSTR_mem_total, (const byte*)"\xfd\x6a\x09" "mem_total")
+QDEF(MP_QSTR_memoryview, (const byte*)"\x69\x44\x0a" "memoryview")
+QDEF(MP_QSTR_micropython, (const byte*)"\x0b\x7c\x0b" "micropython")
+QDEF(MP_QSTR_min, (const byte*)"\xaf\x42\x03" "min")
+QDEF(MP_QSTR_mkdir, (const byte*)"\x9c\xb5\x05" "mkdir")
+QDEF(MP_QSTR_mkfs, (const byte*)"\x76\xb0\x04" "mkfs")
+QDEF(MP_QSTR_mode, (const byte*)"\x26\xc0\x04" "mode")
+QDEF(MP_QSTR_modf, (const byte*)"\x25\xc0\x04" "modf")
+QDEF(MP_QSTR_modify, (const byte*)"\xf5\x66\x06" "modify")
+QDEF(MP_QSTR_module, (const byte*)"\xbf\x99\x06" "module")
+QDEF(MP_QSTR_modules, (const byte*)"\xec\xd1\x07" "modules")
+QDEF(MP_QSTR_mount, (const byte*)"\xa8\x0d\x05" "mount")
+QDEF(MP_QSTR_name, (const byte*)"\xa2\x75\x04" "name")
+QDEF(MP_QSTR_namedtuple, (const byte*)"\x1e\x16\x0a" "namedtuple")
+QDEF(MP_QSTR_native, (const byte*)"\x84\x0b\x06" "native")
+QDEF(MP_QSTR_next, (const byte*)"\x42\x88\x04" "next")
+QDEF(MP_QSTR_null, (const byte*)"\xde\xc9\x04" "null")
+QDEF(MP_QSTR_number, (const byte*)"\x46\xf6\x06" "number")
+QDEF(MP_QSTR_object, (const byte*)"\x90\x8d\x06" "object")
+QDEF(MP_QSTR_oct, (const byte*)"\xfd\x5c\x03" "oct")
+QDEF(MP_QSTR_off, (const byte*)"\x8a\x5c\x03" "off")
+QDEF(MP_QSTR_on, (const byte*)"\x64\x6f\x02" "on")
+QDEF(MP_QSTR_open, (const byte*)"\xd1\x3a\x04" "open")
+QDEF(MP_QSTR_opt_level, (const byte*)"\x87\x67\x09" "opt_level")
+QDEF(MP_QSTR_ord, (const byte*)"\x1c\x5e\x03" "ord")
+QDEF(MP_QSTR_pack, (const byte*)"\xbc\xd1\x04" "pack")
+QDEF(MP_QSTR_pack_into, (const byte*)"\x1f\xa9\x09" "pack_into")
+QDEF(MP_QSTR_partition, (const byte*)"\x87\xe5\x09" "partition")
+QDEF(MP_QSTR_path, (const byte*)"\x88\xce\x04" "path")
+QDEF(MP_QSTR_peektime, (const byte*)"\x8b\x5c\x08" "peektime")
+QDEF(MP_QSTR_pend_throw, (const byte*)"\xf3\x74\x0a" "pend_throw")
+QDEF(MP_QSTR_phase, (const byte*)"\x6a\xd5\x05" "phase")
+QDEF(MP_QSTR_pi, (const byte*)"\x1c\x70\x02" "pi")
+QDEF(MP_QSTR_pixel, (const byte*)"\x4d\xf0\x05" "pixel")
+QDEF(MP_QSTR_platform, (const byte*)"\x3a\x19\x08" "platform")
+QDEF(MP_QSTR_polar, (const byte*)"\x05\x0c\x05" "polar")
+QDEF(MP_QSTR_poll, (const byte*)"\x9a\xd9\x04" "poll")
+QDEF(MP_QSTR_pop, (const byte*)"\x2a\x73\x03" "pop")
+QDEF(MP_QSTR_popitem, (const byte*)"\xbf\x2c\x07" "popitem")
+QDEF(MP_QSTR_popleft, (const byte*)"\x71\x9a\x07" "popleft")
+QDEF(MP_QSTR_pow, (const byte*)"\x2d\x73\x03" "pow")
+QDEF(MP_QSTR_print, (const byte*)"\x54\xc6\x05" "print")
+QDEF(MP_QSTR_print_exception, (const byte*)"\x1c\x22\x0f" "print_exception")
+QDEF(MP_QSTR_property, (const byte*)"\xc2\x29\x08" "property")
+QDEF(MP_QSTR_protocol_framebuf, (const byte*)"\xe0\x50\x11" "protocol_framebuf")
+QDEF(MP_QSTR_protocol_pin, (const byte*)"\x1b\x57\x0c" "protocol_pin")
+QDEF(MP_QSTR_protocol_stream, (const byte*)"\x90\x24\x0f" "protocol_stream")
+QDEF(MP_QSTR_protocol_vfs, (const byte*)"\xef\x3f\x0c" "protocol_vfs")
+QDEF(MP_QSTR_ptr, (const byte*)"\x53\x70\x03" "ptr")
+QDEF(MP_QSTR_ptr16, (const byte*)"\xf4\xca\x05" "ptr16")
+QDEF(MP_QSTR_ptr32, (const byte*)"\xb2\xca\x05" "ptr32")
+QDEF(MP_QSTR_ptr8, (const byte*)"\x8b\x7a\x04" "ptr8")
+QDEF(MP_QSTR_push, (const byte*)"\xbb\x7e\x04" "push")
+QDEF(MP_QSTR_qstr_info, (const byte*)"\xb0\x81\x09" "qstr_info")
+QDEF(MP_QSTR_r, (const byte*)"\xd7\xb5\x01" "r")
+QDEF(MP_QSTR_radians, (const byte*)"\x87\x3f\x07" "radians")
+QDEF(MP_QSTR_randint, (const byte*)"\xaf\xdc\x07" "randint")
+QDEF(MP_QSTR_random, (const byte*)"\xbe\x2c\x06" "random")
+QDEF(MP_QSTR_randrange, (const byte*)"\xa3\x3e\x09" "randrange")
+QDEF(MP_QSTR_range, (const byte*)"\x1a\x5e\x05" "range")
+QDEF(MP_QSTR_read, (const byte*)"\xb7\xf9\x04" "read")
+QDEF(MP_QSTR_read1, (const byte*)"\xa6\x30\x05" "read1")
+QDEF(MP_QSTR_readblocks, (const byte*)"\x2d\x1c\x0a" "readblocks")
+QDEF(MP_QSTR_readinto, (const byte*)"\x4b\xbf\x08" "readinto")
+QDEF(MP_QSTR_readline, (const byte*)"\xf9\x19\x08" "readline")
+QDEF(MP_QSTR_readlines, (const byte*)"\x6a\x59\x09" "readlines")
+QDEF(MP_QSTR_readonly, (const byte*)"\x03\x89\x08" "readonly")
+QDEF(MP_QSTR_real, (const byte*)"\xbf\xf9\x04" "real")
+QDEF(MP_QSTR_rect, (const byte*)"\xe5\xf9\x04" "rect")
+QDEF(MP_QSTR_recv, (const byte*)"\xe7\xf9\x04" "recv")
+QDEF(MP_QSTR_recvfrom, (const byte*)"\x91\x90\x08" "recvfrom")
+QDEF(MP_QSTR_register, (const byte*)"\xac\xa1\x08" "register")
+QDEF(MP_QSTR_release, (const byte*)"\xec\x8f\x07" "release")
+QDEF(MP_QSTR_remount, (const byte*)"\x9f\xba\x07" "remount")
+QDEF(MP_QSTR_remove, (const byte*)"\x63\x8a\x06" "remove")
+QDEF(MP_QSTR_rename, (const byte*)"\x35\x18\x06" "rename")
+QDEF(MP_QSTR_replace, (const byte*)"\x49\x25\x07" "replace")
+QDEF(MP_QSTR_repr, (const byte*)"\xd0\xf7\x04" "repr")
+QDEF(MP_QSTR_resource_stream, (const byte*)"\x0c\x2f\x0f" "resource_stream")
+QDEF(MP_QSTR_reverse, (const byte*)"\x25\x2a\x07" "reverse")
+QDEF(MP_QSTR_reversed, (const byte*)"\xa1\x6e\x08" "reversed")
+QDEF(MP_QSTR_rfind, (const byte*)"\xd2\x9c\x05" "rfind")
+QDEF(MP_QSTR_rindex, (const byte*)"\xe9\x2b\x06" "rindex")
+QDEF(MP_QSTR_rmdir, (const byte*)"\x45\xa7\x05" "rmdir")
+QDEF(MP_QSTR_round, (const byte*)"\xe7\x25\x05" "round")
+QDEF(MP_QSTR_rpartition, (const byte*)"\x15\xd0\x0a" "rpartition")
+QDEF(MP_QSTR_rsplit, (const byte*)"\xa5\x00\x06" "rsplit")
+QDEF(MP_QSTR_rstrip, (const byte*)"\x3b\x95\x06" "rstrip")
+QDEF(MP_QSTR_schedule, (const byte*)"\xe0\xac\x08" "schedule")
+QDEF(MP_QSTR_scroll, (const byte*)"\x28\x5a\x06" "scroll")
+QDEF(MP_QSTR_search, (const byte*)"\xab\xc1\x06" "search")
+QDEF(MP_QSTR_seed, (const byte*)"\x92\x75\x04" "seed")
+QDEF(MP_QSTR_seek, (const byte*)"\x9d\x75\x04" "seek")
+QDEF(MP_QSTR_send, (const byte*)"\xb9\x76\x04" "send")
+QDEF(MP_QSTR_sendto, (const byte*)"\x22\x03\x06" "sendto")
+QDEF(MP_QSTR_sep, (const byte*)"\x23\x8f\x03" "sep")
+QDEF(MP_QSTR_set, (const byte*)"\x27\x8f\x03" "set")
+QDEF(MP_QSTR_set_buf, (const byte*)"\x89\xa7\x07" "set_buf")
+QDEF(MP_QSTR_set_error, (const byte*)"\x40\xfb\x09" "set_error")
+QDEF(MP_QSTR_setattr, (const byte*)"\xd4\xa8\x07" "setattr")
+QDEF(MP_QSTR_setblocking, (const byte*)"\x6e\x18\x0b" "setblocking")
+QDEF(MP_QSTR_setdefault, (const byte*)"\x6c\xa3\x0a" "setdefault")
+QDEF(MP_QSTR_setraw, (const byte*)"\x83\x71\x06" "setraw")
+QDEF(MP_QSTR_setsockopt, (const byte*)"\x38\xe8\x0a" "setsockopt")
+QDEF(MP_QSTR_setter, (const byte*)"\x04\x59\x06" "setter")
+QDEF(MP_QSTR_sha256, (const byte*)"\x2e\x01\x06" "sha256")
+QDEF(MP_QSTR_signed, (const byte*)"\x37\x01\x06" "signed")
+QDEF(MP_QSTR_sin, (const byte*)"\xb1\x90\x03" "sin")
+QDEF(MP_QSTR_single, (const byte*)"\x3f\x20\x06" "single")
+QDEF(MP_QSTR_sinh, (const byte*)"\xb9\xa6\x04" "sinh")
+QDEF(MP_QSTR_sizeof, (const byte*)"\x49\x73\x06" "sizeof")
+QDEF(MP_QSTR_skip, (const byte*)"\x04\xaf\x04" "skip")
+QDEF(MP_QSTR_sleep, (const byte*)"\xea\x27\x05" "sleep")
+QDEF(MP_QSTR_sleep_ms, (const byte*)"\x0b\x63\x08" "sleep_ms")
+QDEF(MP_QSTR_sleep_us, (const byte*)"\x13\x60\x08" "sleep_us")
+QDEF(MP_QSTR_slice, (const byte*)"\xb5\xf4\x05" "slice")
+QDEF(MP_QSTR_sockaddr, (const byte*)"\x62\x8c\x08" "sockaddr")
+QDEF(MP_QSTR_socket, (const byte*)"\x60\xcc\x06" "socket")
+QDEF(MP_QSTR_sort, (const byte*)"\xbf\x9d\x04" "sort")
+QDEF(MP_QSTR_sorted, (const byte*)"\x5e\x15\x06" "sorted")
+QDEF(MP_QSTR_split, (const byte*)"\xb7\x33\x05" "split")
+QDEF(MP_QSTR_splitlines, (const byte*)"\x6a\xd3\x0a" "splitlines")
+QDEF(MP_QSTR_sqrt, (const byte*)"\x21\x44\x04" "sqrt")
+QDEF(MP_QSTR_stack_size, (const byte*)"\x31\x3b\x0a" "stack_size")
+QDEF(MP_QSTR_stack_use, (const byte*)"\x97\xf7\x09" "stack_use")
+QDEF(MP_QSTR_start, (const byte*)"\x85\xef\x05" "start")
+QDEF(MP_QSTR_start_array, (const byte*)"\x23\xba\x0b" "start_array")
+QDEF(MP_QSTR_start_map, (const byte*)"\xe6\x45\x09" "start_map")
+QDEF(MP_QSTR_start_new_thread, (const byte*)"\xd7\x25\x10" "start_new_thread")
+QDEF(MP_QSTR_startswith, (const byte*)"\x74\xe8\x0a" "startswith")
+QDEF(MP_QSTR_stat, (const byte*)"\xd7\x35\x04" "stat")
+QDEF(MP_QSTR_staticmethod, (const byte*)"\x62\xaf\x0c" "staticmethod")
+QDEF(MP_QSTR_statvfs, (const byte*)"\x14\x19\x07" "statvfs")
+QDEF(MP_QSTR_stderr, (const byte*)"\xa3\x58\x06" "stderr")
+QDEF(MP_QSTR_stdin, (const byte*)"\x21\x04\x05" "stdin")
+QDEF(MP_QSTR_stdout, (const byte*)"\x08\x83\x06" "stdout")
+QDEF(MP_QSTR_step, (const byte*)"\x57\x36\x04" "step")
+QDEF(MP_QSTR_stop, (const byte*)"\x9d\x36\x04" "stop")
+QDEF(MP_QSTR_str, (const byte*)"\x50\x8d\x03" "str")
+QDEF(MP_QSTR_strerror, (const byte*)"\x48\x71\x08" "strerror")
+QDEF(MP_QSTR_string, (const byte*)"\x70\xe5\x06" "string")
+QDEF(MP_QSTR_strip, (const byte*)"\x29\x1e\x05" "strip")
+QDEF(MP_QSTR_struct, (const byte*)"\x12\x90\x06" "struct")
+QDEF(MP_QSTR_sum, (const byte*)"\x2e\x8d\x03" "sum")
+QDEF(MP_QSTR_super, (const byte*)"\xc4\xb2\x05" "super")
+QDEF(MP_QSTR_symmetric_difference, (const byte*)"\xce\x67\x14" "symmetric_difference")
+QDEF(MP_QSTR_symmetric_difference_update, (const byte*)"\x60\xf8\x1b" "symmetric_difference_update")
+QDEF(MP_QSTR_sync, (const byte*)"\xa2\x62\x04" "sync")
+QDEF(MP_QSTR_sys, (const byte*)"\xbc\x8e\x03" "sys")
+QDEF(MP_QSTR_system, (const byte*)"\xa0\x14\x06" "system")
+QDEF(MP_QSTR_tan, (const byte*)"\xfe\x61\x03" "tan")
+QDEF(MP_QSTR_tanh, (const byte*)"\xd6\xa1\x04" "tanh")
+QDEF(MP_QSTR_tb_frame, (const byte*)"\x31\xed\x08" "tb_frame")
+QDEF(MP_QSTR_tb_lasti, (const byte*)"\xaf\xe9\x08" "tb_lasti")
+QDEF(MP_QSTR_tb_lineno, (const byte*)"\x23\xcf\x09" "tb_lineno")
+QDEF(MP_QSTR_tb_next, (const byte*)"\xeb\x14\x07" "tb_next")
+QDEF(MP_QSTR_tcgetattr, (const byte*)"\xb7\xc5\x09" "tcgetattr")
+QDEF(MP_QSTR_tcsetattr, (const byte*)"\xa3\x34\x09" "tcsetattr")
+QDEF(MP_QSTR_tell, (const byte*)"\x14\xb1\x04" "tell")
+QDEF(MP_QSTR_termios, (const byte*)"\x7e\xdf\x07" "termios")
+QDEF(MP_QSTR_text, (const byte*)"\x98\xaf\x04" "text")
+QDEF(MP_QSTR_threshold, (const byte*)"\xf2\x2f\x09" "threshold")
+QDEF(MP_QSTR_throw, (const byte*)"\xb3\x44\x05" "throw")
+QDEF(MP_QSTR_ticks_add, (const byte*)"\x9d\xae\x09" "ticks_add")
+QDEF(MP_QSTR_ticks_cpu, (const byte*)"\x1a\xa5\x09" "ticks_cpu")
+QDEF(MP_QSTR_ticks_diff, (const byte*)"\xb1\xe0\x0a" "ticks_diff")
+QDEF(MP_QSTR_ticks_ms, (const byte*)"\x42\x32\x08" "ticks_ms")
+QDEF(MP_QSTR_ticks_us, (const byte*)"\x5a\x31\x08" "ticks_us")
+QDEF(MP_QSTR_time, (const byte*)"\xf0\xc1\x04" "time")
+QDEF(MP_QSTR_time_pulse_us, (const byte*)"\x89\x0c\x0d" "time_pulse_us")
+QDEF(MP_QSTR_to_bytes, (const byte*)"\xd8\x3e\x08" "to_bytes")
+QDEF(MP_QSTR_traceback, (const byte*)"\xcf\xb2\x09" "traceback")
+QDEF(MP_QSTR_trunc, (const byte*)"\x5b\x99\x05" "trunc")
+QDEF(MP_QSTR_tuple, (const byte*)"\xfd\x41\x05" "tuple")
+QDEF(MP_QSTR_type, (const byte*)"\x9d\x7f\x04" "type")
+QDEF(MP_QSTR_uctypes, (const byte*)"\xf8\x71\x07" "uctypes")
+QDEF(MP_QSTR_uerrno, (const byte*)"\xb4\xe9\x06" "uerrno")
+QDEF(MP_QSTR_uheapq, (const byte*)"\x1d\x43\x06" "uheapq")
+QDEF(MP_QSTR_uint, (const byte*)"\xe3\x3d\x04" "uint")
+QDEF(MP_QSTR_uio, (const byte*)"\xb6\x66\x03" "uio")
+QDEF(MP_QSTR_ujson, (const byte*)"\xe8\x30\x05" "ujson")
+QDEF(MP_QSTR_umachine, (const byte*)"\x95\x7f\x08" "umachine")
+QDEF(MP_QSTR_umount, (const byte*)"\xdd\x9e\x06" "umount")
+QDEF(MP_QSTR_unhexlify, (const byte*)"\xb1\xb9\x09" "unhexlify")
+QDEF(MP_QSTR_uniform, (const byte*)"\x01\xf5\x07" "uniform")
+QDEF(MP_QSTR_union, (const byte*)"\xf6\x7c\x05" "union")
+QDEF(MP_QSTR_unlink, (const byte*)"\xfe\x8f\x06" "unlink")
+QDEF(MP_QSTR_unpack, (const byte*)"\x07\x3c\x06" "unpack")
+QDEF(MP_QSTR_unpack_from, (const byte*)"\x0e\x6d\x0b" "unpack_from")
+QDEF(MP_QSTR_unregister, (const byte*)"\x17\xd4\x0a" "unregister")
+QDEF(MP_QSTR_uos, (const byte*)"\xec\x67\x03" "uos")
+QDEF(MP_QSTR_uos_vfs, (const byte*)"\x30\xa5\x07" "uos_vfs")
+QDEF(MP_QSTR_update, (const byte*)"\xb4\x76\x06" "update")
+QDEF(MP_QSTR_upper, (const byte*)"\x27\x94\x05" "upper")
+QDEF(MP_QSTR_urandom, (const byte*)"\xab\xae\x07" "urandom")
+QDEF(MP_QSTR_ure, (const byte*)"\x87\x63\x03" "ure")
+QDEF(MP_QSTR_uselect, (const byte*)"\x58\x8e\x07" "uselect")
+QDEF(MP_QSTR_usocket, (const byte*)"\x75\x00\x07" "usocket")
+QDEF(MP_QSTR_ustruct, (const byte*)"\x47\x08\x07" "ustruct")
+QDEF(MP_QSTR_utime, (const byte*)"\xe5\x9d\x05" "utime")
+QDEF(MP_QSTR_utimeq, (const byte*)"\xf4\x5a\x06" "utimeq")
+QDEF(MP_QSTR_value, (const byte*)"\x4e\x34\x05" "value")
+QDEF(MP_QSTR_values, (const byte*)"\x7d\xbe\x06" "values")
+QDEF(MP_QSTR_version, (const byte*)"\xbf\xd3\x07" "version")
+QDEF(MP_QSTR_version_info, (const byte*)"\x6e\x0a\x0c" "version_info")
+QDEF(MP_QSTR_viper, (const byte*)"\x5d\x23\x05" "viper")
+QDEF(MP_QSTR_vline, (const byte*)"\x1d\xf6\x05" "vline")
+QDEF(MP_QSTR_wear, (const byte*)"\x84\x65\x04" "wear")
+QDEF(MP_QSTR_websocket, (const byte*)"\x90\x8d\x09" "websocket")
+QDEF(MP_QSTR_write, (const byte*)"\x98\xa8\x05" "write")
+QDEF(MP_QSTR_write1, (const byte*)"\xa9\xbb\x06" "write1")
+QDEF(MP_QSTR_writeblocks, (const byte*)"\x02\xdf\x0b" "writeblocks")
+QDEF(MP_QSTR_zip, (const byte*)"\xe6\xac\x03" "zip")
+TRANSLATION("  File \"%q\", line %d", 20, 3, 252, 82, 198, 63, 134, 156, 255, 15, 144, 178, 41, 141, 42) //   File \"%q\", line %d
+TRANSLATION("%%c requires int or char", 24, 211, 74, 7, 62, 114, 142, 112, 17, 100, 51, 138, 118, 39) // %%c requires int or char
+TRANSLATION("%q index out of range", 21, 211, 144, 139, 83, 242, 27, 50, 27, 112, 228, 188, 24) // %q index out of range
+TRANSLATION("%q indices must be integers, not %q", 35, 211, 144, 139, 84, 161, 192, 190, 98, 70, 198, 17, 100, 248, 55, 143, 144, 86, 145, 167, 32) // %q indices must be integers, not %q
+TRANSLATION("%q() takes %d positional arguments but %d were given", 52, 211, 159, 79, 81, 37, 240, 112, 52, 168, 195, 66, 74, 50, 149, 129, 63, 25, 185, 172, 192, 219, 50, 52, 168, 240, 110, 99, 132, 238, 106) // %q() takes %d positional arguments but %d were given
+TRANSLATION("'%q' argument required", 22, 215, 78, 117, 4, 252, 102, 230, 178, 28, 249, 202, 57, 212) // \'%q\' argument required
+TRANSLATION("'%q' object cannot assign attribute '%q'", 40, 215, 78, 117, 13, 183, 185, 210, 69, 9, 85, 164, 20, 66, 112, 160, 166, 93, 54, 204, 152, 215, 78, 117) // \'%q\' object cannot assign attribute \'%q\'
+TRANSLATION("'%q' object does not support '%q'", 33, 215, 78, 117, 13, 183, 185, 210, 69, 88, 224, 43, 72, 140, 227, 12, 242, 53, 211, 157, 64) // \'%q\' object does not support \'%q\'
+TRANSLATION("'%q' object does not support item assignment", 44, 215, 78, 117, 13, 183, 185, 210, 69, 88, 224, 43, 72, 140, 227, 12, 242, 18, 78, 224, 162, 19, 133, 185, 172, 128) // \'%q\' object does not support item assignment
+TRANSLATION("'%q' object does not support item deletion", 42, 215, 78, 117, 13, 183, 185, 210, 69, 88, 224, 43, 72, 140, 227, 12, 242, 18, 78, 226, 167, 99, 148, 101) // \'%q\' object does not support item deletion
+TRANSLATION("'%q' object has no attribute '%q'", 33, 215, 78, 117, 13, 183, 185, 210, 71, 98, 128, 172, 10, 101, 211, 108, 201, 141, 116, 231, 80) // \'%q\' object has no attribute \'%q\'
+TRANSLATION("'%q' object is not an iterator", 30, 215, 78, 117, 13, 183, 185, 210, 66, 64, 86, 144, 74, 18, 77, 202, 89, 192) // \'%q\' object is not an iterator
+TRANSLATION("'%q' object is not callable", 27, 215, 78, 117, 13, 183, 185, 210, 66, 64, 86, 145, 66, 181, 139, 107, 24) // \'%q\' object is not callable
+TRANSLATION("'%q' object is not iterable", 27, 215, 78, 117, 13, 183, 185, 210, 66, 64, 86, 144, 146, 110, 91, 88, 192) // \'%q\' object is not iterable
+TRANSLATION("'%q' object is not subscriptable", 32, 215, 78, 117, 13, 183, 185, 210, 66, 64, 86, 145, 25, 218, 40, 233, 137, 45, 172, 96) // \'%q\' object is not subscriptable
+TRANSLATION("'=' alignment not allowed in string format specifier", 52, 215, 249, 234, 10, 201, 194, 220, 214, 66, 180, 130, 181, 155, 193, 212, 34, 136, 151, 69, 224, 110, 207, 114, 145, 24, 58, 38, 232, 110) // \'=\' alignment not allowed in string format specifier
+TRANSLATION("'await' outside function", 24, 212, 188, 18, 78, 161, 179, 48, 149, 49, 190, 86, 146, 140, 160) // \'await\' outside function
+TRANSLATION("'await', 'async for' or 'async with' outside async function", 59, 212, 188, 18, 78, 191, 33, 169, 71, 75, 65, 187, 62, 161, 156, 106, 81, 210, 208, 120, 73, 237, 168, 108, 204, 37, 76, 20, 116, 180, 27, 229, 105, 40, 202) // \'await\', \'async for\' or \'async with\' outside async function
+TRANSLATION("'break' outside loop", 20, 215, 103, 50, 248, 212, 54, 102, 18, 166, 44, 205, 128) // \'break\' outside loop
+TRANSLATION("'continue' outside loop", 23, 214, 140, 178, 139, 147, 212, 54, 102, 18, 166, 44, 205, 128) // \'continue\' outside loop
+TRANSLATION("'coroutine' object is not an iterator", 37, 214, 140, 237, 153, 69, 61, 67, 109, 238, 116, 144, 144, 21, 164, 18, 132, 147, 114, 150, 112) // \'coroutine\' object is not an iterator
+TRANSLATION("'return' outside function", 25, 213, 206, 114, 235, 168, 108, 204, 37, 76, 111, 149, 164, 163, 40) // \'return\' outside function
+TRANSLATION("'yield' outside function", 24, 215, 164, 59, 87, 80, 217, 152, 74, 152, 223, 43, 73, 70, 80) // \'yield\' outside function
+TRANSLATION("*x must be assignment target", 28, 252, 60, 139, 230, 36, 108, 96, 162, 19, 133, 185, 172, 137, 39, 224, 228) // *x must be assignment target
+TRANSLATION(", in %q\n", 9, 249, 4, 81, 167, 63, 127, 220) // , in %q\r\n
+TRANSLATION("0.0 to a complex power", 22, 252, 126, 127, 136, 150, 4, 40, 215, 197, 143, 200, 195, 120, 55) // 0.0 to a complex power
+TRANSLATION("Call super().__init__() before accessing native object.", 55, 252, 202, 214, 17, 156, 27, 250, 122, 252, 254, 223, 100, 84, 159, 183, 219, 211, 212, 108, 123, 179, 152, 42, 80, 226, 17, 120, 10, 82, 157, 204, 54, 222, 231, 73, 249, 128) // Call super().__init__() before accessing native object.
+TRANSLATION("Cannot subclass slice", 21, 252, 201, 85, 164, 70, 118, 165, 138, 32, 69, 146, 134) // Cannot subclass slice
+TRANSLATION("Cannot unambiguously get sizeof scalar", 38, 252, 201, 85, 164, 101, 74, 251, 39, 25, 108, 197, 186, 28, 28, 136, 79, 220, 219, 113, 20, 43, 19, 128) // Cannot unambiguously get sizeof scalar
+TRANSLATION("Corrupt .mpy file", 17, 252, 217, 223, 56, 145, 243, 190, 58, 27, 165, 140) // Corrupt .mpy file
+TRANSLATION("Corrupt raw code", 16, 252, 217, 223, 56, 144, 229, 224, 81, 170, 96) // Corrupt raw code
+TRANSLATION("Error in regex", 14, 254, 142, 236, 225, 20, 57, 240, 126, 64) // Error in regex
+TRANSLATION("File exists", 11, 255, 20, 177, 131, 242, 145, 48) // File exists
+TRANSLATION("I/O operation on closed file", 28, 253, 62, 159, 230, 27, 6, 229, 40, 202, 25, 69, 44, 208, 117, 27, 165, 140) // I/O operation on closed file
+TRANSLATION("Incompatible .mpy file. Please update all .mpy files. See http://adafru.it/mpy-update for more info.", 100, 253, 22, 141, 124, 20, 166, 214, 49, 243, 190, 58, 27, 165, 143, 230, 63, 107, 25, 65, 140, 226, 165, 38, 10, 214, 31, 59, 227, 161, 186, 88, 227, 230, 63, 177, 152, 237, 51, 143, 175, 211, 232, 85, 45, 223, 63, 52, 159, 165, 241, 215, 182, 113, 82, 147, 27, 179, 139, 179, 152, 69, 221, 190, 96) // Incompatible .mpy file. Please update all .mpy files. See http://adafru.it/mpy-update for more info.
+TRANSLATION("Input/output error", 18, 253, 23, 25, 159, 163, 102, 113, 153, 6, 238, 206) // Input/output error
+TRANSLATION("Invalid %q", 10, 253, 23, 185, 89, 42, 52, 228) // Invalid %q
+TRANSLATION("Invalid argument", 16, 253, 23, 185, 89, 42, 9, 248, 205, 205, 100) // Invalid argument
+TRANSLATION("LHS of keyword arg must be an id", 32, 254, 191, 250, 254, 193, 183, 31, 7, 215, 134, 122, 130, 126, 5, 243, 18, 54, 48, 74, 18, 160) // LHS of keyword arg must be an id
+TRANSLATION("Length must be an int", 21, 254, 166, 188, 79, 97, 124, 196, 141, 140, 18, 132, 89) // Length must be an int
+TRANSLATION("Length must be non-negative", 27, 254, 166, 188, 79, 97, 124, 196, 141, 140, 43, 47, 178, 159, 5, 41, 220, 192) // Length must be non-negative
+TRANSLATION("Name too long", 13, 253, 74, 230, 37, 152, 89, 151, 128) // Name too long
+TRANSLATION("No space left on device", 23, 253, 88, 70, 10, 134, 44, 123, 200, 101, 21, 62, 233, 67) // No space left on device
+TRANSLATION("No such file/directory", 22, 253, 88, 70, 105, 216, 110, 150, 63, 165, 81, 206, 146, 207, 208) // No such file/directory
+TRANSLATION("Permission denied", 17, 253, 141, 238, 145, 8, 202, 42, 106, 135, 80) // Permission denied
+TRANSLATION("Plus any modules on the filesystem\n", 36, 253, 173, 152, 4, 189, 11, 181, 115, 99, 128, 202, 39, 177, 141, 210, 199, 29, 68, 157, 254, 255, 184) // Plus any modules on the filesystem\r\n
+TRANSLATION("Read-only filesystem", 20, 255, 217, 149, 125, 153, 109, 208, 221, 44, 113, 212, 73, 220) // Read-only filesystem
+TRANSLATION("Splitting with sub-captures", 27, 254, 216, 178, 76, 162, 240, 60, 36, 246, 17, 157, 189, 168, 88, 156, 185, 192) // Splitting with sub-captures
+TRANSLATION("Traceback (most recent call last):\n", 36, 255, 71, 42, 30, 197, 79, 129, 233, 118, 137, 14, 116, 53, 145, 66, 181, 133, 138, 39, 215, 235, 247, 253, 192) // Traceback (most recent call last):\r\n
+TRANSLATION("Unable to init parser", 21, 255, 85, 45, 172, 98, 88, 34, 164, 140, 19, 193, 184) // Unable to init parser
+TRANSLATION("Unsupported operation", 21, 255, 85, 140, 227, 12, 242, 117, 13, 131, 114, 148, 101) // Unsupported operation
+TRANSLATION("Viper functions don't currently support more than 4 arguments", 61, 255, 226, 96, 220, 111, 149, 164, 163, 44, 10, 178, 235, 34, 153, 119, 53, 155, 116, 35, 56, 195, 60, 139, 179, 152, 158, 196, 163, 254, 32, 159, 140, 220, 214, 96) // Viper functions don\'t currently support more than 4 arguments
+TRANSLATION("Welcome to Adafruit CircuitPython %s!\n\nPlease visit learn.adafruit.com/category/circuitpython for project guides.\n\nTo list built-in modules please do `help(\"modules\")`.\n", 174, 255, 233, 218, 141, 115, 18, 195, 254, 245, 45, 223, 41, 35, 243, 71, 166, 82, 127, 110, 167, 179, 40, 210, 63, 225, 247, 253, 223, 127, 221, 251, 88, 202, 12, 119, 72, 73, 22, 50, 117, 249, 149, 75, 119, 202, 79, 206, 141, 127, 165, 10, 79, 134, 126, 190, 148, 71, 166, 82, 113, 212, 246, 101, 27, 179, 140, 59, 123, 157, 36, 113, 148, 169, 199, 207, 239, 251, 190, 255, 187, 253, 24, 89, 34, 70, 217, 75, 79, 178, 40, 187, 87, 54, 56, 24, 177, 148, 24, 171, 15, 246, 236, 118, 199, 167, 240, 187, 87, 54, 56, 254, 30, 191, 237, 243, 251, 254, 224) // Welcome to Adafruit CircuitPython %s!\r\n\r\nPlease visit learn.adafruit.com/category/circuitpython for project guides.\r\n\r\nTo list built-in modules please do `help(\"modules\")`.\r\n
+TRANSLATION("[addrinfo error %d]", 19, 255, 241, 86, 174, 139, 187, 3, 119, 103, 26, 87, 255, 224) // [addrinfo error %d]
+TRANSLATION("__init__() should return None", 29, 251, 125, 145, 82, 126, 223, 111, 79, 81, 29, 155, 54, 168, 115, 156, 186, 143, 213, 148, 192) // __init__() should return None
+TRANSLATION("__init__() should return None, not '%q'", 39, 251, 125, 145, 82, 126, 223, 111, 79, 81, 29, 155, 54, 168, 115, 156, 186, 143, 213, 148, 254, 65, 90, 70, 186, 115, 168) // __init__() should return None, not \'%q\'
+TRANSLATION("__new__ arg must be a user-type", 31, 251, 125, 148, 252, 125, 190, 192, 159, 129, 124, 196, 141, 140, 16, 204, 27, 251, 79, 88, 48) // __new__ arg must be a user-type
+TRANSLATION("a bytes-like object is required", 31, 33, 183, 82, 113, 237, 100, 248, 48, 219, 123, 157, 36, 36, 7, 62, 114, 142, 117) // a bytes-like object is required
+TRANSLATION("abort() called", 14, 45, 153, 231, 211, 212, 80, 173, 99, 168) // abort() called
+TRANSLATION("address %08x is not aligned to %d bytes", 39, 42, 213, 206, 32, 105, 248, 255, 207, 200, 72, 10, 210, 10, 201, 194, 157, 68, 176, 210, 163, 110, 164, 224) // address %08x is not aligned to %d bytes
+TRANSLATION("arg is an empty sequence", 24, 39, 224, 36, 2, 80, 119, 196, 244, 32, 249, 201, 173, 12) // arg is an empty sequence
+TRANSLATION("argument has wrong type", 23, 39, 227, 55, 53, 145, 216, 160, 120, 118, 94, 4, 245, 131) // argument has wrong type
+TRANSLATION("argument num/types mismatch", 27, 39, 227, 55, 53, 144, 185, 191, 210, 122, 193, 192, 186, 69, 202, 105, 216) // argument num/types mismatch
+TRANSLATION("argument should be a '%q' not a '%q'", 36, 39, 227, 55, 53, 145, 29, 155, 54, 168, 216, 193, 13, 116, 231, 80, 173, 32, 134, 186, 115, 168) // argument should be a \'%q\' not a \'%q\'
+TRANSLATION("array/bytes required on right side", 34, 39, 114, 235, 233, 183, 82, 112, 28, 249, 202, 57, 212, 50, 135, 78, 59, 72, 132, 169, 128) // array/bytes required on right side
+TRANSLATION("attributes not supported yet", 28, 41, 151, 77, 179, 39, 1, 90, 68, 103, 24, 103, 147, 168, 232, 228) // attributes not supported yet
+TRANSLATION("bad compile mode", 16, 216, 170, 40, 215, 194, 88, 197, 218, 166) // bad compile mode
+TRANSLATION("bad conversion specifier", 24, 216, 170, 40, 203, 220, 222, 17, 148, 70, 14, 137, 186, 27, 128) // bad conversion specifier
+TRANSLATION("bad typecode", 12, 216, 170, 39, 172, 29, 26, 166) // bad typecode
+TRANSLATION("binary op %q not implemented", 28, 217, 20, 159, 160, 216, 26, 114, 21, 164, 37, 241, 99, 185, 172, 157, 64) // binary op %q not implemented
+TRANSLATION("buffer too small", 16, 219, 59, 238, 110, 37, 152, 69, 202, 214) // buffer too small
+TRANSLATION("byte code not implemented", 25, 219, 169, 49, 70, 169, 133, 105, 9, 124, 88, 238, 107, 39, 80) // byte code not implemented
+TRANSLATION("bytes value out of range", 24, 219, 169, 56, 29, 202, 217, 48, 217, 144, 219, 135, 37, 224, 192) // bytes value out of range
+TRANSLATION("can't add special method to already-subclassed class", 52, 161, 46, 178, 10, 181, 17, 131, 162, 21, 133, 206, 123, 53, 68, 176, 43, 57, 149, 122, 246, 140, 237, 75, 20, 65, 212, 82, 197, 16) // can\'t add special method to already-subclassed class
+TRANSLATION("can't assign to expression", 26, 161, 46, 178, 10, 33, 56, 81, 44, 15, 206, 28, 226, 17, 148) // can\'t assign to expression
+TRANSLATION("can't convert %q to %q", 22, 161, 46, 178, 40, 203, 220, 222, 70, 156, 137, 97, 167, 32) // can\'t convert %q to %q
+TRANSLATION("can't convert '%q' object to %q implicitly", 42, 161, 46, 178, 40, 203, 220, 222, 70, 186, 115, 168, 109, 189, 206, 146, 37, 134, 156, 132, 190, 44, 148, 73, 183, 64) // can\'t convert \'%q\' object to %q implicitly
+TRANSLATION("can't convert to %q", 19, 161, 46, 178, 40, 203, 220, 222, 68, 176, 211, 144) // can\'t convert to %q
+TRANSLATION("can't convert to str implicitly", 31, 161, 46, 178, 40, 203, 220, 222, 68, 176, 137, 112, 151, 197, 146, 137, 54, 232) // can\'t convert to str implicitly
+TRANSLATION("can't declare nonlocal in outer code", 36, 161, 46, 178, 42, 116, 177, 57, 133, 101, 179, 80, 172, 17, 67, 102, 77, 197, 26, 166) // can\'t declare nonlocal in outer code
+TRANSLATION("can't delete expression", 23, 161, 46, 178, 42, 118, 57, 48, 126, 112, 231, 16, 140, 160) // can\'t delete expression
+TRANSLATION("can't do binary op between '%q' and '%q'", 40, 161, 46, 178, 42, 195, 100, 82, 126, 131, 96, 108, 115, 224, 205, 70, 186, 115, 168, 37, 168, 215, 78, 117) // can\'t do binary op between \'%q\' and \'%q\'
+TRANSLATION("can't do truncated division of a complex number", 47, 161, 46, 178, 42, 194, 95, 43, 66, 147, 168, 170, 119, 72, 70, 80, 219, 130, 20, 107, 226, 199, 228, 46, 111, 177, 184) // can\'t do truncated division of a complex number
+TRANSLATION("can't have multiple **x", 23, 161, 46, 178, 59, 23, 115, 23, 205, 165, 49, 99, 31, 135, 225, 228) // can\'t have multiple **x
+TRANSLATION("can't have multiple *x", 22, 161, 46, 178, 59, 23, 115, 23, 205, 165, 49, 99, 31, 135, 144) // can\'t have multiple *x
+TRANSLATION("can't implicitly convert '%q' to 'bool'", 39, 161, 46, 178, 18, 248, 178, 81, 38, 221, 10, 50, 247, 55, 145, 174, 156, 234, 37, 134, 187, 51, 91, 80) // can\'t implicitly convert \'%q\' to \'bool\'
+TRANSLATION("can't load from '%q'", 20, 161, 46, 178, 44, 197, 81, 187, 181, 198, 186, 115, 168) // can\'t load from \'%q\'
+TRANSLATION("can't load with '%q' index", 26, 161, 46, 178, 44, 197, 81, 225, 39, 176, 215, 78, 117, 8, 181, 63, 32) // can\'t load with \'%q\' index
+TRANSLATION("can't pend throw to just-started generator", 42, 161, 46, 178, 48, 107, 81, 61, 157, 188, 9, 97, 239, 152, 159, 104, 146, 121, 58, 142, 13, 77, 202, 89, 192) // can\'t pend throw to just-started generator
+TRANSLATION("can't send non-None value to a just-started generator", 53, 161, 46, 178, 32, 214, 161, 89, 125, 191, 86, 83, 29, 202, 217, 49, 44, 8, 123, 230, 39, 218, 36, 158, 78, 163, 131, 83, 114, 150, 112) // can\'t send non-None value to a just-started generator
+TRANSLATION("can't set attribute", 19, 161, 46, 178, 32, 228, 20, 203, 166, 217, 147) // can\'t set attribute
+TRANSLATION("can't store '%q'", 16, 161, 46, 178, 34, 89, 204, 107, 167, 58, 128) // can\'t store \'%q\'
+TRANSLATION("can't store to '%q'", 19, 161, 46, 178, 34, 89, 204, 75, 13, 116, 231, 80) // can\'t store to \'%q\'
+TRANSLATION("can't store with '%q' index", 27, 161, 46, 178, 34, 89, 204, 120, 73, 236, 53, 211, 157, 66, 45, 79, 200) // can\'t store with \'%q\' index
+TRANSLATION("can't switch from automatic field numbering to manual field specification", 73, 161, 46, 178, 35, 194, 77, 59, 13, 221, 174, 11, 50, 215, 41, 74, 13, 208, 237, 80, 185, 190, 198, 232, 188, 9, 97, 114, 92, 149, 134, 232, 118, 168, 140, 29, 19, 116, 161, 74, 50, 128) // can\'t switch from automatic field numbering to manual field specification
+TRANSLATION("can't switch from manual field specification to automatic field numbering", 73, 161, 46, 178, 35, 194, 77, 59, 13, 221, 174, 46, 75, 146, 176, 221, 14, 213, 17, 131, 162, 110, 148, 41, 70, 81, 44, 11, 50, 215, 41, 74, 13, 208, 237, 80, 185, 190, 198, 232, 188, 0) // can\'t switch from manual field specification to automatic field numbering
+TRANSLATION("cannot create '%q' instances", 28, 161, 42, 180, 138, 57, 148, 152, 215, 78, 117, 8, 177, 36, 180, 56) // cannot create \'%q\' instances
+TRANSLATION("cannot create instance", 22, 161, 42, 180, 138, 57, 148, 152, 69, 137, 37, 161, 128) // cannot create instance
+TRANSLATION("cannot import name %q", 21, 161, 42, 180, 132, 190, 25, 228, 41, 92, 198, 156, 128) // cannot import name %q
+TRANSLATION("cannot perform relative import", 30, 161, 42, 180, 140, 27, 238, 207, 112, 231, 98, 148, 238, 97, 47, 134, 121) // cannot perform relative import
+TRANSLATION("casting", 7, 161, 68, 162, 240) // casting
+TRANSLATION("chr() arg not in range(0x110000)", 32, 167, 103, 244, 245, 4, 252, 5, 105, 8, 161, 201, 120, 63, 79, 199, 207, 229, 249, 126, 63, 143, 227, 248, 250, 128) // chr() arg not in range(0x110000)
+TRANSLATION("complex division by zero", 24, 163, 95, 22, 63, 34, 169, 221, 33, 25, 70, 221, 15, 220, 221, 128) // complex division by zero
+TRANSLATION("constant must be an integer", 27, 163, 44, 73, 44, 139, 230, 36, 108, 96, 148, 34, 201, 240, 110) // constant must be an integer
+TRANSLATION("conversion to object", 20, 163, 47, 115, 120, 70, 81, 44, 27, 111, 115, 164, 128) // conversion to object
+TRANSLATION("default 'except' must be last", 29, 169, 238, 89, 180, 141, 79, 205, 15, 19, 168, 190, 98, 70, 198, 44, 81, 32) // default \'except\' must be last
+TRANSLATION("dict update sequence has wrong length", 37, 170, 82, 70, 113, 82, 147, 16, 124, 228, 214, 134, 59, 20, 15, 14, 203, 192, 177, 175, 19, 216) // dict update sequence has wrong length
+TRANSLATION("division by zero", 16, 170, 119, 72, 70, 81, 183, 67, 247, 55, 96) // division by zero
+TRANSLATION("empty", 5, 59, 226, 122) // empty
+TRANSLATION("empty heap", 10, 59, 226, 122, 29, 140, 176) // empty heap
+TRANSLATION("empty separator", 15, 59, 226, 122, 16, 120, 39, 41, 103) // empty separator
+TRANSLATION("end of format while looking for conversion specifier", 52, 53, 168, 109, 198, 236, 247, 41, 30, 59, 37, 140, 89, 155, 225, 23, 129, 187, 56, 163, 47, 115, 120, 70, 81, 24, 58, 38, 232, 110) // end of format while looking for conversion specifier
+TRANSLATION("exceptions must derive from BaseException", 41, 63, 52, 60, 74, 50, 192, 190, 98, 69, 77, 211, 185, 141, 221, 174, 63, 240, 80, 127, 211, 205, 15, 18, 140, 160) // exceptions must derive from BaseException
+TRANSLATION("expected ':' after format specifier", 35, 63, 56, 58, 73, 212, 107, 245, 212, 22, 242, 110, 55, 103, 185, 72, 140, 29, 19, 116, 55) // expected \':\' after format specifier
+TRANSLATION("expected tuple/list", 19, 63, 56, 58, 73, 212, 78, 113, 99, 250, 89, 34, 64) // expected tuple/list
+TRANSLATION("expecting a dict for keyword args", 33, 63, 56, 58, 74, 47, 0, 133, 82, 146, 55, 103, 31, 7, 215, 134, 122, 130, 126, 32) // expecting a dict for keyword args
+TRANSLATION("expecting just a value for set", 30, 63, 56, 58, 74, 47, 3, 223, 49, 32, 135, 114, 182, 76, 110, 206, 32, 228) // expecting just a value for set
+TRANSLATION("expecting key:value for dict", 28, 63, 56, 58, 74, 47, 3, 224, 250, 250, 247, 43, 100, 198, 236, 226, 169, 73) // expecting key:value for dict
+TRANSLATION("extra keyword arguments given", 29, 63, 50, 228, 62, 15, 175, 12, 245, 4, 252, 102, 230, 179, 3, 132, 238, 106) // extra keyword arguments given
+TRANSLATION("extra positional arguments given", 32, 63, 50, 228, 48, 208, 146, 140, 165, 96, 79, 198, 110, 107, 48, 56, 78, 230, 160) // extra positional arguments given
+TRANSLATION("f-string expression part cannot include a '#'", 45, 223, 218, 37, 209, 120, 7, 231, 14, 113, 8, 202, 48, 79, 34, 132, 170, 210, 17, 105, 108, 212, 193, 13, 127, 195, 80) // f-string expression part cannot include a \'#\'
+TRANSLATION("f-string expression part cannot include a backslash", 51, 223, 218, 37, 209, 120, 7, 231, 14, 113, 8, 202, 48, 79, 34, 132, 170, 210, 17, 105, 108, 212, 193, 13, 138, 159, 17, 98, 142, 192) // f-string expression part cannot include a backslash
+TRANSLATION("f-string: empty expression not allowed", 38, 223, 218, 37, 209, 120, 250, 131, 190, 39, 160, 126, 112, 231, 16, 140, 161, 90, 65, 90, 205, 224, 234) // f-string: empty expression not allowed
+TRANSLATION("f-string: expecting '}'", 23, 223, 218, 37, 209, 120, 250, 131, 243, 131, 164, 162, 240, 53, 254, 250, 128) // f-string: expecting \'}\'
+TRANSLATION("f-string: single '}' is not allowed", 35, 223, 218, 37, 209, 120, 250, 136, 69, 226, 198, 53, 254, 250, 132, 128, 173, 32, 173, 102, 240, 117) // f-string: single \'}\' is not allowed
+TRANSLATION("first argument to super() must be type", 38, 221, 30, 36, 19, 241, 155, 154, 200, 150, 17, 156, 27, 250, 122, 139, 230, 36, 108, 98, 122, 193, 128) // first argument to super() must be type
+TRANSLATION("format requires a dict", 22, 221, 158, 229, 33, 207, 156, 163, 156, 2, 21, 74, 72) // format requires a dict
+TRANSLATION("full", 4, 223, 54, 176) // full
+TRANSLATION("function does not take keyword arguments", 40, 223, 43, 73, 70, 81, 86, 56, 10, 210, 36, 190, 12, 124, 31, 94, 25, 234, 9, 248, 205, 205, 102, 0) // function does not take keyword arguments
+TRANSLATION("function expected at most %d arguments, got %d", 46, 223, 43, 73, 70, 80, 126, 112, 116, 147, 168, 41, 23, 104, 145, 165, 65, 63, 25, 185, 172, 199, 200, 112, 210, 52, 168) // function expected at most %d arguments, got %d
+TRANSLATION("function got multiple values for argument '%q'", 46, 223, 43, 73, 70, 81, 195, 72, 190, 109, 41, 139, 24, 238, 86, 201, 192, 221, 156, 19, 241, 155, 154, 200, 215, 78, 117) // function got multiple values for argument \'%q\'
+TRANSLATION("function missing %d required positional arguments", 49, 223, 43, 73, 70, 81, 116, 136, 69, 224, 105, 80, 231, 206, 81, 206, 163, 13, 9, 40, 202, 86, 4, 252, 102, 230, 179, 0) // function missing %d required positional arguments
+TRANSLATION("function missing keyword-only argument", 38, 223, 43, 73, 70, 81, 116, 136, 69, 224, 124, 31, 94, 25, 235, 236, 203, 110, 129, 63, 25, 185, 172, 128) // function missing keyword-only argument
+TRANSLATION("function missing required keyword argument '%q'", 47, 223, 43, 73, 70, 81, 116, 136, 69, 224, 57, 243, 148, 115, 168, 248, 62, 188, 51, 212, 19, 241, 155, 154, 200, 215, 78, 117) // function missing required keyword argument \'%q\'
+TRANSLATION("function missing required positional argument #%d", 49, 223, 43, 73, 70, 81, 116, 136, 69, 224, 57, 243, 148, 115, 168, 195, 66, 74, 50, 149, 129, 63, 25, 185, 172, 143, 240, 210, 160) // function missing required positional argument #%d
+TRANSLATION("function takes %d positional arguments but %d were given", 56, 223, 43, 73, 70, 81, 37, 240, 112, 52, 168, 195, 66, 74, 50, 149, 129, 63, 25, 185, 172, 192, 219, 50, 52, 168, 240, 110, 99, 132, 238, 106) // function takes %d positional arguments but %d were given
+TRANSLATION("generator already executing", 27, 224, 212, 220, 165, 156, 21, 156, 202, 189, 3, 242, 116, 204, 162, 240) // generator already executing
+TRANSLATION("generator ignored GeneratorExit", 31, 224, 212, 220, 165, 156, 39, 10, 206, 117, 31, 249, 53, 55, 41, 103, 254, 158, 82, 64) // generator ignored GeneratorExit
+TRANSLATION("heap must be a list", 19, 236, 101, 129, 124, 196, 141, 140, 16, 178, 68, 128) // heap must be a list
+TRANSLATION("identifier redefined as global", 30, 74, 154, 202, 110, 134, 225, 206, 167, 186, 41, 212, 20, 14, 44, 219, 21, 128) // identifier redefined as global
+TRANSLATION("identifier redefined as nonlocal", 32, 74, 154, 202, 110, 134, 225, 206, 167, 186, 41, 212, 20, 5, 101, 179, 80, 172) // identifier redefined as nonlocal
+TRANSLATION("incomplete format", 17, 69, 163, 95, 22, 57, 49, 187, 61, 202, 64) // incomplete format
+TRANSLATION("incomplete format key", 21, 69, 163, 95, 22, 57, 49, 187, 61, 202, 71, 193, 244) // incomplete format key
+TRANSLATION("incorrect padding", 17, 69, 163, 59, 157, 36, 96, 171, 84, 94, 0) // incorrect padding
+TRANSLATION("index out of range", 18, 69, 169, 249, 13, 153, 13, 184, 114, 94, 12) // index out of range
+TRANSLATION("indices must be integers", 24, 69, 170, 80, 224, 95, 49, 35, 99, 8, 178, 124, 27, 192) // indices must be integers
+TRANSLATION("int() arg 2 must be >= 2 and <= 36", 34, 69, 159, 79, 80, 79, 192, 254, 34, 249, 137, 27, 24, 255, 183, 243, 31, 196, 18, 212, 127, 215, 249, 143, 229, 255, 32) // int() arg 2 must be >= 2 and <= 36
+TRANSLATION("integer required", 16, 69, 147, 224, 220, 57, 243, 148, 115, 168) // integer required
+TRANSLATION("invalid format", 14, 69, 238, 86, 74, 141, 217, 238, 82) // invalid format
+TRANSLATION("invalid format specifier", 24, 69, 238, 86, 74, 141, 217, 238, 82, 35, 7, 68, 221, 13, 192) // invalid format specifier
+TRANSLATION("invalid micropython decorator", 29, 69, 238, 86, 74, 139, 165, 29, 177, 212, 246, 101, 21, 58, 51, 148, 179, 128) // invalid micropython decorator
+TRANSLATION("invalid syntax", 14, 69, 238, 86, 74, 136, 233, 100, 188, 128) // invalid syntax
+TRANSLATION("invalid syntax for integer", 26, 69, 238, 86, 74, 136, 233, 100, 188, 141, 217, 194, 44, 159, 6, 224) // invalid syntax for integer
+TRANSLATION("invalid syntax for integer with base %d", 39, 69, 238, 86, 74, 136, 233, 100, 188, 141, 217, 194, 44, 159, 6, 227, 194, 79, 97, 177, 65, 141, 42) // invalid syntax for integer with base %d
+TRANSLATION("invalid syntax for number", 25, 69, 238, 86, 74, 136, 233, 100, 188, 141, 217, 194, 230, 251, 27, 128) // invalid syntax for number
+TRANSLATION("issubclass() arg 1 must be a class", 34, 72, 140, 237, 75, 20, 71, 167, 168, 39, 224, 126, 66, 249, 137, 27, 24, 33, 75, 20, 64) // issubclass() arg 1 must be a class
+TRANSLATION("issubclass() arg 2 must be a class or a tuple of classes", 56, 72, 140, 237, 75, 20, 71, 167, 168, 39, 224, 127, 17, 124, 196, 141, 140, 16, 165, 138, 32, 51, 130, 19, 156, 88, 195, 110, 41, 98, 136, 56) // issubclass() arg 2 must be a class or a tuple of classes
+TRANSLATION("join expects a list of str/bytes objects consistent with self object", 68, 247, 100, 80, 126, 112, 116, 152, 4, 44, 145, 33, 183, 17, 47, 244, 219, 169, 56, 13, 183, 185, 210, 96, 81, 150, 18, 36, 214, 71, 132, 158, 194, 14, 219, 134, 219, 220, 233, 32) // join expects a list of str/bytes objects consistent with self object
+TRANSLATION("keyword argument(s) not yet implemented - use normal args instead", 65, 248, 62, 188, 51, 212, 19, 241, 155, 154, 207, 164, 122, 133, 105, 29, 28, 132, 190, 44, 119, 53, 147, 168, 246, 25, 131, 10, 207, 114, 176, 39, 226, 2, 44, 73, 149, 64) // keyword argument(s) not yet implemented - use normal args instead
+TRANSLATION("keywords must be strings", 24, 248, 62, 188, 51, 214, 5, 243, 18, 54, 49, 18, 232, 188, 64) // keywords must be strings
+TRANSLATION("length argument not allowed for this type", 41, 177, 175, 19, 216, 19, 241, 155, 154, 200, 86, 144, 86, 179, 120, 58, 141, 217, 196, 246, 72, 19, 214, 12) // length argument not allowed for this type
+TRANSLATION("lhs and rhs should be compatible", 32, 183, 104, 4, 181, 15, 218, 4, 118, 108, 218, 163, 99, 20, 107, 224, 165, 54, 177, 128) // lhs and rhs should be compatible
+TRANSLATION("local '%q' has type '%q' but source is '%q'", 43, 179, 80, 172, 53, 211, 157, 71, 98, 129, 61, 96, 198, 186, 115, 168, 219, 50, 33, 178, 244, 48, 144, 53, 211, 157, 64) // local \'%q\' has type \'%q\' but source is \'%q\'
+TRANSLATION("local '%q' used before type known", 33, 179, 80, 172, 53, 211, 157, 70, 96, 234, 54, 61, 217, 204, 79, 88, 49, 240, 173, 225, 64) // local \'%q\' used before type known
+TRANSLATION("local variable referenced before assignment", 43, 179, 80, 172, 59, 147, 161, 109, 99, 14, 123, 155, 154, 208, 234, 54, 61, 217, 204, 20, 66, 112, 183, 53, 144) // local variable referenced before assignment
+TRANSLATION("math domain error", 17, 185, 79, 97, 86, 185, 34, 131, 119, 103) // math domain error
+TRANSLATION("maximum recursion depth exceeded", 32, 185, 121, 75, 230, 225, 206, 153, 120, 70, 81, 83, 196, 246, 7, 230, 134, 117, 58, 128) // maximum recursion depth exceeded
+TRANSLATION("memory allocation failed, allocating %u bytes", 45, 185, 221, 159, 160, 86, 179, 80, 165, 25, 70, 228, 150, 58, 252, 129, 90, 205, 66, 148, 94, 6, 153, 27, 117, 39, 0) // memory allocation failed, allocating %u bytes
+TRANSLATION("memory allocation failed, heap is locked", 40, 185, 221, 159, 160, 86, 179, 80, 165, 25, 70, 228, 150, 58, 252, 135, 99, 44, 4, 129, 102, 167, 193, 212) // memory allocation failed, heap is locked
+TRANSLATION("module not found", 16, 187, 87, 54, 48, 173, 35, 118, 202, 212) // module not found
+TRANSLATION("multiple *x in assignment", 25, 190, 109, 41, 139, 24, 252, 60, 132, 80, 81, 9, 194, 220, 214, 64) // multiple *x in assignment
+TRANSLATION("multiple bases have instance lay-out conflict", 45, 190, 109, 41, 139, 24, 216, 160, 224, 118, 46, 230, 17, 98, 73, 104, 98, 197, 215, 179, 102, 69, 25, 119, 178, 82, 64) // multiple bases have instance lay-out conflict
+TRANSLATION("must raise an object", 20, 190, 98, 67, 146, 65, 130, 80, 219, 123, 157, 36) // must raise an object
+TRANSLATION("must use keyword argument for key function", 42, 190, 98, 70, 96, 199, 193, 245, 225, 158, 160, 159, 140, 220, 214, 70, 236, 227, 224, 250, 27, 229, 105, 40, 202) // must use keyword argument for key function
+TRANSLATION("name '%q' is not defined", 24, 82, 185, 141, 116, 231, 80, 144, 21, 164, 84, 247, 69, 58, 128) // name \'%q\' is not defined
+TRANSLATION("name not defined", 16, 82, 185, 133, 105, 21, 61, 209, 78, 160) // name not defined
+TRANSLATION("name reused for argument", 24, 82, 185, 135, 60, 193, 212, 110, 206, 9, 248, 205, 205, 100) // name reused for argument
+TRANSLATION("native yield", 12, 82, 148, 238, 99, 164, 59, 84) // native yield
+TRANSLATION("need more than %d values to unpack", 34, 83, 58, 139, 179, 152, 158, 196, 163, 74, 142, 229, 108, 156, 9, 97, 149, 193, 83, 224) // need more than %d values to unpack
+TRANSLATION("negative shift count", 20, 83, 224, 165, 59, 152, 142, 201, 188, 138, 54, 86, 64) // negative shift count
+TRANSLATION("no active exception to reraise", 30, 86, 5, 73, 78, 230, 15, 205, 15, 18, 140, 162, 88, 57, 185, 36, 24) // no active exception to reraise
+TRANSLATION("no binding for nonlocal found", 29, 86, 27, 34, 213, 23, 129, 187, 56, 86, 91, 53, 10, 195, 118, 202, 212) // no binding for nonlocal found
+TRANSLATION("no module named '%q'", 20, 86, 23, 106, 230, 198, 20, 174, 117, 26, 233, 206, 160) // no module named \'%q\'
+TRANSLATION("no such attribute", 17, 86, 17, 154, 118, 5, 50, 233, 182, 100, 192) // no such attribute
+TRANSLATION("non-default argument follows default argument", 45, 86, 95, 106, 158, 229, 155, 72, 39, 227, 55, 53, 145, 187, 90, 205, 226, 5, 79, 114, 205, 164, 19, 241, 155, 154, 200) // non-default argument follows default argument
+TRANSLATION("non-hex digit found", 19, 86, 95, 110, 199, 228, 85, 56, 73, 27, 182, 86, 160) // non-hex digit found
+TRANSLATION("non-keyword arg after */**", 26, 86, 95, 111, 131, 235, 195, 61, 65, 63, 0, 183, 147, 113, 248, 125, 63, 15, 192) // non-keyword arg after */**
+TRANSLATION("non-keyword arg after keyword arg", 33, 86, 95, 111, 131, 235, 195, 61, 65, 63, 0, 183, 147, 113, 240, 125, 120, 103, 168, 39, 224) // non-keyword arg after keyword arg
+TRANSLATION("not all arguments converted during string formatting", 52, 86, 144, 86, 176, 39, 227, 55, 53, 152, 20, 101, 238, 111, 39, 81, 92, 186, 47, 2, 37, 209, 120, 27, 179, 220, 166, 81, 120) // not all arguments converted during string formatting
+TRANSLATION("not enough arguments for format string", 38, 86, 144, 106, 217, 227, 176, 39, 227, 55, 53, 152, 27, 179, 141, 217, 238, 82, 34, 93, 23, 128) // not enough arguments for format string
+TRANSLATION("object '%q' is not a tuple or list", 34, 109, 189, 206, 146, 53, 211, 157, 66, 64, 86, 144, 66, 115, 139, 24, 103, 22, 72, 144) // object \'%q\' is not a tuple or list
+TRANSLATION("object does not support item assignment", 39, 109, 189, 206, 146, 42, 199, 1, 90, 68, 103, 24, 103, 144, 146, 119, 5, 16, 156, 45, 205, 100) // object does not support item assignment
+TRANSLATION("object does not support item deletion", 37, 109, 189, 206, 146, 42, 199, 1, 90, 68, 103, 24, 103, 144, 146, 119, 21, 59, 28, 163, 40) // object does not support item deletion
+TRANSLATION("object has no len", 17, 109, 189, 206, 146, 59, 20, 5, 97, 99, 80) // object has no len
+TRANSLATION("object is not subscriptable", 27, 109, 189, 206, 146, 18, 2, 180, 136, 206, 209, 71, 76, 73, 109, 99) // object is not subscriptable
+TRANSLATION("object not an iterator", 22, 109, 189, 206, 146, 21, 164, 18, 132, 147, 114, 150, 112) // object not an iterator
+TRANSLATION("object not callable", 19, 109, 189, 206, 146, 21, 164, 80, 173, 98, 218, 198) // object not callable
+TRANSLATION("object not in sequence", 22, 109, 189, 206, 146, 21, 164, 34, 136, 62, 114, 107, 67) // object not in sequence
+TRANSLATION("object not iterable", 19, 109, 189, 206, 146, 21, 164, 36, 155, 150, 214, 48) // object not iterable
+TRANSLATION("object of type '%q' has no len()", 32, 109, 189, 206, 146, 27, 113, 61, 96, 198, 186, 115, 168, 236, 80, 21, 133, 141, 125, 61, 64) // object of type \'%q\' has no len()
+TRANSLATION("object with buffer protocol required", 36, 109, 189, 206, 146, 60, 36, 246, 27, 103, 125, 205, 198, 29, 165, 168, 214, 14, 124, 229, 28, 234) // object with buffer protocol required
+TRANSLATION("odd-length string", 17, 106, 215, 218, 198, 188, 79, 97, 18, 232, 188, 0) // odd-length string
+TRANSLATION("offset out of bounds", 20, 109, 247, 131, 144, 217, 144, 219, 141, 155, 43, 88) // offset out of bounds
+TRANSLATION("only slices with step=1 (aka None) are supported", 48, 101, 183, 66, 44, 148, 56, 30, 18, 123, 8, 147, 199, 243, 252, 135, 161, 124, 16, 253, 89, 79, 212, 19, 152, 140, 227, 12, 242, 117) // only slices with step=1 (aka None) are supported
+TRANSLATION("ord expects a character", 23, 103, 168, 63, 56, 58, 76, 2, 20, 236, 78, 84, 147, 112) // ord expects a character
+TRANSLATION("ord() expected a character, but string of length %d found", 57, 103, 175, 167, 168, 63, 56, 58, 73, 212, 16, 167, 98, 114, 164, 155, 252, 134, 217, 145, 18, 232, 188, 6, 220, 88, 215, 137, 236, 52, 168, 221, 178, 181) // ord() expected a character, but string of length %d found
+TRANSLATION("overflow converting long int to machine word", 44, 110, 230, 251, 217, 188, 10, 50, 247, 55, 148, 94, 5, 153, 120, 8, 178, 37, 133, 202, 157, 145, 76, 120, 103, 168) // overflow converting long int to machine word
+TRANSLATION("parameter annotation must be an identifier", 42, 193, 57, 92, 228, 220, 18, 171, 73, 74, 50, 139, 230, 36, 108, 96, 148, 37, 77, 101, 55, 67, 112) // parameter annotation must be an identifier
+TRANSLATION("pop from empty %q", 17, 195, 96, 110, 237, 112, 119, 196, 244, 52, 228) // pop from empty %q
+TRANSLATION("pow() 3rd argument cannot be 0", 30, 195, 120, 244, 245, 31, 201, 234, 9, 248, 205, 205, 100, 80, 149, 90, 70, 198, 63, 16) // pow() 3rd argument cannot be 0
+TRANSLATION("pow() with 3 arguments requires integers", 40, 195, 120, 244, 245, 30, 18, 123, 15, 228, 9, 248, 205, 205, 102, 3, 159, 57, 71, 56, 8, 178, 124, 27, 192) // pow() with 3 arguments requires integers
+TRANSLATION("queue overflow", 14, 231, 39, 147, 13, 220, 223, 123, 55, 128) // queue overflow
+TRANSLATION("raw f-strings are not implemented", 33, 114, 240, 55, 246, 137, 116, 94, 32, 19, 152, 86, 144, 151, 197, 142, 230, 178, 117) // raw f-strings are not implemented
+TRANSLATION("requested length %d but object has length %d", 44, 115, 231, 39, 18, 117, 22, 53, 226, 123, 13, 42, 54, 204, 134, 219, 220, 233, 35, 177, 64, 177, 175, 19, 216, 105, 80) // requested length %d but object has length %d
+TRANSLATION("return annotation must be an identifier", 39, 115, 156, 186, 130, 85, 105, 41, 70, 81, 124, 196, 141, 140, 18, 132, 169, 172, 166, 232, 110) // return annotation must be an identifier
+TRANSLATION("return expected '%q' but got '%q'", 33, 115, 156, 186, 131, 243, 131, 164, 157, 70, 186, 115, 168, 219, 50, 56, 105, 26, 233, 206, 160) // return expected \'%q\' but got \'%q\'
+TRANSLATION("rsplit(None,n)", 14, 120, 197, 146, 125, 63, 86, 83, 249, 47, 168) // rsplit(None,n)
+TRANSLATION("schedule stack full", 19, 138, 118, 58, 230, 198, 34, 74, 159, 3, 124, 218, 192) // schedule stack full
+TRANSLATION("sign not allowed in string format specifier", 43, 132, 225, 66, 180, 130, 181, 155, 193, 212, 34, 136, 151, 69, 224, 110, 207, 114, 145, 24, 58, 38, 232, 110) // sign not allowed in string format specifier
+TRANSLATION("sign not allowed with integer format specifier 'c'", 50, 132, 225, 66, 180, 130, 181, 155, 193, 212, 120, 73, 236, 17, 100, 248, 55, 27, 179, 220, 164, 70, 14, 137, 186, 27, 141, 105, 168) // sign not allowed with integer format specifier \'c\'
+TRANSLATION("single '}' encountered in format string", 39, 132, 94, 44, 99, 95, 239, 168, 53, 163, 101, 100, 220, 234, 17, 70, 236, 247, 41, 17, 46, 139, 192) // single \'}\' encountered in format string
+TRANSLATION("slice step cannot be zero", 25, 139, 37, 12, 68, 158, 5, 9, 85, 164, 108, 99, 247, 55, 96) // slice step cannot be zero
+TRANSLATION("small int overflow", 18, 139, 149, 172, 17, 100, 55, 115, 125, 236, 222, 0) // small int overflow
+TRANSLATION("start/end indices", 17, 137, 39, 159, 161, 173, 66, 45, 82, 135, 0) // start/end indices
+TRANSLATION("stream operation not supported", 30, 137, 115, 43, 134, 193, 185, 74, 50, 133, 105, 17, 156, 97, 158, 78, 160) // stream operation not supported
+TRANSLATION("string indices must be integers, not %q", 39, 137, 116, 94, 2, 45, 82, 135, 2, 249, 137, 27, 24, 69, 147, 224, 222, 62, 65, 90, 70, 156, 128) // string indices must be integers, not %q
+TRANSLATION("string not supported; use bytes or bytearray", 44, 137, 116, 94, 2, 180, 136, 206, 48, 207, 39, 95, 250, 12, 193, 141, 186, 147, 128, 206, 54, 234, 76, 157, 203, 160) // string not supported; use bytes or bytearray
+TRANSLATION("struct: cannot index", 20, 137, 124, 210, 126, 162, 132, 170, 210, 17, 106, 126, 64) // struct: cannot index
+TRANSLATION("struct: no fields", 17, 137, 124, 210, 126, 161, 88, 110, 135, 106, 192) // struct: no fields
+TRANSLATION("substring not found", 19, 140, 237, 18, 232, 188, 5, 105, 27, 182, 86, 160) // substring not found
+TRANSLATION("super() can't find self", 23, 140, 224, 223, 211, 212, 80, 151, 89, 27, 162, 212, 65, 219, 112) // super() can\'t find self
+TRANSLATION("syntax error in JSON", 20, 142, 150, 75, 200, 55, 118, 112, 138, 63, 203, 251, 127, 159, 234) // syntax error in JSON
+TRANSLATION("syntax error in uctypes descriptor", 34, 142, 150, 75, 200, 55, 118, 112, 138, 51, 73, 235, 7, 2, 167, 20, 116, 196, 179, 128) // syntax error in uctypes descriptor
+TRANSLATION("too many values to unpack (expected %d)", 39, 150, 97, 114, 94, 135, 114, 182, 78, 4, 176, 202, 224, 169, 240, 61, 15, 206, 14, 146, 117, 26, 87, 212) // too many values to unpack (expected %d)
+TRANSLATION("tuple/list has wrong length", 27, 156, 226, 199, 244, 178, 68, 142, 197, 3, 195, 178, 240, 44, 107, 196, 246) // tuple/list has wrong length
+TRANSLATION("type '%q' is not an acceptable base type", 40, 158, 176, 99, 93, 57, 212, 36, 5, 105, 4, 160, 169, 67, 196, 150, 214, 49, 177, 65, 137, 235, 6) // type \'%q\' is not an acceptable base type
+TRANSLATION("type is not an acceptable base type", 35, 158, 176, 97, 32, 43, 72, 37, 5, 74, 30, 36, 182, 177, 141, 138, 12, 79, 88, 48) // type is not an acceptable base type
+TRANSLATION("type object '%q' has no attribute '%q'", 38, 158, 176, 97, 182, 247, 58, 72, 215, 78, 117, 29, 138, 2, 176, 41, 151, 77, 179, 38, 53, 211, 157, 64) // type object \'%q\' has no attribute \'%q\'
+TRANSLATION("type takes 1 or 3 arguments", 27, 158, 176, 98, 75, 224, 224, 126, 65, 156, 127, 32, 79, 198, 110, 107, 48) // type takes 1 or 3 arguments
+TRANSLATION("unary op %q not implemented", 27, 202, 147, 244, 27, 3, 78, 66, 180, 132, 190, 44, 119, 53, 147, 168) // unary op %q not implemented
+TRANSLATION("unexpected indent", 17, 202, 159, 156, 29, 36, 234, 17, 106, 107, 32) // unexpected indent
+TRANSLATION("unexpected keyword argument '%q'", 32, 202, 159, 156, 29, 36, 234, 62, 15, 175, 12, 245, 4, 252, 102, 230, 178, 53, 211, 157, 64) // unexpected keyword argument \'%q\'
+TRANSLATION("unicode name escapes", 20, 202, 165, 26, 166, 20, 174, 96, 226, 133, 131, 128) // unicode name escapes
+TRANSLATION("unindent does not match any outer indentation level", 51, 202, 162, 212, 214, 69, 88, 224, 43, 72, 185, 77, 59, 2, 94, 131, 102, 77, 194, 45, 77, 100, 165, 25, 69, 143, 185, 216) // unindent does not match any outer indentation level
+TRANSLATION("unknown conversion specifier %c", 31, 202, 252, 43, 120, 81, 70, 94, 230, 240, 140, 162, 48, 116, 77, 208, 220, 105, 64) // unknown conversion specifier %c
+TRANSLATION("unknown format code '%c' for object of type '%q'", 48, 202, 252, 43, 120, 81, 187, 61, 202, 69, 26, 166, 53, 210, 154, 141, 217, 195, 109, 238, 116, 144, 219, 137, 235, 6, 53, 211, 157, 64) // unknown format code \'%c\' for object of type \'%q\'
+TRANSLATION("unknown type '%q'", 17, 202, 252, 43, 120, 81, 61, 96, 198, 186, 115, 168) // unknown type \'%q\'
+TRANSLATION("unmatched '{' in format", 23, 202, 220, 166, 157, 142, 163, 95, 247, 212, 34, 141, 217, 238, 82) // unmatched \'{\' in format
+TRANSLATION("unreadable attribute", 20, 202, 185, 149, 75, 107, 24, 41, 151, 77, 179, 38) // unreadable attribute
+TRANSLATION("unsupported format character '%c' (0x%x) at index %d", 52, 202, 198, 113, 134, 121, 58, 141, 217, 238, 82, 41, 216, 156, 169, 38, 227, 93, 41, 168, 244, 252, 124, 233, 231, 212, 20, 132, 90, 159, 145, 165, 64) // unsupported format character \'%c\' (0x%x) at index %d
+TRANSLATION("unsupported type for %q: '%q'", 29, 202, 198, 113, 134, 121, 58, 137, 235, 6, 55, 103, 26, 115, 245, 26, 233, 206, 160) // unsupported type for %q: \'%q\'
+TRANSLATION("unsupported type for operator", 29, 202, 198, 113, 134, 121, 58, 137, 235, 6, 55, 103, 13, 131, 114, 150, 112) // unsupported type for operator
+TRANSLATION("unsupported types for %q: '%q', '%q'", 36, 202, 198, 113, 134, 121, 58, 137, 235, 7, 3, 118, 113, 167, 63, 81, 174, 156, 235, 242, 26, 233, 206, 160) // unsupported types for %q: \'%q\', \'%q\'
+TRANSLATION("value must fit in %d byte(s)", 28, 238, 86, 201, 139, 230, 36, 110, 146, 17, 70, 149, 27, 117, 39, 233, 30, 160) // value must fit in %d byte(s)
+TRANSLATION("wrong number of arguments", 25, 240, 236, 188, 5, 205, 246, 55, 13, 184, 39, 227, 55, 53, 152) // wrong number of arguments
+TRANSLATION("wrong number of values to unpack", 32, 240, 236, 188, 5, 205, 246, 55, 13, 184, 238, 86, 201, 192, 150, 25, 92, 21, 62, 0) // wrong number of values to unpack
+TRANSLATION("zero step", 9, 253, 205, 216, 68, 158, 0) // zero step
+
+// 5075 bytes worth of qstr
+// 7883 bytes worth of translations
+// 4882 bytes worth of translations compressed
+// 3001 bytes saved
@@ -13,9 +13,13 @@
 #include "py/stream.h"
 #include "py/binary.h"
 #include "py/bc.h"
+#include "py/mperrno.h"
 
 #if defined(MICROPY_UNIX_COVERAGE)
 
+#include "shared-module/sdioio/BlockCache.h"
+#include "supervisor/shared/external_flash/flash_ftl.h"
+
 // stream testing object
 typedef struct _mp_obj_streamtest_t {
     mp_obj_base_t base;
@@ -136,6 +140,279 @@ STATIC const mp_obj_type_t mp_type_stest_textio2 = {
     .locals_dict = (mp_obj_dict_t*)&rawfile_locals_dict2,
 };
 
+// RAM backed NOR flash with the FTL on top, used as a block device
+#define RAMFLASH_SECTOR_SIZE (4096)
+
+typedef struct _mp_obj_ramflash_t {
+    mp_obj_base_t base;
+    flash_ftl_t ftl;
+    flash_ftl_driver_t driver;
+    uint8_t *flash;
+    flash_ftl_sector_t *sectors;
+    uint16_t *map;
+    uint16_t sector_count;
+    // Number of programs and erases until the power is cut, -1 for never.
+    mp_int_t ops_left;
+    mp_int_t erases;
+} mp_obj_ramflash_t;
+
+STATIC bool ramflash_power(mp_obj_ramflash_t *self) {
+    if (self->ops_left == 0) {
+        return false;
+    }
+    if (self->ops_left > 0) {
+        self->ops_left--;
+    }
+    return true;
+}
+
+STATIC bool ramflash_read(void *ctx, uint32_t address, uint8_t *data, uint32_t length) {
+    mp_obj_ramflash_t *self = ctx;
+    memcpy(data, self->flash + address, length);
+    return true;
+}
+
+STATIC bool ramflash_program(void *ctx, uint32_t address, const uint8_t *data, uint32_t length) {
+    mp_obj_ramflash_t *self = ctx;
+    if (!ramflash_power(self)) {
+        return false;
+    }
+    // Programming can only clear bits.
+    for (uint32_t i = 0; i < length; i++) {
+        self->flash[address + i] &= data[i];
+    }
+    return true;
+}
+
+STATIC bool ramflash_erase(void *ctx, uint32_t sector_address) {
+    mp_obj_ramflash_t *self = ctx;
+    if (!ramflash_power(self)) {
+        return false;
+    }
+    memset(self->flash + sector_address, 0xff, RAMFLASH_SECTOR_SIZE);
+    self->erases++;
+    return true;
+}
+
+STATIC mp_obj_t ramflash_remount(mp_obj_t self_in) {
+    mp_obj_ramflash_t *self = MP_OBJ_TO_PTR(self_in);
+    self->ops_left = -1;
+    flash_ftl_init(&self->ftl, &self->driver, RAMFLASH_SECTOR_SIZE, self->sector_count, self->sectors, self->map);
+    return mp_obj_new_bool(flash_ftl_mount(&self->ftl));
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(ramflash_remount_obj, ramflash_remount);
+
+STATIC mp_obj_t ramflash_make_new(const mp_obj_type_t *type, size_t n_args, const mp_obj_t *args, mp_map_t *kw_args) {
+    mp_arg_check_num(n_args, kw_args, 1, 1, false);
+    mp_int_t sector_count = mp_obj_get_int(args[0]);
+    if (sector_count <= FLASH_FTL_SPARE_SECTORS || sector_count > 0xffff) {
+        mp_raise_ValueError(NULL);
+    }
+    mp_obj_ramflash_t *self = m_new_obj(mp_obj_ramflash_t);
+    self->base.type = type;
+    self->sector_count = sector_count;
+    self->flash = m_new(uint8_t, sector_count * RAMFLASH_SECTOR_SIZE);
+    memset(self->flash, 0xff, sector_count * RAMFLASH_SECTOR_SIZE);
+    self->sectors = m_new(flash_ftl_sector_t, sector_count);
+    self->map = m_new(uint16_t, FLASH_FTL_BLOCK_COUNT(RAMFLASH_SECTOR_SIZE, sector_count));
+    self->driver.ctx = self;
+    self->driver.read = ramflash_read;
+    self->driver.program = ramflash_program;
+    self->driver.erase = ramflash_erase;
+    self->erases = 0;
+    ramflash_remount(MP_OBJ_FROM_PTR(self));
+    return MP_OBJ_FROM_PTR(self);
+}
+
+STATIC mp_obj_t ramflash_readblocks(mp_obj_t self_in, mp_obj_t block_num, mp_obj_t buf_in) {
+    mp_obj_ramflash_t *self = MP_OBJ_TO_PTR(self_in);
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(buf_in, &bufinfo, MP_BUFFER_WRITE);
+    bool ok = flash_ftl_read_blocks(&self->ftl, bufinfo.buf, mp_obj_get_int(block_num), bufinfo.len / FLASH_FTL_BLOCK_SIZE);
+    return MP_OBJ_NEW_SMALL_INT(ok ? 0 : -MP_EIO);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_3(ramflash_readblocks_obj, ramflash_readblocks);
+
+STATIC mp_obj_t ramflash_writeblocks(mp_obj_t self_in, mp_obj_t block_num, mp_obj_t buf_in) {
+    mp_obj_ramflash_t *self = MP_OBJ_TO_PTR(self_in);
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(buf_in, &bufinfo, MP_BUFFER_READ);
+    bool ok = flash_ftl_write_blocks(&self->ftl, bufinfo.buf, mp_obj_get_int(block_num), bufinfo.len / FLASH_FTL_BLOCK_SIZE);
+    return MP_OBJ_NEW_SMALL_INT(ok ? 0 : -MP_EIO);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_3(ramflash_writeblocks_obj, ramflash_writeblocks);
+
+STATIC mp_obj_t ramflash_ioctl(mp_obj_t self_in, mp_obj_t op_in, mp_obj_t arg_in) {
+    (void)arg_in;
+    mp_obj_ramflash_t *self = MP_OBJ_TO_PTR(self_in);
+    switch (mp_obj_get_int(op_in)) {
+        case 4: // BP_IOCTL_SEC_COUNT
+            return MP_OBJ_NEW_SMALL_INT(self->ftl.block_count);
+        case 5: // BP_IOCTL_SEC_SIZE
+            return MP_OBJ_NEW_SMALL_INT(FLASH_FTL_BLOCK_SIZE);
+        default:
+            return MP_OBJ_NEW_SMALL_INT(0);
+    }
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_3(ramflash_ioctl_obj, ramflash_ioctl);
+
+// Cut the power after the given number of programs and erases.
+STATIC mp_obj_t ramflash_fail_after(mp_obj_t self_in, mp_obj_t ops_in) {
+    mp_obj_ramflash_t *self = MP_OBJ_TO_PTR(self_in);
+    self->ops_left = mp_obj_get_int(ops_in);
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_2(ramflash_fail_after_obj, ramflash_fail_after);
+
+// Returns (total erases, least erased sector's count, most erased sector's count).
+STATIC mp_obj_t ramflash_wear(mp_obj_t self_in) {
+    mp_obj_ramflash_t *self = MP_OBJ_TO_PTR(self_in);
+    uint16_t min_count, max_count;
+    flash_ftl_erase_count_range(&self->ftl, &min_count, &max_count);
+    mp_obj_t items[3] = {
+        mp_obj_new_int(self->erases),
+        MP_OBJ_NEW_SMALL_INT(min_count),
+        MP_OBJ_NEW_SMALL_INT(max_count),
+    };
+    return mp_obj_new_tuple(3, items);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(ramflash_wear_obj, ramflash_wear);
+
+STATIC const mp_rom_map_elem_t ramflash_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_readblocks), MP_ROM_PTR(&ramflash_readblocks_obj) },
+    { MP_ROM_QSTR(MP_QSTR_writeblocks), MP_ROM_PTR(&ramflash_writeblocks_obj) },
+    { MP_ROM_QSTR(MP_QSTR_ioctl), MP_ROM_PTR(&ramflash_ioctl_obj) },
+    { MP_ROM_QSTR(MP_QSTR_remount), MP_ROM_PTR(&ramflash_remount_obj) },
+    { MP_ROM_QSTR(MP_QSTR_fail_after), MP_ROM_PTR(&ramflash_fail_after_obj) },
+    { MP_ROM_QSTR(MP_QSTR_wear), MP_ROM_PTR(&ramflash_wear_obj) },
+};
+
+STATIC MP_DEFINE_CONST_DICT(ramflash_locals_dict, ramflash_locals_dict_table);
+
+const mp_obj_type_t mp_type_ftl_ramflash = {
+    { &mp_type_type },
+    .name = MP_QSTR_FTLRamFlash,
+    .make_new = ramflash_make_new,
+    .locals_dict = (mp_obj_dict_t*)&ramflash_locals_dict,
+};
+
+// SD card model behind the sdioio block cache, counting the commands issued
+typedef struct _mp_obj_simsdcard_t {
+    mp_obj_base_t base;
+    sdioio_block_cache_t cache;
+    uint8_t *data;
+    uint32_t block_count;
+    mp_int_t read_cmds;
+    mp_int_t write_cmds;
+} mp_obj_simsdcard_t;
+
+STATIC int simsdcard_card_readblocks(void *dev, uint32_t start_block, uint8_t *buf, uint32_t num_blocks) {
+    mp_obj_simsdcard_t *self = dev;
+    if (start_block + num_blocks > self->block_count) {
+        return -MP_EIO;
+    }
+    memcpy(buf, self->data + start_block * SDIOIO_BLOCK_SIZE, num_blocks * SDIOIO_BLOCK_SIZE);
+    self->read_cmds++;
+    return 0;
+}
+
+STATIC int simsdcard_card_writeblocks(void *dev, uint32_t start_block, const uint8_t *buf, uint32_t num_blocks) {
+    mp_obj_simsdcard_t *self = dev;
+    if (start_block + num_blocks > self->block_count) {
+        return -MP_EIO;
+    }
+    memcpy(self->data + start_block * SDIOIO_BLOCK_SIZE, buf, num_blocks * SDIOIO_BLOCK_SIZE);
+    self->write_cmds++;
+    return 0;
+}
+
+STATIC const sdioio_block_cache_io_t simsdcard_io = {
+    .readblocks = simsdcard_card_readblocks,
+    .writeblocks = simsdcard_card_writeblocks,
+};
+
+STATIC mp_obj_t simsdcard_make_new(const mp_obj_type_t *type, size_t n_args, const mp_obj_t *args, mp_map_t *kw_args) {
+    mp_arg_check_num(n_args, kw_args, 2, 2, false);
+    mp_obj_simsdcard_t *self = m_new_obj(mp_obj_simsdcard_t);
+    self->base.type = type;
+    self->block_count = mp_obj_get_int(args[0]);
+    self->data = m_new(uint8_t, self->block_count * SDIOIO_BLOCK_SIZE);
+    memset(self->data, 0, self->block_count * SDIOIO_BLOCK_SIZE);
+    self->read_cmds = 0;
+    self->write_cmds = 0;
+    sdioio_block_cache_init(&self->cache, &simsdcard_io, self, self->block_count, mp_obj_get_int(args[1]));
+    return MP_OBJ_FROM_PTR(self);
+}
+
+STATIC mp_obj_t simsdcard_count(mp_obj_t self_in) {
+    mp_obj_simsdcard_t *self = MP_OBJ_TO_PTR(self_in);
+    return mp_obj_new_int(self->block_count);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(simsdcard_count_obj, simsdcard_count);
+
+STATIC mp_obj_t simsdcard_readblocks(mp_obj_t self_in, mp_obj_t block_num, mp_obj_t buf_in) {
+    mp_obj_simsdcard_t *self = MP_OBJ_TO_PTR(self_in);
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(buf_in, &bufinfo, MP_BUFFER_WRITE);
+    int r = sdioio_block_cache_readblocks(&self->cache, mp_obj_get_int(block_num), bufinfo.buf, bufinfo.len / SDIOIO_BLOCK_SIZE);
+    if (r < 0) {
+        mp_raise_OSError(-r);
+    }
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_3(simsdcard_readblocks_obj, simsdcard_readblocks);
+
+STATIC mp_obj_t simsdcard_writeblocks(mp_obj_t self_in, mp_obj_t block_num, mp_obj_t buf_in) {
+    mp_obj_simsdcard_t *self = MP_OBJ_TO_PTR(self_in);
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(buf_in, &bufinfo, MP_BUFFER_READ);
+    int r = sdioio_block_cache_writeblocks(&self->cache, mp_obj_get_int(block_num), bufinfo.buf, bufinfo.len / SDIOIO_BLOCK_SIZE);
+    if (r < 0) {
+        mp_raise_OSError(-r);
+    }
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_3(simsdcard_writeblocks_obj, simsdcard_writeblocks);
+
+STATIC mp_obj_t simsdcard_sync(mp_obj_t self_in) {
+    mp_obj_simsdcard_t *self = MP_OBJ_TO_PTR(self_in);
+    int r = sdioio_block_cache_flush(&self->cache);
+    if (r < 0) {
+        mp_raise_OSError(-r);
+    }
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(simsdcard_sync_obj, simsdcard_sync);
+
+// Returns (read commands, write commands) and what's on the card itself.
+STATIC mp_obj_t simsdcard_card(mp_obj_t self_in) {
+    mp_obj_simsdcard_t *self = MP_OBJ_TO_PTR(self_in);
+    mp_obj_t items[3] = {
+        mp_obj_new_int(self->read_cmds),
+        mp_obj_new_int(self->write_cmds),
+        mp_obj_new_bytearray_by_ref(self->block_count * SDIOIO_BLOCK_SIZE, self->data),
+    };
+    return mp_obj_new_tuple(3, items);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(simsdcard_card_obj, simsdcard_card);
+
+STATIC const mp_rom_map_elem_t simsdcard_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_count), MP_ROM_PTR(&simsdcard_count_obj) },
+    { MP_ROM_QSTR(MP_QSTR_readblocks), MP_ROM_PTR(&simsdcard_readblocks_obj) },
+    { MP_ROM_QSTR(MP_QSTR_writeblocks), MP_ROM_PTR(&simsdcard_writeblocks_obj) },
+    { MP_ROM_QSTR(MP_QSTR_sync), MP_ROM_PTR(&simsdcard_sync_obj) },
+    { MP_ROM_QSTR(MP_QSTR_card), MP_ROM_PTR(&simsdcard_card_obj) },
+};
+
+STATIC MP_DEFINE_CONST_DICT(simsdcard_locals_dict, simsdcard_locals_dict_table);
+
+const mp_obj_type_t mp_type_simsdcard = {
+    { &mp_type_type },
+    .name = MP_QSTR_SimSDCard,
+    .make_new = simsdcard_make_new,
+    .locals_dict = (mp_obj_dict_t*)&simsdcard_locals_dict,
+};
+
 // str/bytes objects without a valid hash
 STATIC const mp_obj_str_t str_no_hash_obj = {{&mp_type_str}, 0, 10, (const byte*)"0123456789"};
 STATIC const mp_obj_str_t bytes_no_hash_obj = {{&mp_type_bytes}, 0, 10, (const byte*)"0123456789"};
@@ -176,7 +453,7 @@ STATIC mp_obj_t extra_coverage(void) {
 
         // using gc_realloc to resize to 0, which means free the memory
         void *p = gc_alloc(4, false, false);
-        mp_printf(&mp_plat_print, "%p\n", gc_realloc(p, 0, false));
+        mp_printf(&mp_plat_print, "%p\n", gc_realloc(p, 0, false, false));
 
         // calling gc_nbytes with a non-heap pointer
         mp_printf(&mp_plat_print, "%p\n", gc_nbytes(NULL));
@@ -520,6 +520,10 @@ MP_NOINLINE int main_(int argc, char **argv) {
     {
         MP_DECLARE_CONST_FUN_OBJ_0(extra_coverage_obj);
         mp_store_global(QSTR_FROM_STR_STATIC("extra_coverage"), MP_OBJ_FROM_PTR(&extra_coverage_obj));
+        extern const mp_obj_type_t mp_type_ftl_ramflash;
+        mp_store_global(MP_QSTR_FTLRamFlash, MP_OBJ_FROM_PTR(&mp_type_ftl_ramflash));
+        extern const mp_obj_type_t mp_type_simsdcard;
+        mp_store_global(MP_QSTR_SimSDCard, MP_OBJ_FROM_PTR(&mp_type_simsdcard));
     }
     #endif
 
@@ -46,6 +46,8 @@
 #define MICROPY_COMP_MODULE_CONST   (1)
 #define MICROPY_COMP_TRIPLE_TUPLE_ASSIGN (1)
 #define MICROPY_COMP_RETURN_IF_EXPR (1)
+#define MICROPY_COMP_PEEPHOLE       (1)
+#define MICROPY_COMPILE_ARENA       (1)
 #define MICROPY_ENABLE_GC           (1)
 #define MICROPY_ENABLE_FINALISER    (1)
 #define MICROPY_STACK_CHECK         (1)
@@ -64,6 +66,8 @@
 #define MICROPY_ENABLE_SOURCE_LINE  (1)
 #define MICROPY_FLOAT_IMPL          (MICROPY_FLOAT_IMPL_DOUBLE)
 #define MICROPY_LONGINT_IMPL        (MICROPY_LONGINT_IMPL_MPZ)
+#define MICROPY_OPT_MPZ_FAST_MUL    (1)
+#define MICROPY_OPT_MPZ_FAST_STR    (1)
 #define MICROPY_STREAMS_NON_BLOCK   (1)
 #define MICROPY_STREAMS_POSIX_API   (1)
 #define MICROPY_OPT_COMPUTED_GOTO   (1)
@@ -79,6 +83,7 @@
 #define MICROPY_PY_BUILTINS_STR_SPLITLINES (1)
 #define MICROPY_PY_BUILTINS_MEMORYVIEW (1)
 #define MICROPY_PY_BUILTINS_FROZENSET (1)
+#define MICROPY_PY_BUILTINS_LIST_SORT_STABLE (1)
 #define MICROPY_PY_BUILTINS_COMPILE (1)
 #define MICROPY_PY_BUILTINS_NOTIMPLEMENTED (1)
 #define MICROPY_PY_BUILTINS_INPUT   (1)
@@ -120,8 +125,12 @@
 #define MICROPY_PY_UERRNO           (1)
 #define MICROPY_PY_UCTYPES          (1)
 #define MICROPY_PY_UZLIB            (1)
+#define MICROPY_PY_UZLIB_COMPIO     (1)
 #define MICROPY_PY_UJSON            (1)
+#define MICROPY_PY_UJSON_PARSER     (1)
 #define MICROPY_PY_URE              (1)
+#define MICROPY_PY_URE_CACHE_SIZE   (8)
+#define MICROPY_PY_URE_PREFILTER    (1)
 #define MICROPY_PY_UHEAPQ           (1)
 #define MICROPY_PY_UTIMEQ           (1)
 #define MICROPY_PY_UHASHLIB         (1)
@@ -210,6 +219,13 @@ extern const struct _mp_obj_module_t mp_module_jni;
 #else
 #define MICROPY_PY_SOCKET_DEF
 #endif
+#if defined(MICROPY_UNIX_COVERAGE)
+// CircuitPython's struct module, under a name that leaves struct alone
+extern const struct _mp_obj_module_t struct_module;
+#define MICROPY_PY_CPSTRUCT_DEF { MP_ROM_QSTR(MP_QSTR__cpstruct), MP_ROM_PTR(&struct_module) },
+#else
+#define MICROPY_PY_CPSTRUCT_DEF
+#endif
 #if MICROPY_PY_USELECT_POSIX
 #define MICROPY_PY_USELECT_DEF { MP_ROM_QSTR(MP_QSTR_uselect), MP_ROM_PTR(&mp_module_uselect) },
 #else
@@ -225,6 +241,7 @@ extern const struct _mp_obj_module_t mp_module_jni;
     MICROPY_PY_UOS_DEF \
     MICROPY_PY_USELECT_DEF \
     MICROPY_PY_TERMIOS_DEF \
+    MICROPY_PY_CPSTRUCT_DEF \
 
 // type definitions for the specific machine
 
@@ -48,6 +48,9 @@
 #undef MICROPY_VFS_FAT
 #define MICROPY_VFS_FAT                (1)
 #define MICROPY_FATFS_USE_LABEL        (1)
+#define MICROPY_VFS_MMAP               (1)
+#define MICROPY_VFS_FAT_ASYNC          (1)
+#define MICROPY_VFS_FAT_BENCHMARK      (1)
 #define MICROPY_PY_FRAMEBUF            (1)
 #define MICROPY_PY_COLLECTIONS_NAMEDTUPLE__ASDICT (1)
 
@@ -38,3 +38,9 @@
 // synthetic benchmarking
 #undef MICROPY_MODULE_FROZEN_STR
 #define MICROPY_MODULE_FROZEN_STR (0)
+
+// Fuse common bytecode sequences into superinstructions
+#define MICROPY_OPT_BC_SUPERINSTRUCTIONS (1)
+
+// Recompile hot functions with the native emitter
+#define MICROPY_EMIT_NATIVE_TIERING (1)
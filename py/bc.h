@@ -116,6 +116,23 @@ const byte *mp_bytecode_print_str(const byte *ip);
 
 uint mp_opcode_format(const byte *ip, size_t *opcode_size);
 
+// .mpy files are saved with each qstr slot in the bytecode holding this flag
+// plus the index of a constant table entry, so that the bytecode can be run
+// directly from memory-mapped flash and the loader only has to fill in the
+// constant table with the runtime qstrs
+#define MP_BC_QSTR_IN_CONST_TABLE (0x8000)
+
+#endif
+
+#if MICROPY_PERSISTENT_CODE_LOAD_XIP
+static inline qstr mp_bc_resolve_qstr(qstr qst, const mp_uint_t *const_table) {
+    if (qst & MP_BC_QSTR_IN_CONST_TABLE) {
+        qst = MP_OBJ_QSTR_VALUE((mp_obj_t)const_table[qst & ~MP_BC_QSTR_IN_CONST_TABLE]);
+    }
+    return qst;
+}
+#else
+#define mp_bc_resolve_qstr(qst, const_table) (qst)
 #endif
 
 #endif // MICROPY_INCLUDED_PY_BC_H
@@ -116,4 +116,11 @@
 #define MP_BC_UNARY_OP_MULTI             (0xd0) // + op(<MP_UNARY_OP_NUM_BYTECODE)
 #define MP_BC_BINARY_OP_MULTI            (0xd7) // + op(<MP_BINARY_OP_NUM_BYTECODE)
 
+// Superinstructions, only emitted when MICROPY_OPT_BC_SUPERINSTRUCTIONS is enabled.
+#define MP_BC_BINARY_OP_SMALL_INT           (0x13) // byte op; signed var-int
+#define MP_BC_LOAD_FAST_BINARY_OP_SMALL_INT (0x15) // byte local; byte op; signed var-int
+#define MP_BC_LOAD_FAST_LOAD_ATTR           (0x2c) // byte local; qstr
+#define MP_BC_COMPARE_POP_JUMP_IF_TRUE      (0x3a) // byte op; rel byte code offset, 16-bit signed, in excess
+#define MP_BC_COMPARE_POP_JUMP_IF_FALSE     (0x3b) // byte op; rel byte code offset, 16-bit signed, in excess
+
 #endif // MICROPY_INCLUDED_PY_BC0_H
@@ -38,6 +38,11 @@
 #include "py/builtin.h"
 #include "py/frozenmod.h"
 
+#if MICROPY_MODULE_BYTECODE_CACHE || (MICROPY_PERSISTENT_CODE_LOAD_XIP && MICROPY_VFS)
+#include "py/stream.h"
+#include "extmod/vfs.h"
+#endif
+
 #include "supervisor/shared/translate.h"
 
 #if MICROPY_DEBUG_VERBOSE // print debugging info
@@ -191,6 +196,167 @@ STATIC void do_execute_raw_code(mp_obj_t module_obj, mp_raw_code_t *raw_code, co
 }
 #endif
 
+#if MICROPY_MODULE_BYTECODE_CACHE
+// The bytecode of dir/foo.py is cached in dir/.mpycache/foo.mpy.  The .mpy data
+// is preceded by a key made from the size and mtime of the source it was compiled
+// from, so an edited source is compiled again and its cache rewritten.  Errors
+// from the cache are never raised: the module is simply compiled as normal.
+
+#define BYTECODE_CACHE_DIR ".mpycache"
+#define BYTECODE_CACHE_KEY_LEN (8)
+
+STATIC bool bytecode_cache_key(const char *file_str, byte *key) {
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) == 0) {
+        mp_obj_tuple_t *st = MP_OBJ_TO_PTR(mp_vfs_stat(mp_obj_new_str(file_str, strlen(file_str))));
+        mp_uint_t size = mp_obj_get_int_truncated(st->items[6]);
+        mp_uint_t mtime = mp_obj_get_int_truncated(st->items[8]);
+        nlr_pop();
+        for (size_t i = 0; i < 4; ++i) {
+            key[i] = size >> (8 * i);
+            key[4 + i] = mtime >> (8 * i);
+        }
+        return true;
+    }
+    return false;
+}
+
+// Makes dir/.mpycache/foo.mpy from dir/foo.py, leaving the length of the
+// directory part in *dir_len.
+STATIC void bytecode_cache_path(vstr_t *path, const char *file_str, size_t *dir_len) {
+    const char *base = strrchr(file_str, PATH_SEP_CHAR);
+    base = base == NULL ? file_str : base + 1;
+    vstr_add_strn(path, file_str, base - file_str);
+    vstr_add_str(path, BYTECODE_CACHE_DIR);
+    *dir_len = path->len;
+    vstr_add_char(path, PATH_SEP_CHAR);
+    vstr_add_strn(path, base, strlen(base) - 3);
+    vstr_add_str(path, ".mpy");
+}
+
+STATIC mp_raw_code_t *bytecode_cache_load(const char *cache_str, const byte *key) {
+    mp_reader_t reader;
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) == 0) {
+        mp_reader_new_file(&reader, cache_str);
+        nlr_pop();
+    } else {
+        // no cache file
+        return NULL;
+    }
+    if (nlr_push(&nlr) == 0) {
+        bool match = true;
+        for (size_t i = 0; i < BYTECODE_CACHE_KEY_LEN; ++i) {
+            if (reader.readbyte(reader.data) != key[i]) {
+                match = false;
+            }
+        }
+        mp_raw_code_t *raw_code = NULL;
+        if (match) {
+            // closes the reader once it has loaded everything
+            raw_code = mp_raw_code_load(&reader);
+        } else {
+            reader.close(reader.data);
+        }
+        nlr_pop();
+        return raw_code;
+    } else {
+        // eg the cache is truncated or from another version
+        reader.close(reader.data);
+        return NULL;
+    }
+}
+
+STATIC void bytecode_cache_save(mp_raw_code_t *raw_code, vstr_t *cache_path, size_t dir_len, const byte *key) {
+    mp_obj_t path = mp_obj_new_str(vstr_str(cache_path), cache_path->len);
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) == 0) {
+        mp_vfs_mkdir(mp_obj_new_str(vstr_str(cache_path), dir_len));
+        nlr_pop();
+    }
+    mp_obj_t file;
+    if (nlr_push(&nlr) == 0) {
+        mp_obj_t args[2] = {path, MP_OBJ_NEW_QSTR(MP_QSTR_wb)};
+        file = mp_vfs_open(MP_ARRAY_SIZE(args), args, (mp_map_t*)&mp_const_empty_map);
+        nlr_pop();
+    } else {
+        // eg the filesystem is read-only
+        return;
+    }
+    if (nlr_push(&nlr) == 0) {
+        mp_print_t print = {MP_OBJ_TO_PTR(file), mp_raw_code_stream_print_strn};
+        print.print_strn(print.data, (const char*)key, BYTECODE_CACHE_KEY_LEN);
+        mp_raw_code_save(raw_code, &print);
+        mp_stream_close(file);
+        nlr_pop();
+    } else {
+        // eg the filesystem is full or the module can't be saved; don't leave
+        // a partial cache file behind
+        if (nlr_push(&nlr) == 0) {
+            mp_stream_close(file);
+            mp_vfs_remove(path);
+            nlr_pop();
+        }
+    }
+}
+
+STATIC void do_load_with_bytecode_cache(mp_obj_t module_obj, const char *file_str) {
+    byte key[BYTECODE_CACHE_KEY_LEN];
+    vstr_t cache_path;
+    size_t dir_len;
+    mp_raw_code_t *raw_code = NULL;
+    bool have_key = bytecode_cache_key(file_str, key);
+    if (have_key) {
+        vstr_init(&cache_path, strlen(file_str) + sizeof(BYTECODE_CACHE_DIR) + 2);
+        bytecode_cache_path(&cache_path, file_str, &dir_len);
+        raw_code = bytecode_cache_load(vstr_null_terminated_str(&cache_path), key);
+    }
+    if (raw_code == NULL) {
+        mp_lexer_t *lex = mp_lexer_new_from_file(file_str);
+        qstr source_name = lex->source_name;
+        mp_parse_tree_t parse_tree = mp_parse(lex, MP_PARSE_FILE_INPUT);
+        raw_code = mp_compile_to_raw_code(&parse_tree, source_name, MP_EMIT_OPT_NONE, false);
+        if (have_key) {
+            bytecode_cache_save(raw_code, &cache_path, dir_len, key);
+        }
+    }
+    if (have_key) {
+        vstr_clear(&cache_path);
+    }
+    do_execute_raw_code(module_obj, raw_code, file_str);
+}
+#endif
+
+#if MICROPY_PERSISTENT_CODE_LOAD_XIP && MICROPY_VFS
+// Loads a .mpy file, running its bytecode in place if the filesystem can map
+// the file into memory.
+STATIC mp_raw_code_t *raw_code_load_file_xip(const char *file_str) {
+    mp_obj_t view = MP_OBJ_NULL;
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) == 0) {
+        mp_obj_t args[2] = {mp_obj_new_str(file_str, strlen(file_str)), MP_OBJ_NEW_QSTR(MP_QSTR_rb)};
+        mp_obj_t file = mp_vfs_open(MP_ARRAY_SIZE(args), args, (mp_map_t*)&mp_const_empty_map);
+        const mp_stream_p_t *stream_p = mp_get_stream(file);
+        mp_obj_t v = MP_OBJ_NULL;
+        int errcode;
+        if (stream_p->ioctl != NULL
+            && stream_p->ioctl(file, MP_STREAM_GET_MMAP, (uintptr_t)&v, &errcode) == MP_STREAM_ERROR) {
+            v = MP_OBJ_NULL;
+        }
+        mp_stream_close(file);
+        // assigned after anything that can raise, so that view is still
+        // MP_OBJ_NULL if an exception skips the rest of this block
+        view = v;
+        nlr_pop();
+    }
+    mp_buffer_info_t bufinfo;
+    if (view == MP_OBJ_NULL || !mp_get_buffer(view, &bufinfo, MP_BUFFER_READ)) {
+        return mp_raw_code_load_file(file_str);
+    }
+    return mp_raw_code_load_xip(bufinfo.buf, bufinfo.len, view);
+}
+#endif
+
 STATIC void do_load(mp_obj_t module_obj, vstr_t *file) {
     #if MICROPY_MODULE_FROZEN || MICROPY_PERSISTENT_CODE_LOAD || MICROPY_ENABLE_COMPILER
     char *file_str = vstr_null_terminated_str(file);
@@ -232,7 +398,11 @@ STATIC void do_load(mp_obj_t module_obj, vstr_t *file) {
     // the correct format and, if so, load and execute the file.
     #if MICROPY_PERSISTENT_CODE_LOAD
     if (file_str[file->len - 3] == 'm') {
+        #if MICROPY_PERSISTENT_CODE_LOAD_XIP && MICROPY_VFS
+        mp_raw_code_t *raw_code = raw_code_load_file_xip(file_str);
+        #else
         mp_raw_code_t *raw_code = mp_raw_code_load_file(file_str);
+        #endif
         do_execute_raw_code(module_obj, raw_code, file_str);
         return;
     }
@@ -241,6 +411,10 @@ STATIC void do_load(mp_obj_t module_obj, vstr_t *file) {
     // If we can compile scripts then load the file and compile and execute it.
     #if MICROPY_ENABLE_COMPILER
     {
+        #if MICROPY_MODULE_BYTECODE_CACHE
+        do_load_with_bytecode_cache(module_obj, file_str);
+        return;
+        #endif
         mp_lexer_t *lex = mp_lexer_new_from_file(file_str);
         do_load_from_lexer(module_obj, lex);
         return;
@@ -415,10 +415,12 @@ SRC_SHARED_MODULE_ALL = \
 	random/__init__.c \
 	rgbmatrix/RGBMatrix.c \
 	rgbmatrix/__init__.c \
+	sdioio/BlockCache.c \
 	sharpdisplay/SharpMemoryFramebuffer.c \
 	sharpdisplay/__init__.c \
 	socket/__init__.c \
 	storage/__init__.c \
+	struct/Struct.c \
 	struct/__init__.c \
 	terminalio/Terminal.c \
 	terminalio/__init__.c \
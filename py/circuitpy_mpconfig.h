@@ -52,6 +52,7 @@
 // default is 512.
 #define MICROPY_ALLOC_PATH_MAX           (256)
 #define MICROPY_CAN_OVERRIDE_BUILTINS    (1)
+#define MICROPY_COMPILE_ARENA            (1)
 #define MICROPY_COMP_CONST               (1)
 #define MICROPY_COMP_DOUBLE_TUPLE_ASSIGN (1)
 #define MICROPY_COMP_MODULE_CONST        (1)
@@ -73,9 +74,12 @@
 #define MICROPY_KBD_EXCEPTION            (1)
 #define MICROPY_MEM_STATS                (0)
 #define MICROPY_MODULE_BUILTIN_INIT      (1)
+#define MICROPY_MODULE_BYTECODE_CACHE    (CIRCUITPY_BYTECODE_CACHE)
 #define MICROPY_NONSTANDARD_TYPECODES    (0)
 #define MICROPY_OPT_COMPUTED_GOTO        (1)
 #define MICROPY_PERSISTENT_CODE_LOAD     (1)
+#define MICROPY_PERSISTENT_CODE_LOAD_XIP (CIRCUITPY_PERSISTENT_CODE_XIP)
+#define MICROPY_PERSISTENT_CODE_SAVE     (CIRCUITPY_BYTECODE_CACHE)
 
 #define MICROPY_PY_ARRAY                 (1)
 #define MICROPY_PY_ARRAY_SLICE_ASSIGN    (1)
@@ -143,6 +147,9 @@
 #define MICROPY_VFS                 (1)
 #define MICROPY_VFS_FAT             (MICROPY_VFS)
 #define MICROPY_READER_VFS          (MICROPY_VFS)
+#define MICROPY_VFS_MMAP            (CIRCUITPY_FULL_BUILD)
+#define MICROPY_VFS_FAT_ASYNC       (CIRCUITPY_FULL_BUILD)
+#define MICROPY_VFS_FAT_BENCHMARK   (CIRCUITPY_FULL_BUILD)
 
 // type definitions for the specific machine
 
@@ -186,22 +193,27 @@ typedef long mp_off_t;
 #define MICROPY_BUILTIN_METHOD_CHECK_SELF_ARG (CIRCUITPY_FULL_BUILD)
 #define MICROPY_CPYTHON_COMPAT                (CIRCUITPY_FULL_BUILD)
 #define MICROPY_COMP_FSTRING_LITERAL          (MICROPY_CPYTHON_COMPAT)
+#define MICROPY_COMP_PEEPHOLE                 (CIRCUITPY_FULL_BUILD)
 #define MICROPY_MODULE_WEAK_LINKS             (CIRCUITPY_FULL_BUILD)
 #define MICROPY_PY_ALL_SPECIAL_METHODS        (CIRCUITPY_FULL_BUILD)
 #define MICROPY_PY_BUILTINS_COMPLEX           (CIRCUITPY_FULL_BUILD)
 #define MICROPY_PY_BUILTINS_FROZENSET         (CIRCUITPY_FULL_BUILD)
+#define MICROPY_PY_BUILTINS_LIST_SORT_STABLE  (CIRCUITPY_FULL_BUILD)
 #define MICROPY_PY_BUILTINS_STR_CENTER        (CIRCUITPY_FULL_BUILD)
 #define MICROPY_PY_BUILTINS_STR_PARTITION     (CIRCUITPY_FULL_BUILD)
 #define MICROPY_PY_BUILTINS_STR_SPLITLINES    (CIRCUITPY_FULL_BUILD)
 #define MICROPY_PY_UERRNO                     (CIRCUITPY_FULL_BUILD)
 // Opposite setting is deliberate.
 #define MICROPY_PY_UERRNO_ERRORCODE           (!CIRCUITPY_FULL_BUILD)
+#define MICROPY_PY_UJSON_PARSER               (CIRCUITPY_FULL_BUILD)
 #ifndef MICROPY_PY_URE
 #define MICROPY_PY_URE                        (CIRCUITPY_FULL_BUILD)
 #endif
 #define MICROPY_PY_URE_MATCH_GROUPS           (CIRCUITPY_FULL_BUILD)
 #define MICROPY_PY_URE_MATCH_SPAN_START_END   (CIRCUITPY_FULL_BUILD)
 #define MICROPY_PY_URE_SUB                    (CIRCUITPY_FULL_BUILD)
+#define MICROPY_PY_URE_CACHE_SIZE             (CIRCUITPY_FULL_BUILD ? 4 : 0)
+#define MICROPY_PY_URE_PREFILTER              (CIRCUITPY_FULL_BUILD)
 
 // LONGINT_IMPL_xxx are defined in the Makefile.
 //
@@ -211,6 +223,8 @@ typedef long mp_off_t;
 
 #ifdef LONGINT_IMPL_MPZ
 #define MICROPY_LONGINT_IMPL (MICROPY_LONGINT_IMPL_MPZ)
+#define MICROPY_OPT_MPZ_FAST_MUL (CIRCUITPY_FULL_BUILD)
+#define MICROPY_OPT_MPZ_FAST_STR (CIRCUITPY_FULL_BUILD)
 #define MP_SSIZE_MAX (0x7fffffff)
 #endif
 
@@ -810,6 +824,18 @@ void supervisor_run_background_tasks_if_tick(void);
 #define CIRCUITPY_FILESYSTEM_FLUSH_INTERVAL_MS 1000
 #endif
 
+// Number of blocks written over USB mass storage that are staged in RAM and
+// committed together. Each costs 512 bytes of static RAM, so ports opt in.
+// 0 writes each block while the host waits for it.
+#ifndef CIRCUITPY_USB_MSC_WRITE_CACHE_BLOCKS
+#define CIRCUITPY_USB_MSC_WRITE_CACHE_BLOCKS (0)
+#endif
+
+// Staged blocks are committed once the host hasn't written for this long.
+#ifndef CIRCUITPY_USB_MSC_WRITE_CACHE_IDLE_MS
+#define CIRCUITPY_USB_MSC_WRITE_CACHE_IDLE_MS (20)
+#endif
+
 #ifndef CIRCUITPY_PYSTACK_SIZE
 #define CIRCUITPY_PYSTACK_SIZE 1536
 #endif
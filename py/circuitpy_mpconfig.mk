@@ -257,3 +257,20 @@ CFLAGS += -DCIRCUITPY_WATCHDOG=$(CIRCUITPY_WATCHDOG)
 # Enabled micropython.native decorator (experimental)
 CIRCUITPY_ENABLE_MPY_NATIVE ?= 0
 CFLAGS += -DCIRCUITPY_ENABLE_MPY_NATIVE=$(CIRCUITPY_ENABLE_MPY_NATIVE)
+
+# Cache the bytecode of imported .py files in .mpycache on CIRCUITPY so they
+# are only compiled again after an edit. Also enables saving .mpy data, which
+# turns off the peephole optimiser.
+CIRCUITPY_BYTECODE_CACHE ?= $(CIRCUITPY_FULL_BUILD)
+CFLAGS += -DCIRCUITPY_BYTECODE_CACHE=$(CIRCUITPY_BYTECODE_CACHE)
+
+# Run the bytecode of .mpy files in place when CIRCUITPY is memory mapped.
+# Enabled by ports whose internal flash implements
+# supervisor_flash_get_block_address.
+CIRCUITPY_PERSISTENT_CODE_XIP ?= 0
+CFLAGS += -DCIRCUITPY_PERSISTENT_CODE_XIP=$(CIRCUITPY_PERSISTENT_CODE_XIP)
+
+# Log structured flash translation layer with wear leveling under the
+# external flash filesystem. Changes the on-flash format.
+CIRCUITPY_EXTERNAL_FLASH_FTL ?= 0
+CFLAGS += -DCIRCUITPY_EXTERNAL_FLASH_FTL=$(CIRCUITPY_EXTERNAL_FLASH_FTL)
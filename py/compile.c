@@ -35,6 +35,8 @@
 #include "py/compile.h"
 #include "py/runtime.h"
 #include "py/asmbase.h"
+#include "py/bc.h"
+#include "py/objtuple.h"
 
 #include "supervisor/shared/translate.h"
 
@@ -147,6 +149,12 @@ typedef struct _compiler_t {
     emit_inline_asm_t *emit_inline_asm;                                   // current emitter for inline asm
     const emit_inline_asm_method_table_t *emit_inline_asm_method_table;   // current emit method table for inline asm
     #endif
+
+    #if MICROPY_EMIT_NATIVE_TIERING
+    qstr tier_name;             // name and line of the function being tiered up,
+    size_t tier_line;           // or 0 for a normal compile
+    scope_t *tier_scope;        // scope of that function, once found
+    #endif
 } compiler_t;
 
 STATIC void compile_error_set_line(compiler_t *comp, mp_parse_node_t pn) {
@@ -167,6 +175,7 @@ STATIC void compile_syntax_error(compiler_t *comp, mp_parse_node_t pn, const com
 STATIC void compile_trailer_paren_helper(compiler_t *comp, mp_parse_node_t pn_arglist, bool is_method_call, int n_positional_extra);
 STATIC void compile_comprehension(compiler_t *comp, mp_parse_node_struct_t *pns, scope_kind_t kind);
 STATIC void compile_node(compiler_t *comp, mp_parse_node_t pn);
+STATIC mp_obj_t get_const_object(mp_parse_node_struct_t *pns);
 
 STATIC uint comp_next_label(compiler_t *comp) {
     return comp->next_label++;
@@ -186,6 +195,14 @@ STATIC void compile_decrease_except_level(compiler_t *comp) {
 
 STATIC scope_t *scope_new_and_link(compiler_t *comp, scope_kind_t kind, mp_parse_node_t pn, uint emit_options) {
     scope_t *scope = scope_new(kind, pn, comp->source_file, emit_options);
+    #if MICROPY_EMIT_NATIVE_TIERING
+    if (kind == SCOPE_FUNCTION && comp->tier_line != 0 && scope->simple_name == comp->tier_name
+        && ((mp_parse_node_struct_t*)pn)->source_line == comp->tier_line) {
+        scope->emit_options = MP_EMIT_OPT_NATIVE_PYTHON;
+        scope->tier_up = true;
+        comp->tier_scope = scope;
+    }
+    #endif
     scope->parent = comp->scope_cur;
     scope->next = NULL;
     if (comp->scope_head == NULL) {
@@ -262,7 +279,99 @@ STATIC void compile_delete_id(compiler_t *comp, qstr qst) {
     }
 }
 
+#if MICROPY_COMP_PEEPHOLE && !MICROPY_PERSISTENT_CODE_SAVE
+// Tuples whose items are all literal constants are built once, at compile
+// time.  This can't be done when saving .mpy files because they have no way
+// to store a tuple constant.
+
+STATIC bool c_tuple_item_is_const(mp_parse_node_t pn) {
+    if (MP_PARSE_NODE_IS_SMALL_INT(pn)) {
+        return true;
+    } else if (MP_PARSE_NODE_IS_LEAF(pn)) {
+        switch (MP_PARSE_NODE_LEAF_KIND(pn)) {
+            case MP_PARSE_NODE_STRING:
+            case MP_PARSE_NODE_BYTES:
+                return true;
+            case MP_PARSE_NODE_TOKEN: {
+                uintptr_t tok = MP_PARSE_NODE_LEAF_ARG(pn);
+                return tok == MP_TOKEN_KW_NONE || tok == MP_TOKEN_KW_FALSE
+                    || tok == MP_TOKEN_KW_TRUE || tok == MP_TOKEN_ELLIPSIS;
+            }
+            default:
+                return false;
+        }
+    } else {
+        return MP_PARSE_NODE_IS_STRUCT_KIND(pn, PN_const_object);
+    }
+}
+
+STATIC mp_obj_t c_tuple_item_to_obj(mp_parse_node_t pn) {
+    if (MP_PARSE_NODE_IS_SMALL_INT(pn)) {
+        return MP_OBJ_NEW_SMALL_INT(MP_PARSE_NODE_LEAF_SMALL_INT(pn));
+    } else if (MP_PARSE_NODE_IS_LEAF(pn)) {
+        uintptr_t arg = MP_PARSE_NODE_LEAF_ARG(pn);
+        switch (MP_PARSE_NODE_LEAF_KIND(pn)) {
+            case MP_PARSE_NODE_STRING:
+                return MP_OBJ_NEW_QSTR(arg);
+            case MP_PARSE_NODE_BYTES: {
+                size_t len;
+                const byte *data = qstr_data(arg, &len);
+                return mp_obj_new_bytes(data, len);
+            }
+            default:
+                switch (arg) {
+                    case MP_TOKEN_KW_NONE: return mp_const_none;
+                    case MP_TOKEN_KW_FALSE: return mp_const_false;
+                    case MP_TOKEN_KW_TRUE: return mp_const_true;
+                    default: return MP_OBJ_FROM_PTR(&mp_const_ellipsis_obj);
+                }
+        }
+    } else {
+        return get_const_object((mp_parse_node_struct_t*)pn);
+    }
+}
+
+STATIC bool c_tuple_const(compiler_t *comp, mp_parse_node_t pn, mp_parse_node_struct_t *pns_list) {
+    size_t n = 0;
+    mp_parse_node_t *items = NULL;
+    if (pns_list != NULL) {
+        n = MP_PARSE_NODE_STRUCT_NUM_NODES(pns_list);
+        items = pns_list->nodes;
+    }
+    if (!MP_PARSE_NODE_IS_NULL(pn) && !c_tuple_item_is_const(pn)) {
+        return false;
+    }
+    for (size_t i = 0; i < n; i++) {
+        if (!c_tuple_item_is_const(items[i])) {
+            return false;
+        }
+    }
+
+    // only create the actual tuple object on the last pass
+    if (comp->pass != MP_PASS_EMIT) {
+        EMIT_ARG(load_const_obj, mp_const_none);
+        return true;
+    }
+    size_t total = n + !MP_PARSE_NODE_IS_NULL(pn);
+    mp_obj_tuple_t *tuple = MP_OBJ_TO_PTR(mp_obj_new_tuple(total, NULL));
+    size_t j = 0;
+    if (!MP_PARSE_NODE_IS_NULL(pn)) {
+        tuple->items[j++] = c_tuple_item_to_obj(pn);
+    }
+    for (size_t i = 0; i < n; i++) {
+        tuple->items[j++] = c_tuple_item_to_obj(items[i]);
+    }
+    EMIT_ARG(load_const_obj, MP_OBJ_FROM_PTR(tuple));
+    return true;
+}
+#endif
+
 STATIC void c_tuple(compiler_t *comp, mp_parse_node_t pn, mp_parse_node_struct_t *pns_list) {
+    #if MICROPY_COMP_PEEPHOLE && !MICROPY_PERSISTENT_CODE_SAVE
+    if (c_tuple_const(comp, pn, pns_list)) {
+        return;
+    }
+    #endif
     int total = 0;
     if (!MP_PARSE_NODE_IS_NULL(pn)) {
         compile_node(comp, pn);
@@ -3355,16 +3464,27 @@ STATIC void scope_compute_things(scope_t *scope) {
     }
 }
 
-#if !MICROPY_PERSISTENT_CODE_SAVE
-STATIC
+#if MICROPY_EMIT_NATIVE_TIERING
+// Whether the bytecode of this scope may later be recompiled by mp_compile_tier_up:
+// it must be a plain function, defined in a source file that can be read again.
+STATIC bool compile_scope_can_tier_up(compiler_t *comp, scope_t *scope) {
+    if (comp->tier_line != 0 || scope->kind != SCOPE_FUNCTION || scope->emit_options != MP_EMIT_OPT_NONE
+        || (scope->scope_flags & MP_SCOPE_FLAG_GENERATOR) != 0
+        || ((mp_parse_node_struct_t*)scope->pn)->source_line > 0xffff
+        || qstr_str(comp->source_file)[0] == '<') {
+        return false;
+    }
+    for (int i = 0; i < scope->id_info_len; i++) {
+        if (scope->id_info[i].kind == ID_INFO_KIND_CELL || scope->id_info[i].kind == ID_INFO_KIND_FREE) {
+            return false;
+        }
+    }
+    return true;
+}
 #endif
-mp_raw_code_t *mp_compile_to_raw_code(mp_parse_tree_t *parse_tree, qstr source_file, uint emit_opt, bool is_repl) {
-    // put compiler state on the stack, it's relatively small
-    compiler_t comp_state = {0};
-    compiler_t *comp = &comp_state;
 
-    comp->source_file = source_file;
-    comp->is_repl = is_repl;
+// the caller must initialise comp with zeros, the source file and the repl flag
+STATIC mp_raw_code_t *compile_to_raw_code(compiler_t *comp, mp_parse_tree_t *parse_tree, uint emit_opt) {
     comp->break_label = INVALID_LABEL;
     comp->continue_label = INVALID_LABEL;
 
@@ -3470,6 +3590,13 @@ mp_raw_code_t *mp_compile_to_raw_code(mp_parse_tree_t *parse_tree, qstr source_f
             if (comp->compile_error == MP_OBJ_NULL) {
                 compile_scope(comp, s, MP_PASS_EMIT);
             }
+
+            #if MICROPY_EMIT_NATIVE_TIERING
+            if (comp->compile_error == MP_OBJ_NULL && compile_scope_can_tier_up(comp, s)) {
+                s->raw_code->tier_line = ((mp_parse_node_struct_t*)s->pn)->source_line;
+                s->raw_code->tier_source_hash = parse_tree->source_hash;
+            }
+            #endif
         }
     }
 
@@ -3501,6 +3628,11 @@ mp_raw_code_t *mp_compile_to_raw_code(mp_parse_tree_t *parse_tree, qstr source_f
 
     // free the scopes
     mp_raw_code_t *outer_raw_code = module_scope->raw_code;
+    #if MICROPY_EMIT_NATIVE_TIERING
+    if (comp->tier_line != 0) {
+        outer_raw_code = comp->tier_scope == NULL ? NULL : comp->tier_scope->raw_code;
+    }
+    #endif
     for (scope_t *s = module_scope; s;) {
         scope_t *next = s->next;
         scope_free(s);
@@ -3514,6 +3646,60 @@ mp_raw_code_t *mp_compile_to_raw_code(mp_parse_tree_t *parse_tree, qstr source_f
     }
 }
 
+#if !MICROPY_PERSISTENT_CODE_SAVE
+STATIC
+#endif
+mp_raw_code_t *mp_compile_to_raw_code(mp_parse_tree_t *parse_tree, qstr source_file, uint emit_opt, bool is_repl) {
+    // put compiler state on the stack, it's relatively small
+    compiler_t comp_state = {0};
+    comp_state.source_file = source_file;
+    comp_state.is_repl = is_repl;
+    return compile_to_raw_code(&comp_state, parse_tree, emit_opt);
+}
+
+#if MICROPY_EMIT_NATIVE_TIERING
+mp_raw_code_t *mp_compile_tier_up(const mp_raw_code_t *rc) {
+    // get the function's name and source file from its code info
+    const byte *ip = rc->data.u_byte.bytecode;
+    ip = mp_decode_uint_skip(ip); // skip n_state
+    ip = mp_decode_uint_skip(ip); // skip n_exc_stack
+    ip += 4; // skip scope_flags, n_pos_args, n_kwonly_args, n_def_pos_args
+    ip = mp_decode_uint_skip(ip); // skip code_info_size
+    #if MICROPY_PERSISTENT_CODE
+    qstr simple_name = mp_bc_resolve_qstr(ip[0] | (ip[1] << 8), rc->data.u_byte.const_table);
+    qstr source_file = mp_bc_resolve_qstr(ip[2] | (ip[3] << 8), rc->data.u_byte.const_table);
+    #else
+    qstr simple_name = mp_decode_uint(&ip);
+    qstr source_file = mp_decode_uint(&ip);
+    #endif
+
+    // re-parse the source and compile it with just this function made native;
+    // any error, eg the file has gone, just means the function stays bytecode,
+    // as does a change to the file since the bytecode was compiled from it
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) == 0) {
+        mp_lexer_t *lex = mp_lexer_new_from_file(qstr_str(source_file));
+        mp_parse_tree_t parse_tree = mp_parse(lex, MP_PARSE_FILE_INPUT);
+        if (parse_tree.source_hash != rc->tier_source_hash) {
+            mp_parse_tree_clear(&parse_tree);
+            nlr_pop();
+            return NULL;
+        }
+        compiler_t comp_state = {0};
+        comp_state.source_file = source_file;
+        comp_state.tier_name = simple_name;
+        comp_state.tier_line = rc->tier_line;
+        mp_raw_code_t *native_rc = compile_to_raw_code(&comp_state, &parse_tree, MP_EMIT_OPT_NONE);
+        nlr_pop();
+        if (native_rc != NULL && native_rc->kind == MP_CODE_NATIVE_PY
+            && native_rc->scope_flags == rc->scope_flags) {
+            return native_rc;
+        }
+    }
+    return NULL;
+}
+#endif
+
 mp_obj_t mp_compile(mp_parse_tree_t *parse_tree, qstr source_file, uint emit_opt, bool is_repl) {
     mp_raw_code_t *rc = mp_compile_to_raw_code(parse_tree, source_file, emit_opt, is_repl);
     // return function that executes the outer module
@@ -39,6 +39,30 @@
 #define BYTES_FOR_INT ((BYTES_PER_WORD * 8 + 6) / 7)
 #define DUMMY_DATA_SIZE (BYTES_FOR_INT)
 
+// Superinstructions can't be saved to .mpy files, so only fuse when compiling
+// for immediate execution.
+#define EMIT_FUSE (MICROPY_OPT_BC_SUPERINSTRUCTIONS && !MICROPY_PERSISTENT_CODE_SAVE)
+
+#if MICROPY_COMP_PEEPHOLE
+// Value of label_dest[l] when the first instruction at label l is a return
+#define PEEP_LABEL_RETURN ((mp_uint_t)-2)
+// Max number of labels at one offset that are tracked for jump threading
+#define PEEP_LABEL_RUN_MAX (4)
+// Max length of a chain of jumps that is followed when threading
+#define PEEP_THREAD_MAX (8)
+#endif
+
+#if EMIT_FUSE
+// Kinds of the last instruction(s) emitted that may start a superinstruction.
+typedef enum {
+    FUSE_NONE,
+    FUSE_LOAD_FAST, // LOAD_FAST local
+    FUSE_SMALL_INT, // LOAD_CONST_SMALL_INT value
+    FUSE_LOAD_FAST_SMALL_INT, // LOAD_FAST local; LOAD_CONST_SMALL_INT value
+    FUSE_COMPARE, // BINARY_OP op, where op is a comparison
+} fuse_kind_t;
+#endif
+
 struct _emit_t {
     // Accessed as mp_obj_t, so must be aligned as such, and we rely on the
     // memory allocator returning a suitably aligned pointer.
@@ -70,6 +94,37 @@ struct _emit_t {
     uint16_t ct_cur_raw_code;
     #endif
     mp_uint_t *const_table;
+
+    #if EMIT_FUSE
+    // The candidate instruction(s) for fusing span fuse_start to fuse_end.
+    // They can only be fused with the next instruction if it starts at
+    // fuse_end, ie nothing else has been emitted in between.
+    fuse_kind_t fuse_kind;
+    byte fuse_local;
+    byte fuse_op;
+    mp_int_t fuse_int;
+    size_t fuse_start;
+    size_t fuse_end;
+    #endif
+
+    #if MICROPY_COMP_PEEPHOLE
+    // Found during MP_PASS_STACK_SIZE and used by the later passes: where
+    // each label leads (itself, the label of the unconditional jump that is
+    // the first instruction there, or PEEP_LABEL_RETURN), and a bitmap of
+    // the locals that are ever loaded or deleted.
+    mp_uint_t *label_dest;
+    byte *locals_used;
+    size_t locals_used_alloc;
+    // Labels assigned at label_run_offset, with no instruction after them yet
+    size_t label_run_offset;
+    mp_uint_t label_run_len;
+    mp_uint_t label_run[PEEP_LABEL_RUN_MAX];
+    // The instruction from peep_start to peep_end pushes a value and has no
+    // side effects, so it can be dropped if the next one just pops it.
+    bool peep_valid;
+    size_t peep_start;
+    size_t peep_end;
+    #endif
 };
 
 emit_t *emit_bc_new(void) {
@@ -80,10 +135,17 @@ emit_t *emit_bc_new(void) {
 void emit_bc_set_max_num_labels(emit_t *emit, mp_uint_t max_num_labels) {
     emit->max_num_labels = max_num_labels;
     emit->label_offsets = m_new(mp_uint_t, emit->max_num_labels);
+    #if MICROPY_COMP_PEEPHOLE
+    emit->label_dest = m_new(mp_uint_t, emit->max_num_labels);
+    #endif
 }
 
 void emit_bc_free(emit_t *emit) {
     m_del(mp_uint_t, emit->label_offsets, emit->max_num_labels);
+    #if MICROPY_COMP_PEEPHOLE
+    m_del(mp_uint_t, emit->label_dest, emit->max_num_labels);
+    m_del(byte, emit->locals_used, emit->locals_used_alloc);
+    #endif
     m_del_obj(emit_t, emit);
 }
 
@@ -306,6 +368,117 @@ STATIC void emit_write_bytecode_byte_signed_label(emit_t *emit, byte b1, mp_uint
     c[2] = bytecode_offset >> 8;
 }
 
+#if EMIT_FUSE
+// Checks if the instruction(s) immediately preceding the current position are
+// a fusable sequence of the given kind, and if so rewinds to the start of them
+// so they can be overwritten by a superinstruction.
+STATIC bool emit_fuse_take(emit_t *emit, fuse_kind_t kind) {
+    if (emit->fuse_kind != kind || emit->fuse_end != emit->bytecode_offset) {
+        return false;
+    }
+    emit->bytecode_offset = emit->fuse_start;
+    emit->fuse_kind = FUSE_NONE;
+    #if MICROPY_COMP_PEEPHOLE
+    emit->peep_valid = false;
+    #endif
+    return true;
+}
+
+STATIC void emit_fuse_mark(emit_t *emit, fuse_kind_t kind, size_t start) {
+    emit->fuse_kind = kind;
+    emit->fuse_start = start;
+    emit->fuse_end = emit->bytecode_offset;
+}
+
+STATIC void emit_write_bytecode_byte_byte_qstr(emit_t *emit, byte b1, byte b2, qstr qst) {
+    #if MICROPY_PERSISTENT_CODE
+    assert((qst >> 16) == 0);
+    byte *c = emit_get_cur_to_write_bytecode(emit, 4);
+    c[0] = b1;
+    c[1] = b2;
+    c[2] = qst;
+    c[3] = qst >> 8;
+    #else
+    emit_write_bytecode_byte_byte(emit, b1, b2);
+    emit_write_uint(emit, emit_get_cur_to_write_bytecode, qst);
+    #endif
+}
+
+STATIC void emit_write_bytecode_byte_byte_signed_label(emit_t *emit, byte b1, byte b2, mp_uint_t label) {
+    int bytecode_offset;
+    if (emit->pass < MP_PASS_EMIT) {
+        bytecode_offset = 0;
+    } else {
+        bytecode_offset = emit->label_offsets[label] - emit->bytecode_offset - 4 + 0x8000;
+    }
+    byte *c = emit_get_cur_to_write_bytecode(emit, 4);
+    c[0] = b1;
+    c[1] = b2;
+    c[2] = bytecode_offset;
+    c[3] = bytecode_offset >> 8;
+}
+#endif
+
+#if MICROPY_COMP_PEEPHOLE
+// Marks the instruction just written, which started at start, as one that
+// only pushes a value and so can be dropped if that value is popped.
+STATIC void emit_peep_mark(emit_t *emit, size_t start) {
+    emit->peep_valid = true;
+    emit->peep_start = start;
+    emit->peep_end = emit->bytecode_offset;
+}
+
+// Rewinds over the marked instruction if it is the one immediately preceding
+// the current position.
+STATIC bool emit_peep_take(emit_t *emit) {
+    if (!emit->peep_valid || emit->peep_end != emit->bytecode_offset) {
+        return false;
+    }
+    emit->bytecode_offset = emit->peep_start;
+    emit->peep_valid = false;
+    #if EMIT_FUSE
+    emit->fuse_kind = FUSE_NONE;
+    #endif
+    return true;
+}
+
+// Records that the instruction about to be written leads to dest, for any
+// labels that are assigned to the current position.
+STATIC void emit_peep_set_label_dest(emit_t *emit, mp_uint_t dest) {
+    if (emit->pass == MP_PASS_STACK_SIZE && emit->label_run_offset == emit->bytecode_offset) {
+        for (mp_uint_t i = 0; i < emit->label_run_len; ++i) {
+            emit->label_dest[emit->label_run[i]] = dest;
+        }
+    }
+}
+
+// Follows a label through any unconditional jumps found at its destination.
+STATIC mp_uint_t emit_peep_thread_label(emit_t *emit, mp_uint_t label) {
+    if (emit->pass >= MP_PASS_CODE_SIZE) {
+        for (int n = 0; n < PEEP_THREAD_MAX; ++n) {
+            mp_uint_t dest = emit->label_dest[label];
+            if (dest == label || dest == PEEP_LABEL_RETURN) {
+                break;
+            }
+            label = dest;
+        }
+    }
+    return label;
+}
+
+STATIC void emit_peep_set_local_used(emit_t *emit, mp_uint_t local_num) {
+    if (emit->pass == MP_PASS_STACK_SIZE) {
+        emit->locals_used[local_num >> 3] |= 1 << (local_num & 7);
+    }
+}
+
+// A store to a local that is never loaded or deleted can be dropped.
+STATIC bool emit_peep_is_dead_local(emit_t *emit, mp_uint_t local_num) {
+    return emit->pass >= MP_PASS_CODE_SIZE
+        && !(emit->locals_used[local_num >> 3] & (1 << (local_num & 7)));
+}
+#endif
+
 void mp_emit_bc_start_pass(emit_t *emit, pass_kind_t pass, scope_t *scope) {
     emit->pass = pass;
     emit->stack_size = 0;
@@ -321,6 +494,24 @@ void mp_emit_bc_start_pass(emit_t *emit, pass_kind_t pass, scope_t *scope) {
     #endif
     emit->bytecode_offset = 0;
     emit->code_info_offset = 0;
+    #if EMIT_FUSE
+    emit->fuse_kind = FUSE_NONE;
+    #endif
+    #if MICROPY_COMP_PEEPHOLE
+    emit->peep_valid = false;
+    emit->label_run_len = 0;
+    if (pass == MP_PASS_STACK_SIZE) {
+        for (mp_uint_t i = 0; i < emit->max_num_labels; ++i) {
+            emit->label_dest[i] = i;
+        }
+        size_t n = (scope->num_locals + 7) / 8;
+        if (n > emit->locals_used_alloc) {
+            emit->locals_used = m_renew(byte, emit->locals_used, emit->locals_used_alloc, n);
+            emit->locals_used_alloc = n;
+        }
+        memset(emit->locals_used, 0, emit->locals_used_alloc);
+    }
+    #endif
 
     // Write local state size and exception stack size.
     {
@@ -481,6 +672,13 @@ void mp_emit_bc_set_source_line(emit_t *emit, mp_uint_t source_line) {
         emit_write_code_info_bytes_lines(emit, bytes_to_skip, lines_to_skip);
         emit->last_source_line_offset = emit->bytecode_offset;
         emit->last_source_line = source_line;
+        #if EMIT_FUSE
+        // line info now points here so earlier instructions can't be rewritten
+        emit->fuse_kind = FUSE_NONE;
+        #endif
+        #if MICROPY_COMP_PEEPHOLE
+        emit->peep_valid = false;
+        #endif
     }
 #else
     (void)emit;
@@ -494,6 +692,21 @@ void mp_emit_bc_label_assign(emit_t *emit, mp_uint_t l) {
         return;
     }
     assert(l < emit->max_num_labels);
+    #if EMIT_FUSE
+    // a jump may land here so don't fuse across the label
+    emit->fuse_kind = FUSE_NONE;
+    #endif
+    #if MICROPY_COMP_PEEPHOLE
+    // likewise, don't remove instructions across the label
+    emit->peep_valid = false;
+    if (emit->label_run_len == 0 || emit->label_run_offset != emit->bytecode_offset) {
+        emit->label_run_offset = emit->bytecode_offset;
+        emit->label_run_len = 0;
+    }
+    if (emit->label_run_len < PEEP_LABEL_RUN_MAX) {
+        emit->label_run[emit->label_run_len++] = l;
+    }
+    #endif
     if (emit->pass < MP_PASS_EMIT) {
         // assign label offset
         assert(emit->label_offsets[l] == (mp_uint_t)-1);
@@ -521,6 +734,9 @@ void mp_emit_bc_import(emit_t *emit, qstr qst, int kind) {
 
 void mp_emit_bc_load_const_tok(emit_t *emit, mp_token_kind_t tok) {
     emit_bc_pre(emit, 1);
+    #if MICROPY_COMP_PEEPHOLE
+    size_t peep_start = emit->bytecode_offset;
+    #endif
     switch (tok) {
         case MP_TOKEN_KW_FALSE: emit_write_bytecode_byte(emit, MP_BC_LOAD_CONST_FALSE); break;
         case MP_TOKEN_KW_NONE: emit_write_bytecode_byte(emit, MP_BC_LOAD_CONST_NONE); break;
@@ -530,25 +746,58 @@ void mp_emit_bc_load_const_tok(emit_t *emit, mp_token_kind_t tok) {
             emit_write_bytecode_byte_obj(emit, MP_BC_LOAD_CONST_OBJ, MP_OBJ_FROM_PTR(&mp_const_ellipsis_obj));
             break;
     }
+    #if MICROPY_COMP_PEEPHOLE
+    emit_peep_mark(emit, peep_start);
+    #endif
 }
 
 void mp_emit_bc_load_const_small_int(emit_t *emit, mp_int_t arg) {
     emit_bc_pre(emit, 1);
+    #if MICROPY_COMP_PEEPHOLE
+    size_t peep_start = emit->bytecode_offset;
+    #endif
+    #if EMIT_FUSE
+    size_t start = emit->bytecode_offset;
+    fuse_kind_t kind = FUSE_SMALL_INT;
+    if (emit->fuse_kind == FUSE_LOAD_FAST && emit->fuse_end == start) {
+        start = emit->fuse_start;
+        kind = FUSE_LOAD_FAST_SMALL_INT;
+    }
+    #endif
     if (-16 <= arg && arg <= 47) {
         emit_write_bytecode_byte(emit, MP_BC_LOAD_CONST_SMALL_INT_MULTI + 16 + arg);
     } else {
         emit_write_bytecode_byte_int(emit, MP_BC_LOAD_CONST_SMALL_INT, arg);
     }
+    #if EMIT_FUSE
+    emit->fuse_int = arg;
+    emit_fuse_mark(emit, kind, start);
+    #endif
+    #if MICROPY_COMP_PEEPHOLE
+    emit_peep_mark(emit, peep_start);
+    #endif
 }
 
 void mp_emit_bc_load_const_str(emit_t *emit, qstr qst) {
     emit_bc_pre(emit, 1);
+    #if MICROPY_COMP_PEEPHOLE
+    size_t peep_start = emit->bytecode_offset;
+    #endif
     emit_write_bytecode_byte_qstr(emit, MP_BC_LOAD_CONST_STRING, qst);
+    #if MICROPY_COMP_PEEPHOLE
+    emit_peep_mark(emit, peep_start);
+    #endif
 }
 
 void mp_emit_bc_load_const_obj(emit_t *emit, mp_obj_t obj) {
     emit_bc_pre(emit, 1);
+    #if MICROPY_COMP_PEEPHOLE
+    size_t peep_start = emit->bytecode_offset;
+    #endif
     emit_write_bytecode_byte_obj(emit, MP_BC_LOAD_CONST_OBJ, obj);
+    #if MICROPY_COMP_PEEPHOLE
+    emit_peep_mark(emit, peep_start);
+    #endif
 }
 
 void mp_emit_bc_load_null(emit_t *emit) {
@@ -561,11 +810,25 @@ void mp_emit_bc_load_local(emit_t *emit, qstr qst, mp_uint_t local_num, int kind
     MP_STATIC_ASSERT(MP_BC_LOAD_FAST_N + MP_EMIT_IDOP_LOCAL_DEREF == MP_BC_LOAD_DEREF);
     (void)qst;
     emit_bc_pre(emit, 1);
+    #if MICROPY_COMP_PEEPHOLE
+    if (kind == MP_EMIT_IDOP_LOCAL_FAST) {
+        emit_peep_set_local_used(emit, local_num);
+    }
+    #endif
+    #if EMIT_FUSE
+    size_t start = emit->bytecode_offset;
+    #endif
     if (kind == MP_EMIT_IDOP_LOCAL_FAST && local_num <= 15) {
         emit_write_bytecode_byte(emit, MP_BC_LOAD_FAST_MULTI + local_num);
     } else {
         emit_write_bytecode_byte_uint(emit, MP_BC_LOAD_FAST_N + kind, local_num);
     }
+    #if EMIT_FUSE
+    if (kind == MP_EMIT_IDOP_LOCAL_FAST && local_num <= 255) {
+        emit->fuse_local = local_num;
+        emit_fuse_mark(emit, FUSE_LOAD_FAST, start);
+    }
+    #endif
 }
 
 void mp_emit_bc_load_global(emit_t *emit, qstr qst, int kind) {
@@ -606,7 +869,14 @@ void mp_emit_bc_subscr(emit_t *emit, int kind) {
 void mp_emit_bc_attr(emit_t *emit, qstr qst, int kind) {
     if (kind == MP_EMIT_ATTR_LOAD) {
         emit_bc_pre(emit, 0);
-        emit_write_bytecode_byte_qstr(emit, MP_BC_LOAD_ATTR, qst);
+        #if EMIT_FUSE
+        if (emit_fuse_take(emit, FUSE_LOAD_FAST)) {
+            emit_write_bytecode_byte_byte_qstr(emit, MP_BC_LOAD_FAST_LOAD_ATTR, emit->fuse_local, qst);
+        } else
+        #endif
+        {
+            emit_write_bytecode_byte_qstr(emit, MP_BC_LOAD_ATTR, qst);
+        }
     } else {
         if (kind == MP_EMIT_ATTR_DELETE) {
             mp_emit_bc_load_null(emit);
@@ -625,6 +895,15 @@ void mp_emit_bc_store_local(emit_t *emit, qstr qst, mp_uint_t local_num, int kin
     MP_STATIC_ASSERT(MP_BC_STORE_FAST_N + MP_EMIT_IDOP_LOCAL_DEREF == MP_BC_STORE_DEREF);
     (void)qst;
     emit_bc_pre(emit, -1);
+    #if MICROPY_COMP_PEEPHOLE
+    if (kind == MP_EMIT_IDOP_LOCAL_FAST && emit_peep_is_dead_local(emit, local_num)) {
+        // the value is never read so just discard it
+        if (!emit_peep_take(emit)) {
+            emit_write_bytecode_byte(emit, MP_BC_POP_TOP);
+        }
+        return;
+    }
+    #endif
     if (kind == MP_EMIT_IDOP_LOCAL_FAST && local_num <= 15) {
         emit_write_bytecode_byte(emit, MP_BC_STORE_FAST_MULTI + local_num);
     } else {
@@ -643,6 +922,11 @@ void mp_emit_bc_delete_local(emit_t *emit, qstr qst, mp_uint_t local_num, int ki
     MP_STATIC_ASSERT(MP_BC_DELETE_FAST + MP_EMIT_IDOP_LOCAL_FAST == MP_BC_DELETE_FAST);
     MP_STATIC_ASSERT(MP_BC_DELETE_FAST + MP_EMIT_IDOP_LOCAL_DEREF == MP_BC_DELETE_DEREF);
     (void)qst;
+    #if MICROPY_COMP_PEEPHOLE
+    if (kind == MP_EMIT_IDOP_LOCAL_FAST) {
+        emit_peep_set_local_used(emit, local_num);
+    }
+    #endif
     emit_write_bytecode_byte_uint(emit, MP_BC_DELETE_FAST + kind, local_num);
 }
 
@@ -655,7 +939,13 @@ void mp_emit_bc_delete_global(emit_t *emit, qstr qst, int kind) {
 
 void mp_emit_bc_dup_top(emit_t *emit) {
     emit_bc_pre(emit, 1);
+    #if MICROPY_COMP_PEEPHOLE
+    size_t peep_start = emit->bytecode_offset;
+    #endif
     emit_write_bytecode_byte(emit, MP_BC_DUP_TOP);
+    #if MICROPY_COMP_PEEPHOLE
+    emit_peep_mark(emit, peep_start);
+    #endif
 }
 
 void mp_emit_bc_dup_top_two(emit_t *emit) {
@@ -665,6 +955,12 @@ void mp_emit_bc_dup_top_two(emit_t *emit) {
 
 void mp_emit_bc_pop_top(emit_t *emit) {
     emit_bc_pre(emit, -1);
+    #if MICROPY_COMP_PEEPHOLE
+    if (emit_peep_take(emit)) {
+        // the value was pushed just to be popped again
+        return;
+    }
+    #endif
     emit_write_bytecode_byte(emit, MP_BC_POP_TOP);
 }
 
@@ -680,11 +976,30 @@ void mp_emit_bc_rot_three(emit_t *emit) {
 
 void mp_emit_bc_jump(emit_t *emit, mp_uint_t label) {
     emit_bc_pre(emit, 0);
+    #if MICROPY_COMP_PEEPHOLE
+    emit_peep_set_label_dest(emit, label);
+    label = emit_peep_thread_label(emit, label);
+    if (emit->pass >= MP_PASS_CODE_SIZE && emit->label_dest[label] == PEEP_LABEL_RETURN) {
+        // jumping to a return is the same as returning from here
+        emit_write_bytecode_byte(emit, MP_BC_RETURN_VALUE);
+        return;
+    }
+    #endif
     emit_write_bytecode_byte_signed_label(emit, MP_BC_JUMP, label);
 }
 
 void mp_emit_bc_pop_jump_if(emit_t *emit, bool cond, mp_uint_t label) {
     emit_bc_pre(emit, -1);
+    #if MICROPY_COMP_PEEPHOLE
+    label = emit_peep_thread_label(emit, label);
+    #endif
+    #if EMIT_FUSE
+    if (emit_fuse_take(emit, FUSE_COMPARE)) {
+        emit_write_bytecode_byte_byte_signed_label(emit,
+            cond ? MP_BC_COMPARE_POP_JUMP_IF_TRUE : MP_BC_COMPARE_POP_JUMP_IF_FALSE, emit->fuse_op, label);
+        return;
+    }
+    #endif
     if (cond) {
         emit_write_bytecode_byte_signed_label(emit, MP_BC_POP_JUMP_IF_TRUE, label);
     } else {
@@ -694,6 +1009,9 @@ void mp_emit_bc_pop_jump_if(emit_t *emit, bool cond, mp_uint_t label) {
 
 void mp_emit_bc_jump_if_or_pop(emit_t *emit, bool cond, mp_uint_t label) {
     emit_bc_pre(emit, -1);
+    #if MICROPY_COMP_PEEPHOLE
+    label = emit_peep_thread_label(emit, label);
+    #endif
     if (cond) {
         emit_write_bytecode_byte_signed_label(emit, MP_BC_JUMP_IF_TRUE_OR_POP, label);
     } else {
@@ -786,7 +1104,24 @@ void mp_emit_bc_binary_op(emit_t *emit, mp_binary_op_t op) {
         op = MP_BINARY_OP_IS;
     }
     emit_bc_pre(emit, -1);
+    #if EMIT_FUSE
+    if (emit_fuse_take(emit, FUSE_SMALL_INT)) {
+        emit_write_bytecode_byte(emit, MP_BC_BINARY_OP_SMALL_INT);
+        emit_write_bytecode_byte_int(emit, op, emit->fuse_int);
+    } else if (emit_fuse_take(emit, FUSE_LOAD_FAST_SMALL_INT)) {
+        emit_write_bytecode_byte_byte(emit, MP_BC_LOAD_FAST_BINARY_OP_SMALL_INT, emit->fuse_local);
+        emit_write_bytecode_byte_int(emit, op, emit->fuse_int);
+    } else {
+        size_t start = emit->bytecode_offset;
+        emit_write_bytecode_byte(emit, MP_BC_BINARY_OP_MULTI + op);
+        if (!invert && op <= MP_BINARY_OP_NOT_EQUAL) {
+            emit->fuse_op = op;
+            emit_fuse_mark(emit, FUSE_COMPARE, start);
+        }
+    }
+    #else
     emit_write_bytecode_byte(emit, MP_BC_BINARY_OP_MULTI + op);
+    #endif
     if (invert) {
         emit_bc_pre(emit, 0);
         emit_write_bytecode_byte(emit, MP_BC_UNARY_OP_MULTI + MP_UNARY_OP_NOT);
@@ -883,6 +1218,9 @@ void mp_emit_bc_call_method(emit_t *emit, mp_uint_t n_positional, mp_uint_t n_ke
 
 void mp_emit_bc_return_value(emit_t *emit) {
     emit_bc_pre(emit, -1);
+    #if MICROPY_COMP_PEEPHOLE
+    emit_peep_set_label_dest(emit, PEEP_LABEL_RETURN);
+    #endif
     emit->last_emit_was_return_value = true;
     emit_write_bytecode_byte(emit, MP_BC_RETURN_VALUE);
 }
@@ -144,6 +144,11 @@ mp_obj_t mp_make_function_from_raw_code(const mp_raw_code_t *rc, mp_obj_t def_ar
         #endif
         case MP_CODE_BYTECODE:
             fun = mp_obj_new_fun_bc(def_args, def_kw_args, rc->data.u_byte.bytecode, rc->data.u_byte.const_table);
+            #if MICROPY_EMIT_NATIVE_TIERING
+            if (rc->tier_line != 0) {
+                ((mp_obj_fun_bc_t*)MP_OBJ_TO_PTR(fun))->tier_rc = rc;
+            }
+            #endif
             break;
         default:
             // All other kinds are invalid.
@@ -59,6 +59,12 @@ typedef struct _mp_raw_code_t {
             mp_uint_t type_sig; // for viper, compressed as 2-bit types; ret is MSB, then arg0, arg1, etc
         } u_native;
     } data;
+    #if MICROPY_EMIT_NATIVE_TIERING
+    uint16_t tier_line; // line of the def if this bytecode may be tiered up, else 0
+    uint16_t tier_count; // calls plus back-edges, saturating at the threshold
+    uint32_t tier_source_hash; // hash of the source it was compiled from
+    const struct _mp_raw_code_t *tier_native; // native version, once compiled
+    #endif
 } mp_raw_code_t;
 
 mp_raw_code_t *mp_emit_glue_new_raw_code(void);
@@ -1532,11 +1532,29 @@ STATIC void emit_native_rot_three(emit_t *emit) {
     emit_post_push_reg_reg_reg(emit, vtype0, REG_TEMP0, vtype2, REG_TEMP2, vtype1, REG_TEMP1);
 }
 
+#if MICROPY_EMIT_NATIVE_TIERING
+// Tiered up code runs loops that were interruptible as bytecode, so it gets the
+// VM's checks on every backward jump. A label is behind us if it has already
+// been assigned in this pass, as in the assemblers' own backward jump tests.
+STATIC void emit_native_loop_hook(emit_t *emit, mp_uint_t label) {
+    if (emit->scope->tier_up) {
+        size_t dest = emit->as->base.label_offsets[label];
+        if (dest != (size_t)-1 && dest <= emit->as->base.code_offset) {
+            need_stack_settled(emit);
+            emit_call(emit, MP_F_NATIVE_LOOP_HOOK);
+        }
+    }
+}
+#else
+#define emit_native_loop_hook(emit, label)
+#endif
+
 STATIC void emit_native_jump(emit_t *emit, mp_uint_t label) {
     DEBUG_printf("jump(label=" UINT_FMT ")\n", label);
     emit_native_pre(emit);
     // need to commit stack because we are jumping elsewhere
     need_stack_settled(emit);
+    emit_native_loop_hook(emit, label);
     ASM_JUMP(emit->as, label);
     emit_post(emit);
 }
@@ -1570,6 +1588,7 @@ STATIC void emit_native_jump_helper(emit_t *emit, bool pop) {
 
 STATIC void emit_native_pop_jump_if(emit_t *emit, bool cond, mp_uint_t label) {
     DEBUG_printf("pop_jump_if(cond=%u, label=" UINT_FMT ")\n", cond, label);
+    emit_native_loop_hook(emit, label);
     emit_native_jump_helper(emit, true);
     if (cond) {
         ASM_JUMP_IF_REG_NONZERO(emit->as, REG_RET, label);
@@ -1581,6 +1600,7 @@ STATIC void emit_native_pop_jump_if(emit_t *emit, bool cond, mp_uint_t label) {
 
 STATIC void emit_native_jump_if_or_pop(emit_t *emit, bool cond, mp_uint_t label) {
     DEBUG_printf("jump_if_or_pop(cond=%u, label=" UINT_FMT ")\n", cond, label);
+    emit_native_loop_hook(emit, label);
     emit_native_jump_helper(emit, false);
     if (cond) {
         ASM_JUMP_IF_REG_NONZERO(emit->as, REG_RET, label);
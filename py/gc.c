@@ -826,10 +826,10 @@ void *gc_realloc(void *ptr, mp_uint_t n_bytes) {
 
 #else // Alternative gc_realloc impl
 
-void *gc_realloc(void *ptr_in, size_t n_bytes, bool allow_move) {
+void *gc_realloc(void *ptr_in, size_t n_bytes, bool allow_move, bool long_lived) {
     // check for pure allocation
     if (ptr_in == NULL) {
-        return gc_alloc(n_bytes, false, false);
+        return gc_alloc(n_bytes, false, long_lived);
     }
 
     // check for pure free
@@ -968,7 +968,7 @@ void *gc_realloc(void *ptr_in, size_t n_bytes, bool allow_move) {
     }
 
     // can't resize inplace; try to find a new contiguous chain
-    void *ptr_out = gc_alloc(n_bytes, ftb_state, false);
+    void *ptr_out = gc_alloc(n_bytes, ftb_state, long_lived);
 
     // check that the alloc succeeded
     if (ptr_out == NULL) {
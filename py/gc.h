@@ -69,7 +69,7 @@ void gc_free(void *ptr); // does not call finaliser
 size_t gc_nbytes(const void *ptr);
 bool gc_has_finaliser(const void *ptr);
 void *gc_make_long_lived(void *old_ptr);
-void *gc_realloc(void *ptr, size_t n_bytes, bool allow_move);
+void *gc_realloc(void *ptr, size_t n_bytes, bool allow_move, bool long_lived);
 
 // Prevents a pointer from ever being freed because it establishes a permanent reference to it. Use
 // very sparingly because it can leak memory.
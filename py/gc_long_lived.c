@@ -55,10 +55,11 @@ mp_obj_fun_bc_t *make_fun_bc_long_lived(mp_obj_fun_bc_t *fun_bc, uint8_t max_dep
     }
     fun_bc->const_table = gc_make_long_lived((mp_uint_t*) fun_bc->const_table);
     // extra_args stores keyword only argument default values.
-    size_t words = gc_nbytes(fun_bc) / sizeof(mp_uint_t*);
-    // Functions (mp_obj_fun_bc_t) have four pointers (base, globals, bytecode and const_table)
-    // before the variable length extra_args so remove them from the length.
-    for (size_t i = 0; i < words - 4; i++) {
+    // Functions (mp_obj_fun_bc_t) have a fixed set of fields (base, globals, bytecode,
+    // const_table and any tiering state) before the variable length extra_args so
+    // remove them from the length.
+    size_t words = (gc_nbytes(fun_bc) - offsetof(mp_obj_fun_bc_t, extra_args)) / sizeof(mp_uint_t*);
+    for (size_t i = 0; i < words; i++) {
         if (fun_bc->extra_args[i] == NULL) {
             continue;
         }
@@ -38,6 +38,25 @@
 
 #define TAB_SIZE (8)
 
+#if MICROPY_COMPILE_ARENA
+// The lexer only lives until the parse is done, so its memory is taken from the
+// long-lived end of the heap, next to the parse tree, rather than from between
+// the program's own objects.
+#define lexer_new_obj(type) m_new_ll_obj(type)
+#define lexer_new(type, num) m_new_ll(type, num)
+#define lexer_renew(type, ptr, old_num, new_num) m_renew_ll(type, ptr, old_num, new_num)
+STATIC void lexer_vstr_init(vstr_t *vstr, size_t alloc) {
+    vstr_init_fixed_buf(vstr, alloc, m_new_ll(char, alloc));
+    vstr->fixed_buf = false;
+    vstr->long_lived = true;
+}
+#else
+#define lexer_new_obj(type) m_new_obj(type)
+#define lexer_new(type, num) m_new(type, num)
+#define lexer_renew(type, ptr, old_num, new_num) m_renew(type, ptr, old_num, new_num)
+#define lexer_vstr_init(vstr, alloc) vstr_init(vstr, alloc)
+#endif
+
 // TODO seems that CPython allows NULL byte in the input stream
 // don't know if that's intentional or not, but we don't allow it
 
@@ -158,6 +177,14 @@ STATIC void swap_char_banks(mp_lexer_t *lex) {
 }
 #endif
 
+STATIC unichar read_byte(mp_lexer_t *lex) {
+    unichar c = lex->reader.readbyte(lex->reader.data);
+    #if MICROPY_EMIT_NATIVE_TIERING
+    lex->source_hash = (lex->source_hash * 33) ^ c;
+    #endif
+    return c;
+}
+
 STATIC void next_char(mp_lexer_t *lex) {
     if (lex->chr0 == '\n') {
         // a new line
@@ -184,7 +211,7 @@ STATIC void next_char(mp_lexer_t *lex) {
     } else
 #endif
     {
-        lex->chr2 = lex->reader.readbyte(lex->reader.data);
+        lex->chr2 = read_byte(lex);
     }
 
     if (lex->chr1 == '\r') {
@@ -192,7 +219,7 @@ STATIC void next_char(mp_lexer_t *lex) {
         lex->chr1 = '\n';
         if (lex->chr2 == '\n') {
             // CR LF is a single new line, throw out the extra LF
-            lex->chr2 = lex->reader.readbyte(lex->reader.data);
+            lex->chr2 = read_byte(lex);
         }
     }
 
@@ -211,7 +238,7 @@ STATIC void next_char(mp_lexer_t *lex) {
 
 STATIC void indent_push(mp_lexer_t *lex, size_t indent) {
     if (lex->num_indent_level >= lex->alloc_indent_level) {
-        lex->indent_level = m_renew(uint16_t, lex->indent_level, lex->alloc_indent_level, lex->alloc_indent_level + MICROPY_ALLOC_LEXEL_INDENT_INC);
+        lex->indent_level = lexer_renew(uint16_t, lex->indent_level, lex->alloc_indent_level, lex->alloc_indent_level + MICROPY_ALLOC_LEXEL_INDENT_INC);
         lex->alloc_indent_level += MICROPY_ALLOC_LEXEL_INDENT_INC;
     }
     lex->indent_level[lex->num_indent_level++] = indent;
@@ -824,21 +851,25 @@ void mp_lexer_to_next(mp_lexer_t *lex) {
     }
 }
 
+
 mp_lexer_t *mp_lexer_new(qstr src_name, mp_reader_t reader) {
-    mp_lexer_t *lex = m_new_obj(mp_lexer_t);
+    mp_lexer_t *lex = lexer_new_obj(mp_lexer_t);
 
     lex->source_name = src_name;
     lex->reader = reader;
     lex->line = 1;
     lex->column = (size_t)-2; // account for 3 dummy bytes
+    #if MICROPY_EMIT_NATIVE_TIERING
+    lex->source_hash = 5381;
+    #endif
     lex->emit_dent = 0;
     lex->nested_bracket_level = 0;
     lex->alloc_indent_level = MICROPY_ALLOC_LEXER_INDENT_INIT;
     lex->num_indent_level = 1;
-    lex->indent_level = m_new(uint16_t, lex->alloc_indent_level);
-    vstr_init(&lex->vstr, 32);
+    lex->indent_level = lexer_new(uint16_t, lex->alloc_indent_level);
+    lexer_vstr_init(&lex->vstr, 32);
 #if MICROPY_COMP_FSTRING_LITERAL
-    vstr_init(&lex->vstr_postfix, 0);
+    lexer_vstr_init(&lex->vstr_postfix, 1);
 #endif
 
     // store sentinel for first indentation level
@@ -59,11 +59,12 @@
 #define malloc_ll(b, ll) gc_alloc((b), false, (ll))
 #define malloc_with_finaliser(b) gc_alloc((b), true, false)
 #define free gc_free
-#define realloc(ptr, n) gc_realloc(ptr, n, true)
-#define realloc_ext(ptr, n, mv) gc_realloc(ptr, n, mv)
+#define realloc_ll(ptr, n, ll) gc_realloc(ptr, n, true, ll)
+#define realloc_ext(ptr, n, mv) gc_realloc(ptr, n, mv, false)
 #else
 #define malloc_ll(b, ll) malloc(b)
 #define malloc_with_finaliser(b) malloc((b))
+#define realloc_ll(ptr, n, ll) realloc(ptr, n)
 
 STATIC void *realloc_ext(void *ptr, size_t n_bytes, bool allow_move) {
     if (allow_move) {
@@ -127,12 +128,9 @@ void *m_malloc0(size_t num_bytes, bool long_lived) {
     return ptr;
 }
 
-#if MICROPY_MALLOC_USES_ALLOCATED_SIZE
-void *m_realloc(void *ptr, size_t old_num_bytes, size_t new_num_bytes) {
-#else
-void *m_realloc(void *ptr, size_t new_num_bytes) {
-#endif
-    void *new_ptr = realloc(ptr, new_num_bytes);
+STATIC void *m_realloc_helper(void *ptr, size_t old_num_bytes, size_t new_num_bytes, bool long_lived) {
+    (void)old_num_bytes;
+    void *new_ptr = realloc_ll(ptr, new_num_bytes, long_lived);
     if (new_ptr == NULL && new_num_bytes != 0) {
         m_malloc_fail(new_num_bytes);
     }
@@ -155,6 +153,24 @@ void *m_realloc(void *ptr, size_t new_num_bytes) {
     return new_ptr;
 }
 
+#if MICROPY_MALLOC_USES_ALLOCATED_SIZE
+void *m_realloc(void *ptr, size_t old_num_bytes, size_t new_num_bytes) {
+    return m_realloc_helper(ptr, old_num_bytes, new_num_bytes, false);
+}
+
+void *m_realloc_ll(void *ptr, size_t old_num_bytes, size_t new_num_bytes) {
+    return m_realloc_helper(ptr, old_num_bytes, new_num_bytes, true);
+}
+#else
+void *m_realloc(void *ptr, size_t new_num_bytes) {
+    return m_realloc_helper(ptr, 0, new_num_bytes, false);
+}
+
+void *m_realloc_ll(void *ptr, size_t new_num_bytes) {
+    return m_realloc_helper(ptr, 0, new_num_bytes, true);
+}
+#endif
+
 #if MICROPY_MALLOC_USES_ALLOCATED_SIZE
 void *m_realloc_maybe(void *ptr, size_t old_num_bytes, size_t new_num_bytes, bool allow_move) {
 #else
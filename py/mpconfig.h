@@ -182,6 +182,19 @@
 #define MICROPY_ALLOC_PARSE_CHUNK_INIT (128)
 #endif
 
+// Whether the lexer and parser take their working memory from the long-lived
+// (top) end of the heap, with parse nodes bump-allocated from an arena of
+// fixed-size blocks that is released in one go once compilation is done.
+// This keeps compiling from fragmenting the heap used by the program.
+#ifndef MICROPY_COMPILE_ARENA
+#define MICROPY_COMPILE_ARENA (0)
+#endif
+
+// Number of bytes in each block of the compile arena
+#ifndef MICROPY_ALLOC_PARSE_ARENA_BLOCK
+#define MICROPY_ALLOC_PARSE_ARENA_BLOCK (256)
+#endif
+
 // Initial amount for ids in a scope
 #ifndef MICROPY_ALLOC_SCOPE_ID_INIT
 #define MICROPY_ALLOC_SCOPE_ID_INIT (4)
@@ -260,6 +273,14 @@
 #define MICROPY_PERSISTENT_CODE_LOAD (0)
 #endif
 
+// Whether .mpy files that can be addressed directly in memory, eg on memory-mapped
+// flash (see MP_STREAM_GET_MMAP), are imported without copying their bytecode to RAM
+// Bytecode is still copied if the VM writes to it (MICROPY_OPT_CACHE_MAP_LOOKUP_IN_BYTECODE)
+// or if the .mpy was saved by an older version that linked qstrs into the bytecode
+#ifndef MICROPY_PERSISTENT_CODE_LOAD_XIP
+#define MICROPY_PERSISTENT_CODE_LOAD_XIP (0)
+#endif
+
 // Whether to support saving of persistent code
 #ifndef MICROPY_PERSISTENT_CODE_SAVE
 #define MICROPY_PERSISTENT_CODE_SAVE (0)
@@ -322,6 +343,21 @@
 // Convenience definition for whether any inline assembler emitter is enabled
 #define MICROPY_EMIT_INLINE_ASM (MICROPY_EMIT_INLINE_THUMB || MICROPY_EMIT_INLINE_XTENSA)
 
+// Whether hot bytecode functions are automatically recompiled with the native
+// emitter.  Functions compiled from a source file count their calls and loop
+// back-edges; once the count reaches MICROPY_EMIT_NATIVE_TIERING_THRESHOLD the
+// source is re-parsed and the function body is compiled as if it had been
+// decorated with @micropython.native, taking effect from the next call.
+// Requires a native emitter, the compiler and the port's file reader.
+#ifndef MICROPY_EMIT_NATIVE_TIERING
+#define MICROPY_EMIT_NATIVE_TIERING (0)
+#endif
+
+// Number of calls plus loop back-edges before a function is tiered up (< 65535)
+#ifndef MICROPY_EMIT_NATIVE_TIERING_THRESHOLD
+#define MICROPY_EMIT_NATIVE_TIERING_THRESHOLD (1000)
+#endif
+
 /*****************************************************************************/
 /* Compiler configuration                                                    */
 
@@ -377,6 +413,15 @@
 #define MICROPY_COMP_RETURN_IF_EXPR (0)
 #endif
 
+// Whether the bytecode emitter does peephole optimisation as it goes:
+// jumps to jumps are threaded, jumps to a return become the return, stores
+// to locals that are never read are dropped, and constants or DUP_TOPs that
+// are immediately popped are removed.  When not saving persistent code,
+// tuples whose items are all constants are also built at compile time.
+#ifndef MICROPY_COMP_PEEPHOLE
+#define MICROPY_COMP_PEEPHOLE (0)
+#endif
+
 // Whether to include parsing of f-string literals
 #ifndef MICROPY_COMP_FSTRING_LITERAL
 #define MICROPY_COMP_FSTRING_LITERAL (1)
@@ -420,12 +465,36 @@
 #define MICROPY_OPT_CACHE_MAP_LOOKUP_IN_BYTECODE (0)
 #endif
 
+// Whether the bytecode emitter fuses common opcode sequences (eg LOAD_FAST
+// followed by LOAD_ATTR, or a compare followed by POP_JUMP_IF_FALSE) into
+// superinstructions, including binary ops specialised for a small-int operand.
+// Saves VM dispatches in tight loops at the cost of some extra VM code size.
+// The fused opcodes are not part of the .mpy format so they are never emitted
+// when MICROPY_PERSISTENT_CODE_SAVE is enabled.
+#ifndef MICROPY_OPT_BC_SUPERINSTRUCTIONS
+#define MICROPY_OPT_BC_SUPERINSTRUCTIONS (0)
+#endif
+
 // Whether to use fast versions of bitwise operations (and, or, xor) when the
 // arguments are both positive.  Increases Thumb2 code size by about 250 bytes.
 #ifndef MICROPY_OPT_MPZ_BITWISE
 #define MICROPY_OPT_MPZ_BITWISE (0)
 #endif
 
+// Whether to multiply large integers using Karatsuba's algorithm (see
+// MPZ_KARATSUBA_THRESHOLD), square them with a dedicated routine, and do
+// 3-argument pow with an odd modulus using Montgomery multiplication.
+#ifndef MICROPY_OPT_MPZ_FAST_MUL
+#define MICROPY_OPT_MPZ_FAST_MUL (0)
+#endif
+
+// Whether to convert large integers to and from strings a chunk of digits at
+// a time, and by divide and conquer (see MPZ_STR_DC_THRESHOLD), rather than one
+// digit at a time.  This is sub-quadratic with MICROPY_OPT_MPZ_FAST_MUL.
+#ifndef MICROPY_OPT_MPZ_FAST_STR
+#define MICROPY_OPT_MPZ_FAST_STR (0)
+#endif
+
 /*****************************************************************************/
 /* Python internal features                                                  */
 
@@ -676,6 +745,13 @@ typedef double mp_float_t;
 #define MICROPY_MODULE_FROZEN (MICROPY_MODULE_FROZEN_STR || MICROPY_MODULE_FROZEN_MPY)
 #endif
 
+// Whether imported .py files are compiled once and their bytecode cached in a
+// .mpycache directory next to the source, keyed by the source's size and mtime
+// Requires MICROPY_VFS, MICROPY_PERSISTENT_CODE_LOAD and MICROPY_PERSISTENT_CODE_SAVE
+#ifndef MICROPY_MODULE_BYTECODE_CACHE
+#define MICROPY_MODULE_BYTECODE_CACHE (0)
+#endif
+
 // Whether you can override builtins in the builtins module
 #ifndef MICROPY_CAN_OVERRIDE_BUILTINS
 #define MICROPY_CAN_OVERRIDE_BUILTINS (0)
@@ -725,6 +801,24 @@ typedef double mp_float_t;
 #define MICROPY_VFS_FAT (0)
 #endif
 
+// Whether files can be mapped read-only into memory with uos.mmap, and whether
+// VfsFat provides MP_STREAM_GET_MMAP for files on block devices that are
+// addressable in memory (see BP_IOCTL_SEC_ADDR)
+#ifndef MICROPY_VFS_MMAP
+#define MICROPY_VFS_MMAP (0)
+#endif
+
+// Whether VfsFat files support write_async/readinto_async, which queue the
+// transfer to be done in steps from the background (see vfs_fat_async_service)
+#ifndef MICROPY_VFS_FAT_ASYNC
+#define MICROPY_VFS_FAT_ASYNC (0)
+#endif
+
+// Whether uos/storage provide benchmark() to time block device reads and writes
+#ifndef MICROPY_VFS_FAT_BENCHMARK
+#define MICROPY_VFS_FAT_BENCHMARK (0)
+#endif
+
 /*****************************************************************************/
 /* Fine control over Python builtins, classes, modules, etc                  */
 
@@ -824,6 +918,12 @@ typedef double mp_float_t;
 #define MICROPY_PY_BUILTINS_SLICE_ATTRS (0)
 #endif
 
+// Whether list.sort and sorted() use a stable, run-adaptive merge sort
+// instead of the smaller, unstable quicksort
+#ifndef MICROPY_PY_BUILTINS_LIST_SORT_STABLE
+#define MICROPY_PY_BUILTINS_LIST_SORT_STABLE (0)
+#endif
+
 // Whether to support frozenset object
 #ifndef MICROPY_PY_BUILTINS_FROZENSET
 #define MICROPY_PY_BUILTINS_FROZENSET (0)
@@ -1174,10 +1274,21 @@ typedef double mp_float_t;
 #define MICROPY_PY_UZLIB (0)
 #endif
 
+// Whether to provide uzlib.CompIO, a stream wrapper that compresses data
+// written to it; depends on MICROPY_PY_UZLIB
+#ifndef MICROPY_PY_UZLIB_COMPIO
+#define MICROPY_PY_UZLIB_COMPIO (0)
+#endif
+
 #ifndef MICROPY_PY_UJSON
 #define MICROPY_PY_UJSON (0)
 #endif
 
+// Whether to provide ujson.Parser, an incremental pull parser for streams
+#ifndef MICROPY_PY_UJSON_PARSER
+#define MICROPY_PY_UJSON_PARSER (0)
+#endif
+
 #ifndef CIRCUITPY_ULAB
 #define CIRCUITPY_ULAB (0)
 #endif
@@ -1198,6 +1309,18 @@ typedef double mp_float_t;
 #define MICROPY_PY_URE_SUB (0)
 #endif
 
+// Number of compiled patterns kept by the module-level re functions
+// (match, search, sub); 0 disables the cache
+#ifndef MICROPY_PY_URE_CACHE_SIZE
+#define MICROPY_PY_URE_CACHE_SIZE (0)
+#endif
+
+// Whether unanchored searches skip start positions that can't begin a match
+// by scanning for the pattern's literal prefix or set of first bytes
+#ifndef MICROPY_PY_URE_PREFILTER
+#define MICROPY_PY_URE_PREFILTER (0)
+#endif
+
 #ifndef MICROPY_PY_UHEAPQ
 #define MICROPY_PY_UHEAPQ (0)
 #endif
@@ -186,11 +186,21 @@ typedef struct _mp_state_vm_t {
     mp_obj_t lwip_slip_stream;
     #endif
 
+    #if MICROPY_PY_URE && MICROPY_PY_URE_CACHE_SIZE
+    // (pattern, compiled re) pairs, most recently used first
+    mp_obj_t ure_cache[2 * MICROPY_PY_URE_CACHE_SIZE];
+    #endif
+
     #if MICROPY_VFS
     struct _mp_vfs_mount_t *vfs_cur;
     struct _mp_vfs_mount_t *vfs_mount_table;
     #endif
 
+    #if MICROPY_VFS_FAT_ASYNC
+    // FAT files with queued I/O, linked through their async_next field
+    struct _pyb_file_obj_t *vfs_fat_async_files;
+    #endif
+
     //
     // END ROOT POINTER SECTION
     ////////////////////////////////////////////////////////////
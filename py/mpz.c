@@ -453,6 +453,172 @@ STATIC size_t mpn_mul(mpz_dig_t *idig, mpz_dig_t *jdig, size_t jlen, mpz_dig_t *
     return ilen;
 }
 
+#if MICROPY_OPT_MPZ_FAST_MUL
+
+/* computes i = j * j
+   writes all 2 * jlen digits of i, which can't overlap j
+*/
+STATIC void mpn_sqr(mpz_dig_t *idig, const mpz_dig_t *jdig, size_t jlen) {
+    memset(idig, 0, 2 * jlen * sizeof(mpz_dig_t));
+
+    // sum of j[a] * j[b] for a < b, which is half of the cross terms
+    for (size_t a = 0; a + 1 < jlen; ++a) {
+        mpz_dig_t *id = idig + 2 * a + 1;
+        mpz_dbl_dig_t carry = 0;
+        for (size_t b = a + 1; b < jlen; ++b, ++id) {
+            carry += (mpz_dbl_dig_t)*id + (mpz_dbl_dig_t)jdig[a] * (mpz_dbl_dig_t)jdig[b];
+            *id = carry & DIG_MASK;
+            carry >>= DIG_SIZE;
+        }
+        *id = carry;
+        #ifdef RUN_BACKGROUND_TASKS
+        RUN_BACKGROUND_TASKS;
+        #endif
+    }
+
+    // double the cross terms and add the squares
+    mpz_dig_t msb = 0;
+    mpz_dbl_dig_t carry = 0;
+    for (size_t a = 0; a < jlen; ++a) {
+        mpz_dig_t lo = idig[2 * a];
+        mpz_dig_t hi = idig[2 * a + 1];
+        carry += (mpz_dbl_dig_t)(((lo << 1) | msb) & DIG_MASK) + (mpz_dbl_dig_t)jdig[a] * (mpz_dbl_dig_t)jdig[a];
+        idig[2 * a] = carry & DIG_MASK;
+        carry >>= DIG_SIZE;
+        carry += ((hi << 1) | (lo >> (DIG_SIZE - 1))) & DIG_MASK;
+        idig[2 * a + 1] = carry & DIG_MASK;
+        carry >>= DIG_SIZE;
+        msb = hi >> (DIG_SIZE - 1);
+    }
+}
+
+// Returns enough digits of scratch space for mpn_mul_rec when the longer of the
+// numbers has jlen digits.
+STATIC size_t mpn_mul_rec_scratch_len(size_t jlen) {
+    size_t n = 0;
+    for (; jlen >= MPZ_KARATSUBA_THRESHOLD; jlen = jlen / 2 + 2) {
+        n += 2 * jlen + 6;
+    }
+    return n;
+}
+
+/* computes i = j * k, squaring if j and k are the same
+   writes all jlen + klen digits of i, which can't overlap j, k or scratch
+   j and k don't need to be normalised
+*/
+STATIC void mpn_mul_rec(mpz_dig_t *idig, const mpz_dig_t *jdig, size_t jlen, const mpz_dig_t *kdig, size_t klen, mpz_dig_t *scratch) {
+    bool sqr = jdig == kdig && jlen == klen;
+    if (jlen < klen) {
+        const mpz_dig_t *t = jdig;
+        jdig = kdig;
+        kdig = t;
+        size_t tlen = jlen;
+        jlen = klen;
+        klen = tlen;
+    }
+
+    if (klen < MPZ_KARATSUBA_THRESHOLD) {
+        if (sqr) {
+            mpn_sqr(idig, jdig, jlen);
+        } else {
+            memset(idig, 0, (jlen + klen) * sizeof(mpz_dig_t));
+            mpn_mul(idig, (mpz_dig_t*)jdig, jlen, (mpz_dig_t*)kdig, klen);
+        }
+        return;
+    }
+
+    // split j = j1 * B^m + j0
+    size_t m = jlen / 2;
+
+    if (klen <= m) {
+        // k is much shorter than j: i = j1 * k * B^m + j0 * k
+        mpn_mul_rec(idig, jdig, m, kdig, klen, scratch);
+        size_t n1 = jlen - m + klen;
+        mpn_mul_rec(scratch, jdig + m, jlen - m, kdig, klen, scratch + n1);
+        memset(idig + m + klen, 0, (jlen - m) * sizeof(mpz_dig_t));
+        mpn_add(idig + m, idig + m, n1, scratch, n1);
+        return;
+    }
+
+    // with k = k1 * B^m + k0, z0 = j0 * k0, z2 = j1 * k1 and
+    // z1 = (j0 + j1) * (k0 + k1) - z0 - z2:  i = z2 * B^2m + z1 * B^m + z0
+    mpn_mul_rec(idig, jdig, m, kdig, m, scratch);
+    mpn_mul_rec(idig + 2 * m, jdig + m, jlen - m, kdig + m, klen - m, scratch);
+
+    mpz_dig_t *sj = scratch;
+    size_t sjlen = jlen - m + 1;
+    sj[sjlen - 1] = 0;
+    mpn_add(sj, jdig + m, jlen - m, jdig, m);
+    mpz_dig_t *sk = sj;
+    size_t sklen = sjlen;
+    if (!sqr) {
+        sk = sj + sjlen;
+        if (klen - m >= m) {
+            sklen = klen - m + 1;
+            sk[sklen - 1] = 0;
+            mpn_add(sk, kdig + m, klen - m, kdig, m);
+        } else {
+            sklen = m + 1;
+            sk[sklen - 1] = 0;
+            mpn_add(sk, kdig, m, kdig + m, klen - m);
+        }
+    }
+    mpz_dig_t *z1 = sk + sklen;
+    size_t z1len = sjlen + sklen;
+    mpn_mul_rec(z1, sj, sjlen, sk, sklen, z1 + z1len);
+
+    z1len = mpn_remove_trailing_zeros(z1, z1 + z1len);
+    z1len = mpn_sub(z1, z1, z1len, idig, mpn_remove_trailing_zeros(idig, idig + 2 * m));
+    z1len = mpn_sub(z1, z1, z1len, idig + 2 * m, mpn_remove_trailing_zeros(idig + 2 * m, idig + jlen + klen));
+    mpn_add(idig + m, idig + m, jlen + klen - m, z1, z1len);
+}
+
+/* computes i = j * k
+   returns number of digits in i
+   assumes enough memory in i; assumes normalised j, k
+   can have j, k point to same memory, but not i
+*/
+STATIC size_t mpn_mul_fast(mpz_dig_t *idig, const mpz_dig_t *jdig, size_t jlen, const mpz_dig_t *kdig, size_t klen) {
+    size_t scratch_len = mpn_mul_rec_scratch_len(jlen > klen ? jlen : klen);
+    mpz_dig_t *scratch = scratch_len == 0 ? NULL : m_new(mpz_dig_t, scratch_len);
+    mpn_mul_rec(idig, jdig, jlen, kdig, klen, scratch);
+    m_del(mpz_dig_t, scratch, scratch_len);
+    return mpn_remove_trailing_zeros(idig, idig + jlen + klen);
+}
+
+/* Montgomery reduction: computes i = i / B^nlen mod n
+   i has 2 * nlen + 1 digits and holds a value less than n * B^nlen
+   ninv is -1/n mod B; the result is in the low nlen digits of i
+*/
+STATIC void mpn_redc(mpz_dig_t *idig, const mpz_dig_t *ndig, size_t nlen, mpz_dig_t ninv) {
+    for (size_t a = 0; a < nlen; ++a) {
+        // add a multiple of n that clears digit a of i
+        mpz_dig_t u = ((mpz_dbl_dig_t)idig[a] * ninv) & DIG_MASK;
+        mpz_dig_t *id = idig + a;
+        mpz_dbl_dig_t carry = 0;
+        for (size_t b = 0; b < nlen; ++b, ++id) {
+            carry += (mpz_dbl_dig_t)*id + (mpz_dbl_dig_t)u * (mpz_dbl_dig_t)ndig[b];
+            *id = carry & DIG_MASK;
+            carry >>= DIG_SIZE;
+        }
+        for (; carry != 0; ++id) {
+            carry += *id;
+            *id = carry & DIG_MASK;
+            carry >>= DIG_SIZE;
+        }
+    }
+
+    // the result is less than 2n
+    mpz_dig_t *rdig = idig + nlen;
+    size_t rlen = mpn_remove_trailing_zeros(rdig, rdig + nlen + 1);
+    if (mpn_cmp(rdig, rlen, ndig, nlen) >= 0) {
+        mpn_sub(rdig, rdig, rlen, ndig, nlen);
+    }
+    memmove(idig, rdig, nlen * sizeof(mpz_dig_t));
+}
+
+#endif
+
 /* natural_div - quo * den + new_num = old_num (ie num is replaced with rem)
    assumes den != 0
    assumes num_dig has enough memory to be extended by 1 digit
@@ -523,8 +689,11 @@ STATIC void mpn_div(mpz_dig_t *num_dig, size_t *num_len, const mpz_dig_t *den_di
     while (*num_len > den_len) {
         mpz_dbl_dig_t quo = ((mpz_dbl_dig_t)*num_dig << DIG_SIZE) | num_dig[-1];
 
-        // get approximate quotient
+        // get approximate quotient, which can be at most one digit
         quo /= lead_den_digit;
+        if (quo > DIG_MASK) {
+            quo = DIG_MASK;
+        }
 
         // Multiply quo by den and subtract from num to get remainder.
         // We have different code here to handle different compile-time
@@ -844,6 +1013,190 @@ typedef uint32_t mp_float_int_t;
 }
 #endif
 
+#if MICROPY_OPT_MPZ_FAST_STR
+
+// Long strings of digits are converted to and from mpz by divide and conquer,
+// splitting the digits at the powers chunk ** (2 ** n), where chunk is the
+// largest power of the base that fits in a single mpz digit.  The powers (and
+// their reciprocals, used for division) are computed as needed and only kept
+// for the duration of one conversion.
+typedef struct _mpz_str_pow_t {
+    unsigned int base;
+    size_t chunk_len; // number of base digits in a chunk
+    mpz_dig_t chunk; // base ** chunk_len
+    size_t n_pow;
+    mpz_t *pow; // pow[n] = chunk ** (2 ** n)
+    mpz_t *recip; // recip[n] = DIG_BASE ** (2 * pow[n].len) // pow[n], or 0 if not yet computed
+} mpz_str_pow_t;
+
+STATIC void mpz_str_pow_init(mpz_str_pow_t *tab, unsigned int base) {
+    tab->base = base;
+    tab->chunk_len = 1;
+    tab->chunk = base;
+    while (tab->chunk <= DIG_MASK / base) {
+        tab->chunk *= base;
+        ++tab->chunk_len;
+    }
+    tab->n_pow = 0;
+    tab->pow = NULL;
+    tab->recip = NULL;
+}
+
+STATIC void mpz_str_pow_deinit(mpz_str_pow_t *tab) {
+    for (size_t n = 0; n < tab->n_pow; ++n) {
+        mpz_deinit(&tab->pow[n]);
+        mpz_deinit(&tab->recip[n]);
+    }
+    m_del(mpz_t, tab->pow, tab->n_pow);
+    m_del(mpz_t, tab->recip, tab->n_pow);
+}
+
+STATIC const mpz_t *mpz_str_pow(mpz_str_pow_t *tab, size_t n) {
+    if (n >= tab->n_pow) {
+        tab->pow = m_renew(mpz_t, tab->pow, tab->n_pow, n + 1);
+        tab->recip = m_renew(mpz_t, tab->recip, tab->n_pow, n + 1);
+        for (size_t i = tab->n_pow; i <= n; ++i) {
+            mpz_init_zero(&tab->pow[i]);
+            mpz_init_zero(&tab->recip[i]);
+            if (i == 0) {
+                mpz_set_from_int(&tab->pow[0], tab->chunk);
+            } else {
+                mpz_mul_inpl(&tab->pow[i], &tab->pow[i - 1], &tab->pow[i - 1]);
+            }
+            tab->n_pow = i + 1;
+        }
+    }
+    return &tab->pow[n];
+}
+
+/* computes dest = DIG_BASE ** (2 * d.len) // d
+   assumes d > 0
+*/
+STATIC void mpz_str_recip(mpz_t *dest, const mpz_t *d) {
+    size_t m = d->len;
+    mpz_t t, e;
+    mpz_init_from_int(&t, 1);
+    mpz_shl_inpl(&t, &t, 2 * m * DIG_SIZE);
+    mpz_init_zero(&e);
+
+    if (m < MPZ_KARATSUBA_THRESHOLD) {
+        mpz_divmod_inpl(dest, &e, &t, d);
+    } else {
+        // Start from the reciprocal of the leading h digits of d, which is good
+        // to about h digits, then do one Newton step dest += dest * e / t, with
+        // e = t - d * dest, to double that.  The result is then within a few
+        // units of the answer so can be corrected by hand.
+        size_t h = m / 2 + 2;
+        mpz_shr_inpl(&e, d, (m - h) * DIG_SIZE);
+        mpz_str_recip(dest, &e);
+        mpz_shl_inpl(dest, dest, (m - h) * DIG_SIZE);
+        mpz_mul_inpl(&e, d, dest);
+        mpz_sub_inpl(&e, &t, &e);
+        mpz_mul_inpl(&e, &e, dest);
+        mpz_shr_inpl(&e, &e, 2 * m * DIG_SIZE);
+        mpz_add_inpl(dest, dest, &e);
+
+        mpz_t one;
+        mpz_dig_t one_dig[MPZ_NUM_DIG_FOR_INT];
+        mpz_init_fixed_from_int(&one, one_dig, MPZ_NUM_DIG_FOR_INT, 1);
+        mpz_mul_inpl(&e, d, dest);
+        mpz_sub_inpl(&e, &t, &e);
+        while (mpz_is_neg(&e)) {
+            mpz_sub_inpl(dest, dest, &one);
+            mpz_add_inpl(&e, &e, d);
+        }
+        while (mpz_cmp(&e, d) >= 0) {
+            mpz_add_inpl(dest, dest, &one);
+            mpz_sub_inpl(&e, &e, d);
+        }
+    }
+
+    mpz_deinit(&t);
+    mpz_deinit(&e);
+}
+
+/* computes quo, rem = divmod(lhs, pow[n])
+   assumes 0 <= lhs < pow[n] ** 2
+*/
+STATIC void mpz_str_divmod(mpz_str_pow_t *tab, mpz_t *quo, mpz_t *rem, const mpz_t *lhs, size_t n) {
+    const mpz_t *d = mpz_str_pow(tab, n);
+    size_t m = d->len;
+    if (m < MPZ_KARATSUBA_THRESHOLD) {
+        mpz_divmod_inpl(quo, rem, lhs, d);
+        return;
+    }
+
+    // Barrett reduction: the estimated quotient is at most 2 less than the true one
+    mpz_t *x = &tab->recip[n];
+    if (mpz_is_zero(x)) {
+        mpz_str_recip(x, d);
+    }
+    mpz_shr_inpl(quo, lhs, (m - 1) * DIG_SIZE);
+    mpz_mul_inpl(quo, quo, x);
+    mpz_shr_inpl(quo, quo, (m + 1) * DIG_SIZE);
+    mpz_mul_inpl(rem, quo, d);
+    mpz_sub_inpl(rem, lhs, rem);
+
+    mpz_t one;
+    mpz_dig_t one_dig[MPZ_NUM_DIG_FOR_INT];
+    mpz_init_fixed_from_int(&one, one_dig, MPZ_NUM_DIG_FOR_INT, 1);
+    while (mpz_cmp(rem, d) >= 0) {
+        mpz_add_inpl(quo, quo, &one);
+        mpz_sub_inpl(rem, rem, d);
+    }
+}
+
+STATIC mpz_dig_t mpz_str_digit_value(char c) {
+    if ('0' <= c && c <= '9') {
+        return c - '0';
+    } else if ('A' <= c && c <= 'Z') {
+        return c - ('A' - 10);
+    } else {
+        return c - ('a' - 10);
+    }
+}
+
+/* sets z to the value of the len base digits in str
+   assumes all the characters are valid digits
+*/
+STATIC void mpz_set_from_digits(mpz_str_pow_t *tab, mpz_t *z, const char *str, size_t len) {
+    if (len <= tab->chunk_len * MPZ_STR_DC_THRESHOLD) {
+        // convert a chunk at a time, starting with a partial one if needed
+        mpz_need_dig(z, len / tab->chunk_len + 1);
+        z->neg = 0;
+        z->len = 0;
+        size_t n = (len - 1) % tab->chunk_len + 1;
+        while (len > 0) {
+            mpz_dig_t mul = 1;
+            mpz_dig_t v = 0;
+            for (len -= n; n > 0; --n) {
+                v = v * tab->base + mpz_str_digit_value(*str++);
+                mul *= tab->base;
+            }
+            z->len = mpn_mul_dig_add_dig(z->dig, z->len, mul, v);
+            n = tab->chunk_len;
+        }
+        return;
+    }
+
+    // split off the largest chunk_len * 2 ** n digits, which leaves no more than
+    // that many at the front
+    size_t n = 0;
+    while ((tab->chunk_len << (n + 1)) < len) {
+        ++n;
+    }
+    size_t lo_len = tab->chunk_len << n;
+    mpz_t lo;
+    mpz_init_zero(&lo);
+    mpz_set_from_digits(tab, z, str, len - lo_len);
+    mpz_set_from_digits(tab, &lo, str + len - lo_len, lo_len);
+    mpz_mul_inpl(z, z, mpz_str_pow(tab, n));
+    mpz_add_inpl(z, z, &lo);
+    mpz_deinit(&lo);
+}
+
+#endif
+
 // returns number of bytes from str that were processed
 size_t mpz_set_from_str(mpz_t *z, const char *str, size_t len, bool neg, unsigned int base) {
     assert(base <= 36);
@@ -860,6 +1213,22 @@ size_t mpz_set_from_str(mpz_t *z, const char *str, size_t len, bool neg, unsigne
     }
 
     z->len = 0;
+    #if MICROPY_OPT_MPZ_FAST_STR
+    for (; cur < top; ++cur) {
+        mp_uint_t v = *cur;
+        if (!(('0' <= v && v <= '9') || ('A' <= v && v <= 'Z') || ('a' <= v && v <= 'z'))
+            || mpz_str_digit_value(v) >= base) {
+            break;
+        }
+    }
+    if (cur > str) {
+        mpz_str_pow_t tab;
+        mpz_str_pow_init(&tab, base);
+        mpz_set_from_digits(&tab, z, str, cur - str);
+        mpz_str_pow_deinit(&tab);
+        z->neg = neg;
+    }
+    #else
     for (; cur < top; ++cur) { // XXX UTF8 next char
         //mp_uint_t v = char_to_numeric(cur#); // XXX UTF8 get char
         mp_uint_t v = *cur;
@@ -877,6 +1246,7 @@ size_t mpz_set_from_str(mpz_t *z, const char *str, size_t len, bool neg, unsigne
         }
         z->len = mpn_mul_dig_add_dig(z->dig, z->len, base, v);
     }
+    #endif
 
     return cur - str;
 }
@@ -1317,8 +1687,15 @@ void mpz_mul_inpl(mpz_t *dest, const mpz_t *lhs, const mpz_t *rhs) {
     }
 
     mpz_need_dig(dest, lhs->len + rhs->len); // min mem l+r-1, max mem l+r
-    memset(dest->dig, 0, dest->alloc * sizeof(mpz_dig_t));
-    dest->len = mpn_mul(dest->dig, lhs->dig, lhs->len, rhs->dig, rhs->len);
+    #if MICROPY_OPT_MPZ_FAST_MUL
+    if (lhs == rhs || (lhs->len >= MPZ_KARATSUBA_THRESHOLD && rhs->len >= MPZ_KARATSUBA_THRESHOLD)) {
+        dest->len = mpn_mul_fast(dest->dig, lhs->dig, lhs->len, rhs->dig, rhs->len);
+    } else
+    #endif
+    {
+        memset(dest->dig, 0, dest->alloc * sizeof(mpz_dig_t));
+        dest->len = mpn_mul(dest->dig, lhs->dig, lhs->len, rhs->dig, rhs->len);
+    }
 
     if (lhs->neg == rhs->neg) {
         dest->neg = 0;
@@ -1363,6 +1740,114 @@ void mpz_pow_inpl(mpz_t *dest, const mpz_t *lhs, const mpz_t *rhs) {
     mpz_free(n);
 }
 
+#if MICROPY_OPT_MPZ_FAST_MUL
+
+#define MPZ_POW3_WINDOW_BITS (4)
+
+/* computes i = j * k / B^nlen mod n, with j, k, i having nlen digits
+   t needs 2 * nlen + 1 digits of space and scratch enough for mpn_mul_rec
+*/
+STATIC void mpn_mont_mul(mpz_dig_t *idig, const mpz_dig_t *jdig, const mpz_dig_t *kdig, const mpz_dig_t *ndig, size_t nlen, mpz_dig_t ninv, mpz_dig_t *t, mpz_dig_t *scratch) {
+    mpn_mul_rec(t, jdig, nlen, kdig, nlen, scratch);
+    t[2 * nlen] = 0;
+    mpn_redc(t, ndig, nlen, ninv);
+    memcpy(idig, t, nlen * sizeof(mpz_dig_t));
+}
+
+// Sets z = lhs * B^nlen mod n, as nlen digits.
+STATIC void mpz_to_mont(mpz_dig_t *z, const mpz_t *lhs, const mpz_t *mod) {
+    mpz_t t, quo;
+    mpz_init_zero(&t);
+    mpz_init_zero(&quo);
+    mpz_shl_inpl(&t, lhs, mod->len * DIG_SIZE);
+    mpz_divmod_inpl(&quo, &t, &t, mod);
+    memset(z, 0, mod->len * sizeof(mpz_dig_t));
+    memcpy(z, t.dig, t.len * sizeof(mpz_dig_t));
+    mpz_deinit(&t);
+    mpz_deinit(&quo);
+}
+
+/* computes dest = (lhs ** rhs) % mod using Montgomery multiplication
+   assumes 0 <= lhs, 0 < rhs and mod is odd and greater than 1
+   can't have dest the same as mod
+*/
+STATIC void mpz_pow3_mont(mpz_t *dest, const mpz_t *lhs, const mpz_t *rhs, const mpz_t *mod) {
+    const mpz_dig_t *ndig = mod->dig;
+    size_t nlen = mod->len;
+
+    // -1/n mod B by Newton's iteration; each step doubles the number of
+    // correct low bits, starting with 3 bits as n * n = 1 mod 8 for odd n
+    mpz_dbl_dig_t inv = ndig[0];
+    for (size_t bits = 3; bits < DIG_SIZE; bits *= 2) {
+        inv = (inv * (2 - ndig[0] * inv)) & DIG_MASK;
+    }
+    mpz_dig_t ninv = (DIG_BASE - inv) & DIG_MASK;
+
+    // table of lhs ** a in Montgomery form for each window value a, then the
+    // accumulator, a temporary product and scratch space for multiplying
+    size_t n_table = 1 << MPZ_POW3_WINDOW_BITS;
+    size_t scratch_len = mpn_mul_rec_scratch_len(nlen);
+    size_t buf_len = (n_table + 1) * nlen + 2 * nlen + 1 + scratch_len;
+    mpz_dig_t *buf = m_new(mpz_dig_t, buf_len);
+    mpz_dig_t *table = buf;
+    mpz_dig_t *acc = table + n_table * nlen;
+    mpz_dig_t *t = acc + nlen;
+    mpz_dig_t *scratch = t + 2 * nlen + 1;
+
+    mpz_t one;
+    mpz_dig_t one_dig[MPZ_NUM_DIG_FOR_INT];
+    mpz_init_fixed_from_int(&one, one_dig, MPZ_NUM_DIG_FOR_INT, 1);
+    mpz_to_mont(table, &one, mod);
+    mpz_to_mont(table + nlen, lhs, mod);
+    for (size_t a = 2; a < n_table; ++a) {
+        mpn_mont_mul(table + a * nlen, table + (a - 1) * nlen, table + nlen, ndig, nlen, ninv, t, scratch);
+    }
+
+    // go through the exponent a window at a time from the top
+    size_t n_bits = rhs->len * DIG_SIZE;
+    n_bits += MPZ_POW3_WINDOW_BITS - 1;
+    n_bits -= n_bits % MPZ_POW3_WINDOW_BITS;
+    bool started = false;
+    while (n_bits > 0) {
+        size_t window = 0;
+        for (size_t b = 0; b < MPZ_POW3_WINDOW_BITS; ++b) {
+            --n_bits;
+            size_t d = n_bits / DIG_SIZE;
+            window <<= 1;
+            if (d < rhs->len) {
+                window |= (rhs->dig[d] >> (n_bits % DIG_SIZE)) & 1;
+            }
+        }
+        if (started) {
+            for (size_t b = 0; b < MPZ_POW3_WINDOW_BITS; ++b) {
+                mpn_mont_mul(acc, acc, acc, ndig, nlen, ninv, t, scratch);
+            }
+            if (window != 0) {
+                mpn_mont_mul(acc, acc, table + window * nlen, ndig, nlen, ninv, t, scratch);
+            }
+        } else if (window != 0) {
+            memcpy(acc, table + window * nlen, nlen * sizeof(mpz_dig_t));
+            started = true;
+        }
+        #ifdef RUN_BACKGROUND_TASKS
+        RUN_BACKGROUND_TASKS;
+        #endif
+    }
+
+    // convert out of Montgomery form
+    memcpy(t, acc, nlen * sizeof(mpz_dig_t));
+    memset(t + nlen, 0, (nlen + 1) * sizeof(mpz_dig_t));
+    mpn_redc(t, ndig, nlen, ninv);
+    mpz_need_dig(dest, nlen);
+    memcpy(dest->dig, t, nlen * sizeof(mpz_dig_t));
+    dest->len = mpn_remove_trailing_zeros(dest->dig, dest->dig + nlen);
+    dest->neg = 0;
+
+    m_del(mpz_dig_t, buf, buf_len);
+}
+
+#endif
+
 /* computes dest = (lhs ** rhs) % mod
    can have dest, lhs, rhs the same; mod can't be the same as dest
 */
@@ -1372,11 +1857,19 @@ void mpz_pow3_inpl(mpz_t *dest, const mpz_t *lhs, const mpz_t *rhs, const mpz_t
         return;
     }
 
-    mpz_set_from_int(dest, 1);
-
     if (rhs->len == 0) {
+        mpz_set_from_int(dest, 1);
+        return;
+    }
+
+    #if MICROPY_OPT_MPZ_FAST_MUL
+    if (lhs->neg == 0 && mod->neg == 0 && mod->len > 1 && (mod->dig[0] & 1) != 0) {
+        mpz_pow3_mont(dest, lhs, rhs, mod);
         return;
     }
+    #endif
+
+    mpz_set_from_int(dest, 1);
 
     mpz_t *x = mpz_clone(lhs);
     mpz_t *n = mpz_clone(rhs);
@@ -1651,6 +2144,91 @@ char *mpz_as_str(const mpz_t *i, unsigned int base) {
 }
 #endif
 
+#if MICROPY_OPT_MPZ_FAST_STR
+
+typedef struct _mpz_str_out_t {
+    char *s;
+    char *last_comma;
+    char base_char;
+    char comma;
+    mpz_str_pow_t tab;
+} mpz_str_out_t;
+
+STATIC void mpz_str_out_digit(mpz_str_out_t *out, mpz_dig_t a) {
+    a += '0';
+    if (a > '9') {
+        a += out->base_char - '9' - 1;
+    }
+    *out->s++ = a;
+    if (out->comma && (out->s - out->last_comma) == 3) {
+        *out->s++ = out->comma;
+        out->last_comma = out->s;
+    }
+}
+
+/* writes the digits of i, least significant first, a chunk at a time
+   if pad is non-zero then writes exactly pad digits (i must fit)
+*/
+STATIC void mpz_as_str_digits(mpz_str_out_t *out, const mpz_t *i, size_t pad) {
+    size_t len = i->len;
+    mpz_dig_t *dig = m_new(mpz_dig_t, len);
+    memcpy(dig, i->dig, len * sizeof(mpz_dig_t));
+
+    size_t n = 0;
+    do {
+        mpz_dbl_dig_t a = 0;
+        for (size_t j = len; j > 0; --j) {
+            a = (a << DIG_SIZE) | dig[j - 1];
+            dig[j - 1] = a / out->tab.chunk;
+            a %= out->tab.chunk;
+        }
+        while (len > 0 && dig[len - 1] == 0) {
+            --len;
+        }
+
+        // all of the chunk is written unless it is the leading one
+        size_t c = out->tab.chunk_len;
+        do {
+            mpz_str_out_digit(out, a % out->tab.base);
+            a /= out->tab.base;
+            ++n;
+        } while (--c > 0 && (len > 0 || a > 0));
+    } while (len > 0);
+
+    for (; n < pad; ++n) {
+        mpz_str_out_digit(out, 0);
+    }
+
+    m_del(mpz_dig_t, dig, i->len);
+}
+
+/* writes the digits of i, least significant first
+   assumes 0 <= i < chunk ** (2 ** level), and if pad is true writes exactly
+   chunk_len * 2 ** level digits
+*/
+STATIC void mpz_as_str_rec(mpz_str_out_t *out, const mpz_t *i, size_t level, bool pad) {
+    if (level == 0 || i->len < MPZ_STR_DC_THRESHOLD) {
+        mpz_as_str_digits(out, i, pad ? out->tab.chunk_len << level : 0);
+        return;
+    }
+
+    if (!pad && mpz_cmp(i, mpz_str_pow(&out->tab, level - 1)) < 0) {
+        mpz_as_str_rec(out, i, level - 1, false);
+        return;
+    }
+
+    mpz_t quo, rem;
+    mpz_init_zero(&quo);
+    mpz_init_zero(&rem);
+    mpz_str_divmod(&out->tab, &quo, &rem, i, level - 1);
+    mpz_as_str_rec(out, &rem, level - 1, true);
+    mpz_deinit(&rem);
+    mpz_as_str_rec(out, &quo, level - 1, pad);
+    mpz_deinit(&quo);
+}
+
+#endif
+
 // assumes enough space in str as calculated by mp_int_format_size
 // base must be between 2 and 32 inclusive
 // returns length of string, not including null byte
@@ -1671,6 +2249,31 @@ size_t mpz_as_str_inpl(const mpz_t *i, unsigned int base, const char *prefix, ch
         return s - str;
     }
 
+    #if MICROPY_OPT_MPZ_FAST_STR
+    mpz_str_out_t out;
+    out.s = str;
+    out.last_comma = str;
+    out.base_char = base_char;
+    out.comma = comma;
+    mpz_str_pow_init(&out.tab, base);
+
+    // the digits of i are only read, so can be shared with its absolute value
+    mpz_t abs_i = *i;
+    abs_i.neg = 0;
+
+    // find a level with chunk ** (2 ** level) > i, without computing that
+    // power if the one below it is already big enough to square past i
+    size_t level = 0;
+    while (mpz_cmp(mpz_str_pow(&out.tab, level), &abs_i) <= 0) {
+        ++level;
+        if (2 * out.tab.pow[level - 1].len - 2 >= ilen) {
+            break;
+        }
+    }
+    mpz_as_str_rec(&out, &abs_i, level, false);
+    mpz_str_pow_deinit(&out.tab);
+    s = out.s;
+    #else
     // make a copy of mpz digits, so we can do the div/mod calculation
     mpz_dig_t *dig = m_new(mpz_dig_t, ilen);
     memcpy(dig, i->dig, ilen * sizeof(mpz_dig_t));
@@ -1713,6 +2316,7 @@ size_t mpz_as_str_inpl(const mpz_t *i, unsigned int base, const char *prefix, ch
 
     // free the copy of the digits array
     m_del(mpz_dig_t, dig, ilen);
+    #endif
 
     if (prefix) {
         const char *p = &prefix[strlen(prefix)];
@@ -86,6 +86,18 @@ typedef int8_t mpz_dbl_dig_signed_t;
   #define MPZ_LONG_1 1L
 #endif
 
+// Numbers are multiplied using Karatsuba's algorithm, when MICROPY_OPT_MPZ_FAST_MUL
+// is enabled, once both of them have at least this many digits.  Must be at least 8.
+#ifndef MPZ_KARATSUBA_THRESHOLD
+#define MPZ_KARATSUBA_THRESHOLD (32)
+#endif
+
+// Numbers with at least this many digits are converted to and from strings by
+// divide and conquer, when MICROPY_OPT_MPZ_FAST_STR is enabled.
+#ifndef MPZ_STR_DC_THRESHOLD
+#define MPZ_STR_DC_THRESHOLD (2 * MPZ_KARATSUBA_THRESHOLD)
+#endif
+
 // these define the maximum storage needed to hold an int or long long
 #define MPZ_NUM_DIG_FOR_INT ((sizeof(mp_int_t) * 8 + MPZ_DIG_SIZE - 1) / MPZ_DIG_SIZE)
 #define MPZ_NUM_DIG_FOR_LL ((sizeof(long long) * 8 + MPZ_DIG_SIZE - 1) / MPZ_DIG_SIZE)
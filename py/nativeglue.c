@@ -123,6 +123,15 @@ STATIC mp_obj_t mp_native_iternext(mp_obj_iter_buf_t *iter) {
     return mp_iternext(obj);
 }
 
+#if MICROPY_EMIT_NATIVE_TIERING
+// called on the backward jumps of tiered up code to do what the VM does there:
+// run background tasks and raise any pending exception, eg KeyboardInterrupt
+STATIC void mp_native_loop_hook(void) {
+    MICROPY_VM_HOOK_LOOP
+    mp_handle_pending();
+}
+#endif
+
 // these must correspond to the respective enum in runtime0.h
 void *const mp_fun_table[MP_F_NUMBER_OF] = {
     mp_convert_obj_to_native,
@@ -173,6 +182,9 @@ void *const mp_fun_table[MP_F_NUMBER_OF] = {
     mp_setup_code_state,
     mp_small_int_floor_divide,
     mp_small_int_modulo,
+#if MICROPY_EMIT_NATIVE_TIERING
+    mp_native_loop_hook,
+#endif
 };
 
 /*
@@ -496,16 +496,18 @@ STATIC mp_obj_t array_subscr(mp_obj_t self_in, mp_obj_t index_in, mp_obj_t value
                         src_items = (uint8_t*)src_items + (src_slice->free * item_sz);
                     }
                     #endif
-                } else if (MP_OBJ_IS_TYPE(value, &mp_type_bytes)) {
-                    if (item_sz != 1) {
+                } else {
+                    // any other object with the buffer protocol (except str)
+                    // is copied from directly, without an intermediate copy
+                    mp_buffer_info_t bufinfo;
+                    if (MP_OBJ_IS_STR(value) || !mp_get_buffer(value, &bufinfo, MP_BUFFER_READ)) {
+                        mp_raise_NotImplementedError(translate("array/bytes required on right side"));
+                    }
+                    if (item_sz != mp_binary_get_size('@', bufinfo.typecode & TYPECODE_MASK, NULL)) {
                         goto compat_error;
                     }
-                    mp_buffer_info_t bufinfo;
-                    mp_get_buffer_raise(value, &bufinfo, MP_BUFFER_READ);
-                    src_len = bufinfo.len;
+                    src_len = bufinfo.len / item_sz;
                     src_items = bufinfo.buf;
-                } else {
-                    mp_raise_NotImplementedError(translate("array/bytes required on right side"));
                 }
 
                 // TODO: check src/dst compat
@@ -524,6 +526,17 @@ STATIC mp_obj_t array_subscr(mp_obj_t self_in, mp_obj_t index_in, mp_obj_t value
                 }
                 #endif
                 if (len_adj > 0) {
+                    // The source may be a memoryview of this very array.
+                    // Growing moves the tail, or the whole buffer, before the
+                    // slice is copied in, so take a copy of the source first.
+                    byte *src_copy = NULL;
+                    size_t src_bytes = src_len * item_sz;
+                    if ((byte*)src_items < dest_items + (o->len + o->free) * item_sz
+                        && (byte*)src_items + src_bytes > dest_items) {
+                        src_copy = m_new(byte, src_bytes);
+                        memcpy(src_copy, src_items, src_bytes);
+                        src_items = src_copy;
+                    }
                     if ((mp_uint_t) len_adj > o->free) {
                         // TODO: alloc policy; at the moment we go conservative
                         o->items = m_renew(byte, o->items, (o->len + o->free) * item_sz, (o->len + len_adj) * item_sz);
@@ -532,6 +545,9 @@ STATIC mp_obj_t array_subscr(mp_obj_t self_in, mp_obj_t index_in, mp_obj_t value
                     }
                     mp_seq_replace_slice_grow_inplace(dest_items, o->len,
                         slice.start, slice.stop, src_items, src_len, len_adj, item_sz);
+                    if (src_copy != NULL) {
+                        m_del(byte, src_copy, src_bytes);
+                    }
                 } else {
                     mp_seq_replace_slice_no_grow(dest_items, o->len,
                         slice.start, slice.stop, src_items, src_len, item_sz);
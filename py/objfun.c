@@ -33,6 +33,7 @@
 #include "py/runtime.h"
 #include "py/bc.h"
 #include "py/stackctrl.h"
+#include "py/compile.h"
 
 #include "supervisor/linker.h"
 
@@ -169,7 +170,7 @@ qstr mp_obj_fun_get_name(mp_const_obj_t fun_in) {
     bc++; // skip n_pos_args
     bc++; // skip n_kwonly_args
     bc++; // skip n_def_pos_args
-    return mp_obj_code_get_name(bc);
+    return mp_bc_resolve_qstr(mp_obj_code_get_name(bc), fun->const_table);
 }
 
 #if MICROPY_CPYTHON_COMPAT
@@ -251,6 +252,68 @@ mp_code_state_t *mp_obj_fun_bc_prepare_codestate(mp_obj_t self_in, size_t n_args
 }
 #endif
 
+#if MICROPY_EMIT_NATIVE_TIERING
+STATIC mp_obj_t fun_native_call(mp_obj_t self_in, size_t n_args, size_t n_kw, const mp_obj_t *args);
+
+// Counts a call to an eligible bytecode function and, once its raw code is hot,
+// makes the native version of the function.  Returns true if self->tier_fun
+// is ready to be called instead of the bytecode.
+STATIC bool fun_bc_tier_up(mp_obj_fun_bc_t *self) {
+    mp_raw_code_t *rc = (mp_raw_code_t*)self->tier_rc;
+    if (rc->tier_native == NULL) {
+        if (rc->tier_count < MICROPY_EMIT_NATIVE_TIERING_THRESHOLD) {
+            rc->tier_count += 1;
+            return false;
+        }
+        if (rc->tier_count > MICROPY_EMIT_NATIVE_TIERING_THRESHOLD) {
+            // an earlier attempt to compile this function failed
+            self->tier_rc = NULL;
+            return false;
+        }
+        // only ever try to compile once
+        rc->tier_count = MICROPY_EMIT_NATIVE_TIERING_THRESHOLD + 1;
+        rc->tier_native = mp_compile_tier_up(rc);
+        if (rc->tier_native == NULL) {
+            self->tier_rc = NULL;
+            return false;
+        }
+    }
+
+    // the native function shares the globals and default args of this one
+    const byte *bc = self->bytecode;
+    bc = mp_decode_uint_skip(bc); // skip n_state
+    bc = mp_decode_uint_skip(bc); // skip n_exc_stack
+    size_t n_extra_args = bc[3]; // n_def_pos_args
+    if (bc[0] & MP_SCOPE_FLAG_DEFKWARGS) {
+        n_extra_args += 1;
+    }
+    mp_obj_fun_bc_t *o = m_new_obj_var(mp_obj_fun_bc_t, mp_obj_t, n_extra_args);
+    memcpy(o, self, sizeof(mp_obj_fun_bc_t) + n_extra_args * sizeof(mp_obj_t));
+    o->base.type = &mp_type_fun_native;
+    o->bytecode = rc->tier_native->data.u_native.fun_data;
+    o->const_table = rc->tier_native->data.u_native.const_table;
+    o->tier_rc = NULL;
+    self->tier_fun = MP_OBJ_FROM_PTR(o);
+    return true;
+}
+
+// Native code runs with the caller's globals, so switch them here like the VM does.
+STATIC mp_obj_t fun_bc_call_tiered(mp_obj_fun_bc_t *self, size_t n_args, size_t n_kw, const mp_obj_t *args) {
+    mp_obj_dict_t *old_globals = mp_globals_get();
+    mp_globals_set(self->globals);
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) == 0) {
+        mp_obj_t result = fun_native_call(self->tier_fun, n_args, n_kw, args);
+        nlr_pop();
+        mp_globals_set(old_globals);
+        return result;
+    } else {
+        mp_globals_set(old_globals);
+        nlr_jump(nlr.ret_val);
+    }
+}
+#endif
+
 STATIC mp_obj_t PLACE_IN_ITCM(fun_bc_call)(mp_obj_t self_in, size_t n_args, size_t n_kw, const mp_obj_t *args) {
     MP_STACK_CHECK();
 
@@ -262,6 +325,12 @@ STATIC mp_obj_t PLACE_IN_ITCM(fun_bc_call)(mp_obj_t self_in, size_t n_args, size
     mp_obj_fun_bc_t *self = MP_OBJ_TO_PTR(self_in);
     DEBUG_printf("Func n_def_args: %d\n", self->n_def_args);
 
+    #if MICROPY_EMIT_NATIVE_TIERING
+    if (self->tier_rc != NULL && (self->tier_fun != MP_OBJ_NULL || fun_bc_tier_up(self))) {
+        return fun_bc_call_tiered(self, n_args, n_kw, args);
+    }
+    #endif
+
     size_t n_state, state_size;
     DECODE_CODESTATE_SIZE(self->bytecode, n_state, state_size);
 
@@ -381,6 +450,10 @@ mp_obj_t mp_obj_new_fun_bc(mp_obj_t def_args_in, mp_obj_t def_kw_args, const byt
     o->globals = mp_globals_get();
     o->bytecode = code;
     o->const_table = const_table;
+    #if MICROPY_EMIT_NATIVE_TIERING
+    o->tier_rc = NULL;
+    o->tier_fun = MP_OBJ_NULL;
+    #endif
     if (def_args != NULL) {
         memcpy(o->extra_args, def_args->items, n_def_args * sizeof(mp_obj_t));
     }
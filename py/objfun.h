@@ -33,6 +33,10 @@ typedef struct _mp_obj_fun_bc_t {
     mp_obj_dict_t *globals;         // the context within which this function was defined
     const byte *bytecode;           // bytecode for the function
     const mp_uint_t *const_table;   // constant table
+    #if MICROPY_EMIT_NATIVE_TIERING
+    const struct _mp_raw_code_t *tier_rc; // raw code counting hotness, NULL if not eligible
+    mp_obj_t tier_fun;              // native version of this function, once tiered up
+    #endif
     // the following extra_args array is allocated space to take (in order):
     //  - values of positional default args (if any)
     //  - a single slot for default kw args dict (if it has them)
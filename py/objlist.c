@@ -289,6 +289,501 @@ STATIC mp_obj_t list_pop(size_t n_args, const mp_obj_t *args) {
     return ret;
 }
 
+#if MICROPY_PY_BUILTINS_LIST_SORT_STABLE
+
+// A simplified timsort: natural runs are found (descending ones reversed), short
+// runs are extended to a minimum length with binary insertion sort, and the runs
+// are merged while keeping their lengths balanced.  Merges switch to galloping
+// when one run keeps winning, so sorted and reversed input takes O(n) compares.
+// When there is a key function the keys are computed once up front and the sort
+// works on (key, item) pairs, so an element is a group of s->w words.
+
+#define LIST_SORT_MIN_GALLOP (7)
+
+typedef struct _list_sort_run_t {
+    mp_obj_t *base;
+    size_t len;
+} list_sort_run_t;
+
+typedef struct _list_sort_t {
+    size_t w; // number of words per element
+    bool reverse;
+    size_t min_gallop;
+    mp_obj_t *tmp;
+    size_t tmp_alloc; // in elements
+    // The part of the merge in progress that lives in tmp: n elements at src,
+    // which belong in the gap at dest (or just before src and dest if merging
+    // from the high end).  Used to restore the list if a comparison raises.
+    mp_obj_t *dest;
+    mp_obj_t *src;
+    size_t n;
+    bool hi;
+    size_t n_runs;
+    list_sort_run_t runs[];
+} list_sort_t;
+
+STATIC bool list_sort_lt(list_sort_t *s, const mp_obj_t *a, const mp_obj_t *b) {
+    if (s->reverse) {
+        const mp_obj_t *t = a;
+        a = b;
+        b = t;
+    }
+    return mp_obj_is_true(mp_binary_op(MP_BINARY_OP_LESS, *a, *b));
+}
+
+STATIC void list_sort_move(list_sort_t *s, mp_obj_t *dest, const mp_obj_t *src, size_t n) {
+    memmove(dest, src, n * s->w * sizeof(mp_obj_t));
+}
+
+// Whether elem belongs before key: if right is false this is elem < key, so
+// elements equal to key come after it, otherwise it is elem <= key.
+STATIC bool list_sort_before(list_sort_t *s, const mp_obj_t *key, const mp_obj_t *elem, bool right) {
+    return right ? !list_sort_lt(s, key, elem) : list_sort_lt(s, elem, key);
+}
+
+// Returns how many elements of the sorted a[0..n) belong before key, searching
+// outwards from a[hint] in exponentially growing steps and then bisecting.
+STATIC size_t list_sort_gallop(list_sort_t *s, const mp_obj_t *key, mp_obj_t *a, size_t n, size_t hint, bool right) {
+    size_t w = s->w;
+    size_t lo, hi;
+    size_t last = 0;
+    size_t ofs = 1;
+    if (list_sort_before(s, key, a + hint * w, right)) {
+        size_t max = n - hint;
+        while (ofs < max && list_sort_before(s, key, a + (hint + ofs) * w, right)) {
+            last = ofs;
+            ofs = (ofs << 1) + 1;
+        }
+        if (ofs > max) {
+            ofs = max;
+        }
+        lo = hint + last + 1;
+        hi = hint + ofs;
+    } else {
+        size_t max = hint + 1;
+        while (ofs < max && !list_sort_before(s, key, a + (hint - ofs) * w, right)) {
+            last = ofs;
+            ofs = (ofs << 1) + 1;
+        }
+        if (ofs > max) {
+            ofs = max;
+        }
+        lo = hint + 1 - ofs;
+        hi = hint - last;
+    }
+    // now a[lo - 1] belongs before key and a[hi] doesn't
+    while (lo < hi) {
+        size_t m = lo + ((hi - lo) >> 1);
+        if (list_sort_before(s, key, a + m * w, right)) {
+            lo = m + 1;
+        } else {
+            hi = m;
+        }
+    }
+    return hi;
+}
+
+STATIC mp_obj_t *list_sort_tmp(list_sort_t *s, size_t n) {
+    if (n > s->tmp_alloc) {
+        m_del(mp_obj_t, s->tmp, s->tmp_alloc * s->w);
+        s->tmp = NULL; // in case the allocation fails
+        s->tmp_alloc = 0;
+        s->tmp = m_new(mp_obj_t, n * s->w);
+        s->tmp_alloc = n;
+    }
+    return s->tmp;
+}
+
+// Merges the adjacent runs a and b, where na <= nb, b[0] < a[0] and a[na - 1]
+// is greater than all of b, working from the low end with a moved to tmp.
+STATIC void list_sort_merge_lo(list_sort_t *s, mp_obj_t *a, size_t na, mp_obj_t *b, size_t nb) {
+    size_t w = s->w;
+    s->dest = a;
+    s->src = list_sort_tmp(s, na);
+    list_sort_move(s, s->src, a, na);
+    s->n = na;
+    s->hi = false;
+    list_sort_move(s, s->dest, b, 1);
+    s->dest += w;
+    b += w;
+    if (--nb == 0) {
+        goto done;
+    }
+    if (s->n == 1) {
+        goto copy_b;
+    }
+    size_t min_gallop = s->min_gallop;
+    for (;;) {
+        size_t acount = 0;
+        size_t bcount = 0;
+        // merge one element at a time until one run starts winning consistently
+        do {
+            if (list_sort_lt(s, b, s->src)) {
+                list_sort_move(s, s->dest, b, 1);
+                s->dest += w;
+                b += w;
+                bcount++;
+                acount = 0;
+                if (--nb == 0) {
+                    goto done;
+                }
+            } else {
+                list_sort_move(s, s->dest, s->src, 1);
+                s->dest += w;
+                s->src += w;
+                acount++;
+                bcount = 0;
+                if (--s->n == 1) {
+                    goto copy_b;
+                }
+            }
+        } while (acount < min_gallop && bcount < min_gallop);
+        // then gallop, copying whole stretches, until that stops paying off
+        min_gallop++;
+        do {
+            min_gallop -= min_gallop > 1;
+            s->min_gallop = min_gallop;
+            acount = list_sort_gallop(s, b, s->src, s->n, 0, true);
+            if (acount != 0) {
+                list_sort_move(s, s->dest, s->src, acount);
+                s->dest += acount * w;
+                s->src += acount * w;
+                s->n -= acount;
+                if (s->n == 1) {
+                    goto copy_b;
+                }
+                if (s->n == 0) {
+                    goto done;
+                }
+            }
+            list_sort_move(s, s->dest, b, 1);
+            s->dest += w;
+            b += w;
+            if (--nb == 0) {
+                goto done;
+            }
+            bcount = list_sort_gallop(s, s->src, b, nb, 0, false);
+            if (bcount != 0) {
+                list_sort_move(s, s->dest, b, bcount);
+                s->dest += bcount * w;
+                b += bcount * w;
+                nb -= bcount;
+                if (nb == 0) {
+                    goto done;
+                }
+            }
+            list_sort_move(s, s->dest, s->src, 1);
+            s->dest += w;
+            s->src += w;
+            if (--s->n == 1) {
+                goto copy_b;
+            }
+        } while (acount >= LIST_SORT_MIN_GALLOP || bcount >= LIST_SORT_MIN_GALLOP);
+        min_gallop++;
+        s->min_gallop = min_gallop;
+    }
+copy_b:
+    // the last element of a goes after the rest of b
+    list_sort_move(s, s->dest, b, nb);
+    s->dest += nb * w;
+done:
+    list_sort_move(s, s->dest, s->src, s->n);
+    s->n = 0;
+}
+
+// Merges the adjacent runs a and b, where na >= nb, b[0] < a[0] and a[na - 1]
+// is greater than all of b, working from the high end with b moved to tmp.
+STATIC void list_sort_merge_hi(list_sort_t *s, mp_obj_t *a, size_t na, mp_obj_t *b, size_t nb) {
+    size_t w = s->w;
+    mp_obj_t *tmp = list_sort_tmp(s, nb);
+    list_sort_move(s, tmp, b, nb);
+    // dest, src and a point one past the elements still to be merged
+    s->dest = b + nb * w;
+    s->src = tmp + nb * w;
+    s->n = nb;
+    s->hi = true;
+    mp_obj_t *a_base = a;
+    a += na * w;
+    s->dest -= w;
+    a -= w;
+    list_sort_move(s, s->dest, a, 1);
+    if (--na == 0) {
+        goto done;
+    }
+    if (s->n == 1) {
+        goto copy_a;
+    }
+    size_t min_gallop = s->min_gallop;
+    for (;;) {
+        size_t acount = 0;
+        size_t bcount = 0;
+        do {
+            if (list_sort_lt(s, s->src - w, a - w)) {
+                s->dest -= w;
+                a -= w;
+                list_sort_move(s, s->dest, a, 1);
+                acount++;
+                bcount = 0;
+                if (--na == 0) {
+                    goto done;
+                }
+            } else {
+                s->dest -= w;
+                s->src -= w;
+                list_sort_move(s, s->dest, s->src, 1);
+                bcount++;
+                acount = 0;
+                if (--s->n == 1) {
+                    goto copy_a;
+                }
+            }
+        } while (acount < min_gallop && bcount < min_gallop);
+        min_gallop++;
+        do {
+            min_gallop -= min_gallop > 1;
+            s->min_gallop = min_gallop;
+            acount = na - list_sort_gallop(s, s->src - w, a_base, na, na - 1, true);
+            if (acount != 0) {
+                s->dest -= acount * w;
+                a -= acount * w;
+                list_sort_move(s, s->dest, a, acount);
+                na -= acount;
+                if (na == 0) {
+                    goto done;
+                }
+            }
+            s->dest -= w;
+            s->src -= w;
+            list_sort_move(s, s->dest, s->src, 1);
+            if (--s->n == 1) {
+                goto copy_a;
+            }
+            bcount = s->n - list_sort_gallop(s, a - w, tmp, s->n, s->n - 1, false);
+            if (bcount != 0) {
+                s->dest -= bcount * w;
+                s->src -= bcount * w;
+                list_sort_move(s, s->dest, s->src, bcount);
+                s->n -= bcount;
+                if (s->n == 1) {
+                    goto copy_a;
+                }
+                if (s->n == 0) {
+                    goto done;
+                }
+            }
+            s->dest -= w;
+            a -= w;
+            list_sort_move(s, s->dest, a, 1);
+            if (--na == 0) {
+                goto done;
+            }
+        } while (acount >= LIST_SORT_MIN_GALLOP || bcount >= LIST_SORT_MIN_GALLOP);
+        min_gallop++;
+        s->min_gallop = min_gallop;
+    }
+copy_a:
+    // the first element of b goes before the rest of a
+    s->dest -= na * w;
+    a -= na * w;
+    list_sort_move(s, s->dest, a, na);
+done:
+    list_sort_move(s, s->dest - s->n * w, tmp, s->n);
+    s->n = 0;
+}
+
+STATIC void list_sort_merge_at(list_sort_t *s, size_t i) {
+    size_t w = s->w;
+    mp_obj_t *a = s->runs[i].base;
+    size_t na = s->runs[i].len;
+    mp_obj_t *b = s->runs[i + 1].base;
+    size_t nb = s->runs[i + 1].len;
+    s->runs[i].len = na + nb;
+    if (i == s->n_runs - 3) {
+        s->runs[i + 1] = s->runs[i + 2];
+    }
+    s->n_runs--;
+
+    // elements of a not greater than b[0] are already in place, as are
+    // elements of b not less than the last of a
+    size_t k = list_sort_gallop(s, b, a, na, 0, true);
+    a += k * w;
+    na -= k;
+    if (na == 0) {
+        return;
+    }
+    nb = list_sort_gallop(s, a + (na - 1) * w, b, nb, nb - 1, false);
+    if (nb == 0) {
+        return;
+    }
+    if (na <= nb) {
+        list_sort_merge_lo(s, a, na, b, nb);
+    } else {
+        list_sort_merge_hi(s, a, na, b, nb);
+    }
+}
+
+// Merges pending runs until their lengths decrease faster than the Fibonacci
+// numbers from the bottom of the stack to the top.
+STATIC void list_sort_merge_collapse(list_sort_t *s) {
+    list_sort_run_t *r = s->runs;
+    while (s->n_runs > 1) {
+        size_t n = s->n_runs - 2;
+        if ((n > 0 && r[n - 1].len <= r[n].len + r[n + 1].len)
+            || (n > 1 && r[n - 2].len <= r[n - 1].len + r[n].len)) {
+            if (r[n - 1].len < r[n + 1].len) {
+                n--;
+            }
+        } else if (r[n].len > r[n + 1].len) {
+            break;
+        }
+        list_sort_merge_at(s, n);
+    }
+}
+
+// Returns the length of the run at the start of a[0..n), reversing it if it
+// is strictly descending.
+STATIC size_t list_sort_count_run(list_sort_t *s, mp_obj_t *a, size_t n) {
+    size_t w = s->w;
+    size_t len = 1;
+    if (n == 1) {
+        return len;
+    }
+    if (list_sort_lt(s, a + w, a)) {
+        for (len = 2; len < n && list_sort_lt(s, a + len * w, a + (len - 1) * w); len++) {
+        }
+        for (mp_obj_t *lo = a, *hi = a + (len - 1) * w; lo < hi; lo += w, hi -= w) {
+            for (size_t i = 0; i < w; i++) {
+                mp_obj_t t = lo[i];
+                lo[i] = hi[i];
+                hi[i] = t;
+            }
+        }
+    } else {
+        for (len = 2; len < n && !list_sort_lt(s, a + len * w, a + (len - 1) * w); len++) {
+        }
+    }
+    return len;
+}
+
+// Sorts a[0..n) given that a[0..start) is already sorted.
+STATIC void list_sort_binary_insertion(list_sort_t *s, mp_obj_t *a, size_t n, size_t start) {
+    size_t w = s->w;
+    for (size_t i = start; i < n; i++) {
+        mp_obj_t pivot[2];
+        list_sort_move(s, pivot, a + i * w, 1);
+        size_t lo = 0;
+        size_t hi = i;
+        while (lo < hi) {
+            size_t m = lo + ((hi - lo) >> 1);
+            if (list_sort_lt(s, pivot, a + m * w)) {
+                hi = m;
+            } else {
+                lo = m + 1;
+            }
+        }
+        list_sort_move(s, a + (lo + 1) * w, a + lo * w, i - lo);
+        list_sort_move(s, a + lo * w, pivot, 1);
+    }
+}
+
+STATIC void list_sort_run(list_sort_t *s, mp_obj_t *a, size_t n) {
+    // pick a minimum run length between 32 and 64 such that n / min_run is
+    // a power of 2 or just under one, so the final merges are balanced
+    size_t min_run = n;
+    size_t r = 0;
+    while (min_run >= 64) {
+        r |= min_run & 1;
+        min_run >>= 1;
+    }
+    min_run += r;
+
+    while (n != 0) {
+        size_t len = list_sort_count_run(s, a, n);
+        if (len < min_run) {
+            size_t force = n < min_run ? n : min_run;
+            list_sort_binary_insertion(s, a, force, len);
+            len = force;
+        }
+        s->runs[s->n_runs].base = a;
+        s->runs[s->n_runs].len = len;
+        s->n_runs++;
+        list_sort_merge_collapse(s);
+        a += len * s->w;
+        n -= len;
+    }
+    while (s->n_runs > 1) {
+        size_t i = s->n_runs - 2;
+        if (i > 0 && s->runs[i - 1].len < s->runs[i + 1].len) {
+            i--;
+        }
+        list_sort_merge_at(s, i);
+    }
+}
+
+STATIC void list_sort(mp_obj_list_t *self, mp_obj_t key_fn, bool reverse) {
+    size_t len = self->len;
+
+    // Pending runs are at least 32 long, except the last, and their lengths
+    // grow at least as fast as the Fibonacci numbers, so twice the bit length
+    // of len is plenty.
+    size_t max_runs = 2;
+    for (size_t n = len; n != 0; n >>= 1) {
+        max_runs += 2;
+    }
+    // The state is on the heap so that it is up to date when read after a
+    // comparison raises, rather than left in registers by the longjmp.
+    list_sort_t *s = m_new_obj_var(list_sort_t, list_sort_run_t, max_runs);
+    s->w = key_fn == MP_OBJ_NULL ? 1 : 2;
+    s->reverse = reverse;
+    s->min_gallop = LIST_SORT_MIN_GALLOP;
+    s->tmp = NULL;
+    s->tmp_alloc = 0;
+    s->n = 0;
+    s->n_runs = 0;
+
+    mp_obj_t *a = self->items;
+    if (key_fn != MP_OBJ_NULL) {
+        // decorate each item with its key
+        a = m_new(mp_obj_t, 2 * len);
+        for (size_t i = 0; i < len; i++) {
+            a[2 * i] = mp_call_function_1(key_fn, self->items[i]);
+            a[2 * i + 1] = self->items[i];
+        }
+    }
+
+    void *exc = NULL;
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) == 0) {
+        list_sort_run(s, a, len);
+        nlr_pop();
+    } else {
+        exc = nlr.ret_val;
+        if (s->n != 0) {
+            // a comparison raised in the middle of a merge, put back the elements
+            // from tmp so that the list still holds all of its items
+            if (s->hi) {
+                list_sort_move(s, s->dest - s->n * s->w, s->src - s->n * s->w, s->n);
+            } else {
+                list_sort_move(s, s->dest, s->src, s->n);
+            }
+        }
+    }
+
+    if (key_fn != MP_OBJ_NULL) {
+        for (size_t i = 0; i < len; i++) {
+            self->items[i] = a[2 * i + 1];
+        }
+        m_del(mp_obj_t, a, 2 * len);
+    }
+    m_del(mp_obj_t, s->tmp, s->tmp_alloc * s->w);
+    m_del_var(list_sort_t, list_sort_run_t, max_runs, s);
+    if (exc != NULL) {
+        nlr_jump(exc);
+    }
+}
+
+#else
+
 STATIC void mp_quicksort(mp_obj_t *head, mp_obj_t *tail, mp_obj_t key_fn, mp_obj_t binop_less_result) {
     MP_STACK_CHECK();
     while (head < tail) {
@@ -317,7 +812,10 @@ STATIC void mp_quicksort(mp_obj_t *head, mp_obj_t *tail, mp_obj_t key_fn, mp_obj
     }
 }
 
-// TODO Python defines sort to be stable but ours is not
+#endif
+
+// TODO Python defines sort to be stable but ours is not, unless
+// MICROPY_PY_BUILTINS_LIST_SORT_STABLE is enabled
 mp_obj_t mp_obj_list_sort(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
     static const mp_arg_t allowed_args[] = {
         { MP_QSTR_key, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_rom_obj = MP_ROM_PTR(&mp_const_none_obj)} },
@@ -335,9 +833,14 @@ mp_obj_t mp_obj_list_sort(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_
     mp_obj_list_t *self = mp_instance_cast_to_native_base(pos_args[0], &mp_type_list);
 
     if (self->len > 1) {
+        #if MICROPY_PY_BUILTINS_LIST_SORT_STABLE
+        list_sort(self, args.key.u_obj == mp_const_none ? MP_OBJ_NULL : args.key.u_obj,
+                  args.reverse.u_bool);
+        #else
         mp_quicksort(self->items, self->items + self->len - 1,
                      args.key.u_obj == mp_const_none ? MP_OBJ_NULL : args.key.u_obj,
                      args.reverse.u_bool ? mp_const_false : mp_const_true);
+        #endif
     }
 
     return mp_const_none;
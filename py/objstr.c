@@ -242,6 +242,11 @@ STATIC mp_obj_t bytes_make_new(const mp_obj_type_t *type_in, size_t n_args, cons
         goto wrong_args;
     }
 
+    // bytes are immutable, so bytes(b) can return b itself
+    if (MP_OBJ_IS_TYPE(args[0], &mp_type_bytes)) {
+        return args[0];
+    }
+
     // check if __bytes__ exists, and if so delegate to it
     mp_obj_t dest[2];
     mp_load_method_maybe(args[0], MP_QSTR___bytes__, dest);
@@ -2021,7 +2026,10 @@ mp_obj_t mp_obj_new_str_copy(const mp_obj_type_t *type, const byte* data, size_t
     o->base.type = type;
     o->len = len;
     if (data) {
-        o->hash = qstr_compute_hash(data, len);
+        // A hash of 0 means "not computed yet".  bytes are rarely hashed, so
+        // leave it to the first lookup, which stores it, rather than making
+        // another pass here.
+        o->hash = (type == &mp_type_bytes) ? 0 : qstr_compute_hash(data, len);
         byte *p = m_new(byte, len + 1);
         o->data = p;
         memcpy(p, data, len * sizeof(byte));
@@ -2064,7 +2072,7 @@ mp_obj_t mp_obj_new_str_from_vstr(const mp_obj_type_t *type, vstr_t *vstr) {
     mp_obj_str_t *o = m_new_obj(mp_obj_str_t);
     o->base.type = type;
     o->len = vstr->len;
-    o->hash = qstr_compute_hash((byte*)vstr->buf, vstr->len);
+    o->hash = (type == &mp_type_bytes) ? 0 : qstr_compute_hash((byte*)vstr->buf, vstr->len);
     if (vstr->len + 1 == vstr->alloc) {
         o->data = (byte*)vstr->buf;
     } else {
@@ -251,9 +251,63 @@ STATIC const uint16_t *get_rule_arg(uint8_t r_id) {
     return &rule_arg_combined_table[off];
 }
 
+#if MICROPY_COMPILE_ARENA
+// The stacks are freed when parsing finishes, before the tree is, so they are
+// separate allocations but also kept at the long-lived end of the heap
+#define parser_new_stack_maybe(type, num) m_new_ll_maybe(type, num)
+#define parser_renew_stack(type, ptr, old_num, new_num) m_renew_ll(type, ptr, old_num, new_num)
+#else
+#define parser_new_stack_maybe(type, num) m_new_maybe(type, num)
+#define parser_renew_stack(type, ptr, old_num, new_num) m_renew(type, ptr, old_num, new_num)
+#endif
+
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wcast-align"
 
+#if MICROPY_COMPILE_ARENA
+
+STATIC void *parser_alloc(parser_t *parser, size_t num_bytes) {
+    // bump-allocate parse nodes from an arena of blocks at the long-lived end
+    // of the heap; the blocks are all freed by mp_parse_tree_clear
+
+    mp_parse_chunk_t *chunk = parser->cur_chunk;
+
+    if (chunk != NULL && chunk->union_.used + num_bytes > chunk->alloc) {
+        // block is full; it's never resized, just linked into the chain
+        chunk->union_.next = parser->tree.chunk;
+        parser->tree.chunk = chunk;
+        chunk = NULL;
+    }
+
+    if (chunk == NULL) {
+        size_t alloc = MICROPY_ALLOC_PARSE_ARENA_BLOCK - sizeof(mp_parse_chunk_t);
+        if (alloc < num_bytes) {
+            alloc = num_bytes;
+        }
+        chunk = (mp_parse_chunk_t*)m_new_ll_maybe(byte, sizeof(mp_parse_chunk_t) + alloc);
+        while (chunk == NULL) {
+            // no room for a whole block, so try smaller ones down to what is
+            // needed for this node, which raises MemoryError if it doesn't fit
+            alloc /= 2;
+            if (alloc <= num_bytes) {
+                alloc = num_bytes;
+                chunk = (mp_parse_chunk_t*)m_new_ll(byte, sizeof(mp_parse_chunk_t) + alloc);
+            } else {
+                chunk = (mp_parse_chunk_t*)m_new_ll_maybe(byte, sizeof(mp_parse_chunk_t) + alloc);
+            }
+        }
+        chunk->alloc = alloc;
+        chunk->union_.used = 0;
+        parser->cur_chunk = chunk;
+    }
+
+    byte *ret = chunk->data + chunk->union_.used;
+    chunk->union_.used += num_bytes;
+    return ret;
+}
+
+#else
+
 STATIC void *parser_alloc(parser_t *parser, size_t num_bytes) {
     // use a custom memory allocator to store parse nodes sequentially in large chunks
 
@@ -294,11 +348,13 @@ STATIC void *parser_alloc(parser_t *parser, size_t num_bytes) {
     chunk->union_.used += num_bytes;
     return ret;
 }
+
+#endif
 #pragma GCC diagnostic pop
 
 STATIC void push_rule(parser_t *parser, size_t src_line, uint8_t rule_id, size_t arg_i) {
     if (parser->rule_stack_top >= parser->rule_stack_alloc) {
-        rule_stack_t *rs = m_renew(rule_stack_t, parser->rule_stack, parser->rule_stack_alloc, parser->rule_stack_alloc + MICROPY_ALLOC_PARSE_RULE_INC);
+        rule_stack_t *rs = parser_renew_stack(rule_stack_t, parser->rule_stack, parser->rule_stack_alloc, parser->rule_stack_alloc + MICROPY_ALLOC_PARSE_RULE_INC);
         parser->rule_stack = rs;
         parser->rule_stack_alloc += MICROPY_ALLOC_PARSE_RULE_INC;
     }
@@ -439,7 +495,7 @@ STATIC mp_parse_node_t peek_result(parser_t *parser, size_t pos) {
 
 STATIC void push_result_node(parser_t *parser, mp_parse_node_t pn) {
     if (parser->result_stack_top >= parser->result_stack_alloc) {
-        mp_parse_node_t *stack = m_renew(mp_parse_node_t, parser->result_stack, parser->result_stack_alloc, parser->result_stack_alloc + MICROPY_ALLOC_PARSE_RESULT_INC);
+        mp_parse_node_t *stack = parser_renew_stack(mp_parse_node_t, parser->result_stack, parser->result_stack_alloc, parser->result_stack_alloc + MICROPY_ALLOC_PARSE_RESULT_INC);
         parser->result_stack = stack;
         parser->result_stack_alloc += MICROPY_ALLOC_PARSE_RESULT_INC;
     }
@@ -848,7 +904,7 @@ mp_parse_tree_t mp_parse(mp_lexer_t *lex, mp_parse_input_kind_t input_kind) {
     parser.rule_stack_top = 0;
     parser.rule_stack = NULL;
     while (parser.rule_stack_alloc > 1) {
-        parser.rule_stack = m_new_maybe(rule_stack_t, parser.rule_stack_alloc);
+        parser.rule_stack = parser_new_stack_maybe(rule_stack_t, parser.rule_stack_alloc);
         if (parser.rule_stack != NULL) {
             break;
         } else {
@@ -860,7 +916,7 @@ mp_parse_tree_t mp_parse(mp_lexer_t *lex, mp_parse_input_kind_t input_kind) {
     parser.result_stack_top = 0;
     parser.result_stack = NULL;
     while (parser.result_stack_alloc > 1) {
-        parser.result_stack = m_new_maybe(mp_parse_node_t, parser.result_stack_alloc);
+        parser.result_stack = parser_new_stack_maybe(mp_parse_node_t, parser.result_stack_alloc);
         if (parser.result_stack != NULL) {
             break;
         } else {
@@ -1152,13 +1208,16 @@ mp_parse_tree_t mp_parse(mp_lexer_t *lex, mp_parse_input_kind_t input_kind) {
     mp_map_deinit(&parser.consts);
     #endif
 
-    // truncate final chunk and link into chain of chunks
+    // truncate final chunk (arena blocks are left as they are) and link into
+    // chain of chunks
     if (parser.cur_chunk != NULL) {
+        #if !MICROPY_COMPILE_ARENA
         (void)m_renew_maybe(byte, parser.cur_chunk,
             sizeof(mp_parse_chunk_t) + parser.cur_chunk->alloc,
             sizeof(mp_parse_chunk_t) + parser.cur_chunk->union_.used,
             false);
         parser.cur_chunk->alloc = parser.cur_chunk->union_.used;
+        #endif
         parser.cur_chunk->union_.next = parser.tree.chunk;
         parser.tree.chunk = parser.cur_chunk;
     }
@@ -1235,6 +1294,10 @@ mp_parse_tree_t mp_parse(mp_lexer_t *lex, mp_parse_input_kind_t input_kind) {
     m_del(rule_stack_t, parser.rule_stack, parser.rule_stack_alloc);
     m_del(mp_parse_node_t, parser.result_stack, parser.result_stack_alloc);
 
+    #if MICROPY_EMIT_NATIVE_TIERING
+    parser.tree.source_hash = lex->source_hash;
+    #endif
+
     // we also free the lexer on behalf of the caller
     mp_lexer_free(lex);
 
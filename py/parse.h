@@ -97,6 +97,9 @@ typedef enum {
 typedef struct _mp_parse_t {
     mp_parse_node_t root;
     struct _mp_parse_chunk_t *chunk;
+    #if MICROPY_EMIT_NATIVE_TIERING
+    uint32_t source_hash;
+    #endif
 } mp_parse_tree_t;
 
 // the parser will raise an exception if an error occurred
@@ -168,24 +168,114 @@ STATIC mp_obj_t load_obj(mp_reader_t *reader) {
     return MP_OBJ_FROM_PTR(&mp_const_none_obj);
 }
 
-STATIC void load_bytecode_qstrs(mp_reader_t *reader, byte *ip, byte *ip_top) {
+#if MICROPY_PERSISTENT_CODE_LOAD_XIP
+
+// Reader over .mpy data that is addressable in memory, which lets bytecode be
+// used where it lies instead of being copied to RAM.
+typedef struct _mp_reader_xip_t {
+    const byte *cur;
+    const byte *end;
+    mp_obj_t owner;
+} mp_reader_xip_t;
+
+STATIC mp_uint_t mp_reader_xip_readbyte(void *data) {
+    mp_reader_xip_t *reader = (mp_reader_xip_t*)data;
+    if (reader->cur < reader->end) {
+        return *reader->cur++;
+    } else {
+        return MP_READER_EOF;
+    }
+}
+
+STATIC void mp_reader_xip_close(void *data) {
+    (void)data;
+}
+
+// Returns a pointer to the next len bytes of the reader and skips them, or NULL
+// if the reader's data is not in memory.
+STATIC const byte *read_bytes_in_place(mp_reader_t *reader, size_t len) {
+    if (reader->readbyte != mp_reader_xip_readbyte) {
+        return NULL;
+    }
+    mp_reader_xip_t *xip = (mp_reader_xip_t*)reader->data;
+    if ((size_t)(xip->end - xip->cur) < len) {
+        raise_corrupt_mpy();
+    }
+    const byte *buf = xip->cur;
+    xip->cur += len;
+    return buf;
+}
+
+#endif
+
+STATIC void store_qstr(byte *ip, qstr qst) {
+    ip[0] = qst;
+    ip[1] = qst >> 8;
+}
+
+// If qstrs is NULL then the qstrs are linked into the bytecode as they are
+// loaded, otherwise they are stored in qstrs, after simple_name and source_file.
+STATIC void load_bytecode_qstrs(mp_reader_t *reader, byte *ip, byte *ip_top, qstr *qstrs) {
     while (ip < ip_top) {
         size_t sz;
         uint f = mp_opcode_format(ip, &sz);
         if (f == MP_OPCODE_QSTR) {
             qstr qst = load_qstr(reader);
-            ip[1] = qst;
-            ip[2] = qst >> 8;
+            if (qstrs == NULL) {
+                store_qstr(ip + 1, qst);
+            } else {
+                *qstrs++ = qst;
+            }
+        }
+        ip += sz;
+    }
+}
+
+#if MICROPY_PERSISTENT_CODE_LOAD_XIP
+STATIC size_t count_bytecode_qstrs(const byte *ip, const byte *ip_top) {
+    size_t n = 0;
+    while (ip < ip_top) {
+        size_t sz;
+        n += mp_opcode_format(ip, &sz) == MP_OPCODE_QSTR;
+        ip += sz;
+    }
+    return n;
+}
+
+// Checks that every qstr slot of the bytecode refers to the constant table
+// entry that the qstr at the same position in qstrs will be stored in.
+STATIC bool bytecode_qstrs_in_const_table(const byte *ip2, const byte *ip, const byte *ip_top, size_t ct_ofs) {
+    if ((ip2[0] | (ip2[1] << 8)) != (MP_BC_QSTR_IN_CONST_TABLE | ct_ofs)
+        || (ip2[2] | (ip2[3] << 8)) != (MP_BC_QSTR_IN_CONST_TABLE | (ct_ofs + 1))) {
+        return false;
+    }
+    ct_ofs += 2;
+    while (ip < ip_top) {
+        size_t sz;
+        if (mp_opcode_format(ip, &sz) == MP_OPCODE_QSTR) {
+            if ((ip[1] | (ip[2] << 8)) != (MP_BC_QSTR_IN_CONST_TABLE | ct_ofs++)) {
+                return false;
+            }
         }
         ip += sz;
     }
+    return true;
 }
+#endif
 
 STATIC mp_raw_code_t *load_raw_code(mp_reader_t *reader) {
-    // load bytecode
+    // load bytecode, using it in place if possible
     size_t bc_len = read_uint(reader);
-    byte *bytecode = m_new(byte, bc_len);
-    read_bytes(reader, bytecode, bc_len);
+    byte *bytecode = NULL;
+    #if MICROPY_PERSISTENT_CODE_LOAD_XIP && !MICROPY_OPT_CACHE_MAP_LOOKUP_IN_BYTECODE
+    // (the map lookup cache is stored in the bytecode so it must be writable)
+    bytecode = (byte*)read_bytes_in_place(reader, bc_len);
+    #endif
+    bool in_place = bytecode != NULL;
+    if (!in_place) {
+        bytecode = m_new(byte, bc_len);
+        read_bytes(reader, bytecode, bc_len);
+    }
 
     // extract prelude
     const byte *ip = bytecode;
@@ -193,17 +283,35 @@ STATIC mp_raw_code_t *load_raw_code(mp_reader_t *reader) {
     bytecode_prelude_t prelude;
     extract_prelude(&ip, &ip2, &prelude);
 
-    // load qstrs and link global qstr ids into bytecode
+    // load qstrs and link global qstr ids into bytecode, or keep them aside
+    // to go in the constant table if the bytecode is used in place
+    qstr *qstrs = NULL;
+    size_t n_qstr = 0;
+    #if MICROPY_PERSISTENT_CODE_LOAD_XIP
+    if (in_place) {
+        n_qstr = 2 + count_bytecode_qstrs(ip, bytecode + bc_len);
+        qstrs = m_new(qstr, n_qstr);
+    }
+    #endif
     qstr simple_name = load_qstr(reader);
     qstr source_file = load_qstr(reader);
-    ((byte*)ip2)[0] = simple_name; ((byte*)ip2)[1] = simple_name >> 8;
-    ((byte*)ip2)[2] = source_file; ((byte*)ip2)[3] = source_file >> 8;
-    load_bytecode_qstrs(reader, (byte*)ip, bytecode + bc_len);
+    if (qstrs == NULL) {
+        store_qstr((byte*)ip2, simple_name);
+        store_qstr((byte*)ip2 + 2, source_file);
+        load_bytecode_qstrs(reader, (byte*)ip, bytecode + bc_len, NULL);
+    } else {
+        qstrs[0] = simple_name;
+        qstrs[1] = source_file;
+        load_bytecode_qstrs(reader, (byte*)ip, bytecode + bc_len, qstrs + 2);
+    }
 
     // load constant table
     size_t n_obj = read_uint(reader);
     size_t n_raw_code = read_uint(reader);
-    mp_uint_t *const_table = m_new(mp_uint_t, prelude.n_pos_args + prelude.n_kwonly_args + n_obj + n_raw_code);
+    size_t n_ct = prelude.n_pos_args + prelude.n_kwonly_args + n_obj + n_raw_code;
+    // bytecode used in place also gets a last entry, holding the owner of its
+    // memory, which the GC then keeps alive for as long as the code is in use
+    mp_uint_t *const_table = m_new(mp_uint_t, n_ct + n_qstr + in_place);
     mp_uint_t *ct = const_table;
     for (size_t i = 0; i < prelude.n_pos_args + prelude.n_kwonly_args; ++i) {
         *ct++ = (mp_uint_t)MP_OBJ_NEW_QSTR(load_qstr(reader));
@@ -215,6 +323,38 @@ STATIC mp_raw_code_t *load_raw_code(mp_reader_t *reader) {
         *ct++ = (mp_uint_t)(uintptr_t)load_raw_code(reader);
     }
 
+    #if MICROPY_PERSISTENT_CODE_LOAD_XIP
+    if (in_place) {
+        if (bytecode_qstrs_in_const_table(ip2, ip, bytecode + bc_len, n_ct)) {
+            // the bytecode can stay where it is and find its qstrs in the constant table
+            for (size_t i = 0; i < n_qstr; ++i) {
+                *ct++ = (mp_uint_t)MP_OBJ_NEW_QSTR(qstrs[i]);
+            }
+            *ct = (mp_uint_t)((mp_reader_xip_t*)reader->data)->owner;
+        } else {
+            // the bytecode wasn't saved in a form that can be used in place so
+            // copy it to RAM and link the qstrs into it
+            *ct = 0;
+            byte *bytecode_ram = m_new(byte, bc_len);
+            memcpy(bytecode_ram, bytecode, bc_len);
+            ip = bytecode_ram + (ip - bytecode);
+            ip2 = bytecode_ram + (ip2 - bytecode);
+            bytecode = bytecode_ram;
+            store_qstr((byte*)ip2, qstrs[0]);
+            store_qstr((byte*)ip2 + 2, qstrs[1]);
+            qstr *q = qstrs + 2;
+            for (byte *p = (byte*)ip; p < bytecode + bc_len;) {
+                size_t sz;
+                if (mp_opcode_format(p, &sz) == MP_OPCODE_QSTR) {
+                    store_qstr(p + 1, *q++);
+                }
+                p += sz;
+            }
+        }
+        m_del(qstr, qstrs, n_qstr);
+    }
+    #endif
+
     // create raw_code and return it
     mp_raw_code_t *rc = mp_emit_glue_new_raw_code();
     mp_emit_glue_assign_bytecode(rc, bytecode,
@@ -255,6 +395,14 @@ mp_raw_code_t *mp_raw_code_load_file(const char *filename) {
     return mp_raw_code_load(&reader);
 }
 
+#if MICROPY_PERSISTENT_CODE_LOAD_XIP
+mp_raw_code_t *mp_raw_code_load_xip(const byte *buf, size_t len, mp_obj_t owner) {
+    mp_reader_xip_t xip = {buf, buf + len, owner};
+    mp_reader_t reader = {&xip, mp_reader_xip_readbyte, mp_reader_xip_close};
+    return mp_raw_code_load(&reader);
+}
+#endif
+
 #endif // MICROPY_PERSISTENT_CODE_LOAD
 
 #if MICROPY_PERSISTENT_CODE_SAVE
@@ -325,6 +473,15 @@ STATIC void save_obj(mp_print_t *print, mp_obj_t o) {
     }
 }
 
+STATIC void save_qstr_slot(byte *ip, size_t ct_ofs) {
+    // leave the qstr id in place if the constant table index doesn't fit
+    if (ct_ofs < MP_BC_QSTR_IN_CONST_TABLE) {
+        ct_ofs |= MP_BC_QSTR_IN_CONST_TABLE;
+        ip[0] = ct_ofs;
+        ip[1] = ct_ofs >> 8;
+    }
+}
+
 STATIC void save_bytecode_qstrs(mp_print_t *print, const byte *ip, const byte *ip_top) {
     while (ip < ip_top) {
         size_t sz;
@@ -342,16 +499,33 @@ STATIC void save_raw_code(mp_print_t *print, mp_raw_code_t *rc) {
         mp_raise_ValueError(translate("can only save bytecode"));
     }
 
-    // save bytecode
-    mp_print_uint(print, rc->data.u_byte.bc_len);
-    mp_print_bytes(print, rc->data.u_byte.bytecode, rc->data.u_byte.bc_len);
-
     // extract prelude
     const byte *ip = rc->data.u_byte.bytecode;
     const byte *ip2;
     bytecode_prelude_t prelude;
     extract_prelude(&ip, &ip2, &prelude);
 
+    // save bytecode, with its qstr slots referring to the constant table entries
+    // that a loader running it in place puts the qstrs in
+    size_t bc_len = rc->data.u_byte.bc_len;
+    byte *bytecode = m_new(byte, bc_len);
+    memcpy(bytecode, rc->data.u_byte.bytecode, bc_len);
+    size_t ct_ofs = prelude.n_pos_args + prelude.n_kwonly_args
+        + rc->data.u_byte.n_obj + rc->data.u_byte.n_raw_code;
+    byte *p = bytecode + (ip2 - rc->data.u_byte.bytecode);
+    save_qstr_slot(p, ct_ofs++);
+    save_qstr_slot(p + 2, ct_ofs++);
+    for (p = bytecode + (ip - rc->data.u_byte.bytecode); p < bytecode + bc_len;) {
+        size_t sz;
+        if (mp_opcode_format(p, &sz) == MP_OPCODE_QSTR) {
+            save_qstr_slot(p + 1, ct_ofs++);
+        }
+        p += sz;
+    }
+    mp_print_uint(print, bc_len);
+    mp_print_bytes(print, bytecode, bc_len);
+    m_del(byte, bytecode, bc_len);
+
     // save qstrs
     save_qstr(print, ip2[0] | (ip2[1] << 8)); // simple_name
     save_qstr(print, ip2[2] | (ip2[3] << 8)); // source_file
@@ -391,6 +565,20 @@ void mp_raw_code_save(mp_raw_code_t *rc, mp_print_t *print) {
     save_raw_code(print, rc);
 }
 
+#if MICROPY_VFS
+
+#include "py/stream.h"
+
+void mp_raw_code_stream_print_strn(void *env, const char *str, size_t len) {
+    int errcode;
+    mp_stream_write_exactly(MP_OBJ_FROM_PTR(env), str, len, &errcode);
+    if (errcode != 0) {
+        mp_raise_OSError(errcode);
+    }
+}
+
+#endif
+
 // here we define mp_raw_code_save_file depending on the port
 // TODO abstract this away properly
 
@@ -413,7 +601,7 @@ void mp_raw_code_save_file(mp_raw_code_t *rc, const char *filename) {
     close(fd);
 }
 
-#else
+#elif !MICROPY_VFS
 #error mp_raw_code_save_file not implemented for this platform
 #endif
 
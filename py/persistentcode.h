@@ -33,8 +33,16 @@
 mp_raw_code_t *mp_raw_code_load(mp_reader_t *reader);
 mp_raw_code_t *mp_raw_code_load_mem(const byte *buf, size_t len);
 mp_raw_code_t *mp_raw_code_load_file(const char *filename);
+#if MICROPY_PERSISTENT_CODE_LOAD_XIP
+// buf must stay unchanged for as long as the loaded code is in use; code that
+// runs from buf keeps owner alive, so owner can be what keeps buf mapped
+mp_raw_code_t *mp_raw_code_load_xip(const byte *buf, size_t len, mp_obj_t owner);
+#endif
 
 void mp_raw_code_save(mp_raw_code_t *rc, mp_print_t *print);
 void mp_raw_code_save_file(mp_raw_code_t *rc, const char *filename);
+// an mp_print_t print_strn that writes to the stream object given as env,
+// raising OSError on failure
+void mp_raw_code_stream_print_strn(void *env, const char *str, size_t len);
 
 #endif // MICROPY_INCLUDED_PY_PERSISTENTCODE_H
@@ -32,6 +32,9 @@
 #include "py/mpstate.h"
 #include "py/qstr.h"
 #include "py/gc.h"
+#if MICROPY_PERSISTENT_CODE_LOAD_XIP
+#include "py/bc.h"
+#endif
 
 #include "supervisor/linker.h"
 
@@ -202,6 +205,15 @@ qstr qstr_from_strn(const char *str, size_t len) {
         // compute number of bytes needed to intern this string
         size_t n_bytes = MICROPY_QSTR_BYTES_IN_HASH + MICROPY_QSTR_BYTES_IN_LEN + len + 1;
 
+        #if MICROPY_PERSISTENT_CODE_LOAD_XIP
+        // The top bit of a qstr slot in bytecode marks a constant table index
+        // (see MP_BC_QSTR_IN_CONST_TABLE), so qstr ids must stay below it.
+        if (MP_STATE_VM(last_pool)->total_prev_len + MP_STATE_VM(last_pool)->len >= MP_BC_QSTR_IN_CONST_TABLE) {
+            QSTR_EXIT();
+            m_malloc_fail(n_bytes);
+        }
+        #endif
+
         if (MP_STATE_VM(qstr_last_chunk) != NULL && MP_STATE_VM(qstr_last_used) + n_bytes > MP_STATE_VM(qstr_last_alloc)) {
             // not enough room at end of previously interned string so try to grow
             byte *new_p = m_renew_maybe(byte, MP_STATE_VM(qstr_last_chunk), MP_STATE_VM(qstr_last_alloc), MP_STATE_VM(qstr_last_alloc) + n_bytes, false);
@@ -125,6 +125,16 @@ void mp_init(void) {
     MP_STATE_VM(dupterm_arr_obj) = MP_OBJ_NULL;
     #endif
 
+    #if MICROPY_PY_URE && MICROPY_PY_URE_CACHE_SIZE
+    for (size_t i = 0; i < 2 * MICROPY_PY_URE_CACHE_SIZE; ++i) {
+        MP_STATE_VM(ure_cache[i]) = MP_OBJ_NULL;
+    }
+    #endif
+
+    #if MICROPY_VFS_FAT_ASYNC
+    MP_STATE_VM(vfs_fat_async_files) = NULL;
+    #endif
+
     #ifdef MICROPY_FSUSERMOUNT
     // zero out the pointers to the user-mounted devices
     memset(MP_STATE_VM(fs_user_mount) + MICROPY_FATFS_NUM_PERSISTENT, 0,
@@ -265,6 +275,14 @@ mp_obj_t mp_unary_op(mp_unary_op_t op, mp_obj_t arg) {
         if (h == 0) {
             GET_STR_DATA_LEN(arg, data, len);
             h = qstr_compute_hash(data, len);
+            #if MICROPY_ENABLE_GC
+            // bytes on the heap are hashed on first use, so keep the result;
+            // objects in ROM or mapped flash are left alone
+            mp_obj_str_t *o = MP_OBJ_TO_PTR(arg);
+            if (gc_nbytes(o) != 0) {
+                o->hash = h;
+            }
+            #endif
         }
         return MP_OBJ_NEW_SMALL_INT(h);
     } else {
@@ -302,6 +320,18 @@ mp_obj_t PLACE_IN_ITCM(mp_binary_op)(mp_binary_op_t op, mp_obj_t lhs, mp_obj_t r
         return mp_obj_new_bool(lhs == rhs);
     }
 
+    #if MICROPY_PY_BUILTINS_FLOAT
+    // fast path for a float lhs with a float or small-int rhs, which skips the
+    // equality and type dispatch below; with MICROPY_OBJ_REPR_C or _D the float
+    // result is stored in the object word so nothing is allocated on the heap
+    if (mp_obj_is_float(lhs) && (mp_obj_is_float(rhs) || MP_OBJ_IS_SMALL_INT(rhs))) {
+        mp_obj_t res = mp_obj_float_binary_op(op, mp_obj_float_get(lhs), rhs);
+        if (res != MP_OBJ_NULL) {
+            return res;
+        }
+    }
+    #endif
+
     // deal with == and != for all types
     if (op == MP_BINARY_OP_EQUAL || op == MP_BINARY_OP_NOT_EQUAL) {
         if (mp_obj_equal(lhs, rhs)) {
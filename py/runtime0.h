@@ -194,6 +194,9 @@ typedef enum {
     MP_F_SETUP_CODE_STATE,
     MP_F_SMALL_INT_FLOOR_DIVIDE,
     MP_F_SMALL_INT_MODULO,
+#if MICROPY_EMIT_NATIVE_TIERING
+    MP_F_NATIVE_LOOP_HOOK,
+#endif
     MP_F_NUMBER_OF,
 } mp_fun_kind_t;
 
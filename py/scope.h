@@ -76,6 +76,9 @@ typedef struct _scope_t {
     mp_raw_code_t *raw_code;
     uint8_t scope_flags;  // see runtime0.h
     uint8_t emit_options; // see compile.h
+    #if MICROPY_EMIT_NATIVE_TIERING
+    bool tier_up;         // native code made by mp_compile_tier_up
+    #endif
     uint16_t num_pos_args;
     uint16_t num_kwonly_args;
     uint16_t num_def_pos_args;
@@ -43,11 +43,21 @@
 }
 #define DECODE_ULABEL do { unum = (ip[0] | (ip[1] << 8)); ip += 2; } while (0)
 #define DECODE_SLABEL do { unum = (ip[0] | (ip[1] << 8)) - 0x8000; ip += 2; } while (0)
+#define DECODE_SINT { \
+    snum = 0; \
+    if ((ip[0] & 0x40) != 0) { \
+        /* Number is negative */ \
+        snum--; \
+    } \
+    do { \
+        snum = (snum * 128) | (*ip & 0x7f); \
+    } while ((*ip++ & 0x80) != 0); \
+}
 
 #if MICROPY_PERSISTENT_CODE
 
 #define DECODE_QSTR \
-    qst = ip[0] | ip[1] << 8; \
+    qst = mp_bc_resolve_qstr(ip[0] | ip[1] << 8, mp_showbc_const_table); \
     ip += 2;
 #define DECODE_PTR \
     DECODE_UINT; \
@@ -96,8 +106,8 @@ void mp_bytecode_print(const void *descr, const byte *ip, mp_uint_t len, const m
     ip += code_info_size;
 
     #if MICROPY_PERSISTENT_CODE
-    qstr block_name = code_info[0] | (code_info[1] << 8);
-    qstr source_file = code_info[2] | (code_info[3] << 8);
+    qstr block_name = mp_bc_resolve_qstr(code_info[0] | (code_info[1] << 8), const_table);
+    qstr source_file = mp_bc_resolve_qstr(code_info[2] | (code_info[3] << 8), const_table);
     code_info += 4;
     #else
     qstr block_name = mp_decode_uint(&code_info);
@@ -179,15 +189,9 @@ const byte *mp_bytecode_print_str(const byte *ip) {
             break;
 
         case MP_BC_LOAD_CONST_SMALL_INT: {
-            mp_int_t num = 0;
-            if ((ip[0] & 0x40) != 0) {
-                // Number is negative
-                num--;
-            }
-            do {
-                num = (num * 128) | (*ip & 0x7f);
-            } while ((*ip++ & 0x80) != 0);
-            printf("LOAD_CONST_SMALL_INT " INT_FMT, num);
+            mp_int_t snum;
+            DECODE_SINT;
+            printf("LOAD_CONST_SMALL_INT " INT_FMT, snum);
             break;
         }
 
@@ -532,6 +536,45 @@ const byte *mp_bytecode_print_str(const byte *ip) {
             printf("IMPORT_STAR");
             break;
 
+        #if MICROPY_OPT_BC_SUPERINSTRUCTIONS
+        case MP_BC_LOAD_FAST_LOAD_ATTR:
+            unum = *ip++;
+            DECODE_QSTR;
+            printf("LOAD_FAST_LOAD_ATTR " UINT_FMT " %s", unum, qstr_str(qst));
+            if (MICROPY_OPT_CACHE_MAP_LOOKUP_IN_BYTECODE) {
+                printf(" (cache=%u)", *ip++);
+            }
+            break;
+
+        case MP_BC_BINARY_OP_SMALL_INT: {
+            mp_uint_t op = *ip++;
+            mp_int_t snum;
+            DECODE_SINT;
+            printf("BINARY_OP_SMALL_INT " UINT_FMT " %s " INT_FMT, op, qstr_str(mp_binary_op_method_name[op]), snum);
+            break;
+        }
+
+        case MP_BC_LOAD_FAST_BINARY_OP_SMALL_INT: {
+            mp_uint_t local_num = *ip++;
+            mp_uint_t op = *ip++;
+            mp_int_t snum;
+            DECODE_SINT;
+            printf("LOAD_FAST_BINARY_OP_SMALL_INT " UINT_FMT " " UINT_FMT " %s " INT_FMT,
+                local_num, op, qstr_str(mp_binary_op_method_name[op]), snum);
+            break;
+        }
+
+        case MP_BC_COMPARE_POP_JUMP_IF_TRUE:
+        case MP_BC_COMPARE_POP_JUMP_IF_FALSE: {
+            const char *name = ip[-1] == MP_BC_COMPARE_POP_JUMP_IF_TRUE ? "TRUE" : "FALSE";
+            mp_uint_t op = *ip++;
+            DECODE_SLABEL;
+            printf("COMPARE_POP_JUMP_IF_%s " UINT_FMT " %s " UINT_FMT, name, op,
+                qstr_str(mp_binary_op_method_name[op]), (mp_uint_t)(ip + unum - mp_showbc_code_start));
+            break;
+        }
+        #endif
+
         default:
             if (ip[-1] < MP_BC_LOAD_CONST_SMALL_INT_MULTI + 64) {
                 printf("LOAD_CONST_SMALL_INT " INT_FMT, (mp_int_t)ip[-1] - MP_BC_LOAD_CONST_SMALL_INT_MULTI - 16);
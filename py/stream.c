@@ -209,6 +209,10 @@ STATIC mp_obj_t stream_read_generic(size_t n_args, const mp_obj_t *args, byte fl
             return mp_const_none;
         }
         mp_raise_OSError(error);
+    } else if (out_sz == 0 && !stream_p->is_text) {
+        // EOF: don't keep a buffer around just to hold nothing
+        vstr_clear(&vstr);
+        return mp_const_empty_bytes;
     } else {
         vstr.len = out_sz;
         return mp_obj_new_str_from_vstr(STREAM_CONTENT_TYPE(stream_p), &vstr);
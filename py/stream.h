@@ -42,6 +42,9 @@
 #define MP_STREAM_SET_OPTS      (7)  // Set stream options
 #define MP_STREAM_GET_DATA_OPTS (8)  // Get data/message options
 #define MP_STREAM_SET_DATA_OPTS (9)  // Set data/message options
+#define MP_STREAM_GET_MMAP      (10) // Get read-only view of whole file in memory, arg is mp_obj_t* which receives
+                                     // an object with the buffer protocol; the view outlives the stream, and stays
+                                     // valid while that object is alive, but not changes to the file
 
 // These poll ioctl values are compatible with Linux
 #define MP_STREAM_POLL_RD  (0x0001)
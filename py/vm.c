@@ -34,6 +34,7 @@
 #include "py/runtime.h"
 #include "py/bc0.h"
 #include "py/bc.h"
+#include "py/smallint.h"
 
 #include "supervisor/linker.h"
 
@@ -55,13 +56,22 @@
     do { \
         unum = (unum << 7) + (*ip & 0x7f); \
     } while ((*ip++ & 0x80) != 0)
+#define DECODE_SINT \
+    mp_int_t snum = 0; \
+    if ((ip[0] & 0x40) != 0) { \
+        /* Number is negative */ \
+        snum--; \
+    } \
+    do { \
+        snum = (snum << 7) | (*ip & 0x7f); \
+    } while ((*ip++ & 0x80) != 0)
 #define DECODE_ULABEL size_t ulab = (ip[0] | (ip[1] << 8)); ip += 2
 #define DECODE_SLABEL size_t slab = (ip[0] | (ip[1] << 8)) - 0x8000; ip += 2
 
 #if MICROPY_PERSISTENT_CODE
 
 #define DECODE_QSTR \
-    qstr qst = ip[0] | ip[1] << 8; \
+    qstr qst = mp_bc_resolve_qstr(ip[0] | ip[1] << 8, code_state->fun_bc->const_table); \
     ip += 2;
 #define DECODE_PTR \
     DECODE_UINT; \
@@ -87,6 +97,20 @@
 
 #endif
 
+#if MICROPY_EMIT_NATIVE_TIERING
+// Backward jumps count towards the hotness of the running function, see fun_bc_call.
+#define TIER_COUNT_BACK_EDGE() do { \
+    if ((mp_int_t)slab < 0 && code_state->fun_bc->tier_rc != NULL) { \
+        mp_raw_code_t *tier_rc = (mp_raw_code_t*)code_state->fun_bc->tier_rc; \
+        if (tier_rc->tier_count < MICROPY_EMIT_NATIVE_TIERING_THRESHOLD) { \
+            tier_rc->tier_count += 1; \
+        } \
+    } \
+} while (0)
+#else
+#define TIER_COUNT_BACK_EDGE() (void)0
+#endif
+
 #define PUSH(val) *++sp = (val)
 #define POP() (*sp--)
 #define TOP() (*sp)
@@ -112,6 +136,67 @@
     exc_sp--; /* pop back to previous exception handler */ \
     CLEAR_SYS_EXC_INFO() /* just clear sys.exc_info(), not compliant, but it shouldn't be used in 1st place */
 
+#if MICROPY_OPT_BC_SUPERINSTRUCTIONS
+// Binary op with a small-int rhs, as emitted for superinstructions.  Common
+// ops on a small-int lhs are done inline, without a call to mp_binary_op.
+static inline mp_obj_t vm_binary_op_small_int(mp_binary_op_t op, mp_obj_t lhs, mp_int_t rhs) {
+    if (MP_OBJ_IS_SMALL_INT(lhs)) {
+        // Both values are small ints so their sum or difference can't overflow mp_int_t
+        mp_int_t lhs_val = MP_OBJ_SMALL_INT_VALUE(lhs);
+        mp_int_t res;
+        switch (op) {
+            case MP_BINARY_OP_LESS: return mp_obj_new_bool(lhs_val < rhs);
+            case MP_BINARY_OP_MORE: return mp_obj_new_bool(lhs_val > rhs);
+            case MP_BINARY_OP_EQUAL: return mp_obj_new_bool(lhs_val == rhs);
+            case MP_BINARY_OP_LESS_EQUAL: return mp_obj_new_bool(lhs_val <= rhs);
+            case MP_BINARY_OP_MORE_EQUAL: return mp_obj_new_bool(lhs_val >= rhs);
+            case MP_BINARY_OP_NOT_EQUAL: return mp_obj_new_bool(lhs_val != rhs);
+            case MP_BINARY_OP_OR:
+            case MP_BINARY_OP_INPLACE_OR: return MP_OBJ_NEW_SMALL_INT(lhs_val | rhs);
+            case MP_BINARY_OP_XOR:
+            case MP_BINARY_OP_INPLACE_XOR: return MP_OBJ_NEW_SMALL_INT(lhs_val ^ rhs);
+            case MP_BINARY_OP_AND:
+            case MP_BINARY_OP_INPLACE_AND: return MP_OBJ_NEW_SMALL_INT(lhs_val & rhs);
+            case MP_BINARY_OP_ADD:
+            case MP_BINARY_OP_INPLACE_ADD:
+                res = lhs_val + rhs;
+                if (MP_SMALL_INT_FITS(res)) {
+                    return MP_OBJ_NEW_SMALL_INT(res);
+                }
+                break;
+            case MP_BINARY_OP_SUBTRACT:
+            case MP_BINARY_OP_INPLACE_SUBTRACT:
+                res = lhs_val - rhs;
+                if (MP_SMALL_INT_FITS(res)) {
+                    return MP_OBJ_NEW_SMALL_INT(res);
+                }
+                break;
+            default:
+                break;
+        }
+    }
+    return mp_binary_op(op, lhs, MP_OBJ_NEW_SMALL_INT(rhs));
+}
+
+// Truth value of a comparison op, as emitted for COMPARE_POP_JUMP_IF_*.
+static inline bool vm_compare(mp_binary_op_t op, mp_obj_t lhs, mp_obj_t rhs) {
+    if (MP_OBJ_IS_SMALL_INT(lhs) && MP_OBJ_IS_SMALL_INT(rhs)) {
+        mp_int_t lhs_val = MP_OBJ_SMALL_INT_VALUE(lhs);
+        mp_int_t rhs_val = MP_OBJ_SMALL_INT_VALUE(rhs);
+        switch (op) {
+            case MP_BINARY_OP_LESS: return lhs_val < rhs_val;
+            case MP_BINARY_OP_MORE: return lhs_val > rhs_val;
+            case MP_BINARY_OP_EQUAL: return lhs_val == rhs_val;
+            case MP_BINARY_OP_LESS_EQUAL: return lhs_val <= rhs_val;
+            case MP_BINARY_OP_MORE_EQUAL: return lhs_val >= rhs_val;
+            case MP_BINARY_OP_NOT_EQUAL: return lhs_val != rhs_val;
+            default: break;
+        }
+    }
+    return mp_obj_is_true(mp_binary_op(op, lhs, rhs));
+}
+#endif
+
 // fastn has items in reverse order (fastn[0] is local[0], fastn[-1] is local[1], etc)
 // sp points to bottom of stack which grows up
 // returns:
@@ -219,15 +304,8 @@ dispatch_loop:
                     DISPATCH();
 
                 ENTRY(MP_BC_LOAD_CONST_SMALL_INT): {
-                    mp_int_t num = 0;
-                    if ((ip[0] & 0x40) != 0) {
-                        // Number is negative
-                        num--;
-                    }
-                    do {
-                        num = (num << 7) | (*ip & 0x7f);
-                    } while ((*ip++ & 0x80) != 0);
-                    PUSH(MP_OBJ_NEW_SMALL_INT(num));
+                    DECODE_SINT;
+                    PUSH(MP_OBJ_NEW_SMALL_INT(snum));
                     DISPATCH();
                 }
 
@@ -327,14 +405,22 @@ dispatch_loop:
                 #endif
 
                 #if !MICROPY_OPT_CACHE_MAP_LOOKUP_IN_BYTECODE
-                ENTRY(MP_BC_LOAD_ATTR): {
+                ENTRY(MP_BC_LOAD_ATTR):
+                #if MICROPY_OPT_BC_SUPERINSTRUCTIONS
+                load_attr:
+                #endif
+                {
                     MARK_EXC_IP_SELECTIVE();
                     DECODE_QSTR;
                     SET_TOP(mp_load_attr(TOP(), qst));
                     DISPATCH();
                 }
                 #else
-                ENTRY(MP_BC_LOAD_ATTR): {
+                ENTRY(MP_BC_LOAD_ATTR):
+                #if MICROPY_OPT_BC_SUPERINSTRUCTIONS
+                load_attr:
+                #endif
+                {
                     MARK_EXC_IP_SELECTIVE();
                     DECODE_QSTR;
                     mp_obj_t top = TOP();
@@ -538,6 +624,7 @@ dispatch_loop:
                 ENTRY(MP_BC_JUMP): {
                     DECODE_SLABEL;
                     ip += slab;
+                    TIER_COUNT_BACK_EDGE();
                     DISPATCH_WITH_PEND_EXC_CHECK();
                 }
 
@@ -545,6 +632,7 @@ dispatch_loop:
                     DECODE_SLABEL;
                     if (mp_obj_is_true(POP())) {
                         ip += slab;
+                        TIER_COUNT_BACK_EDGE();
                     }
                     DISPATCH_WITH_PEND_EXC_CHECK();
                 }
@@ -553,6 +641,7 @@ dispatch_loop:
                     DECODE_SLABEL;
                     if (!mp_obj_is_true(POP())) {
                         ip += slab;
+                        TIER_COUNT_BACK_EDGE();
                     }
                     DISPATCH_WITH_PEND_EXC_CHECK();
                 }
@@ -1233,6 +1322,52 @@ yield:
                     mp_import_all(POP());
                     DISPATCH();
 
+                #if MICROPY_OPT_BC_SUPERINSTRUCTIONS
+                ENTRY(MP_BC_LOAD_FAST_LOAD_ATTR): {
+                    mp_obj_t local = fastn[-(mp_int_t)*ip++];
+                    if (local == MP_OBJ_NULL) {
+                        goto local_name_error;
+                    }
+                    PUSH(local);
+                    goto load_attr;
+                }
+
+                ENTRY(MP_BC_BINARY_OP_SMALL_INT): {
+                    MARK_EXC_IP_SELECTIVE();
+                    mp_binary_op_t op = *ip++;
+                    DECODE_SINT;
+                    SET_TOP(vm_binary_op_small_int(op, TOP(), snum));
+                    DISPATCH();
+                }
+
+                ENTRY(MP_BC_LOAD_FAST_BINARY_OP_SMALL_INT): {
+                    MARK_EXC_IP_SELECTIVE();
+                    mp_obj_t local = fastn[-(mp_int_t)*ip++];
+                    if (local == MP_OBJ_NULL) {
+                        goto local_name_error;
+                    }
+                    mp_binary_op_t op = *ip++;
+                    DECODE_SINT;
+                    PUSH(vm_binary_op_small_int(op, local, snum));
+                    DISPATCH();
+                }
+
+                ENTRY(MP_BC_COMPARE_POP_JUMP_IF_TRUE):
+                ENTRY(MP_BC_COMPARE_POP_JUMP_IF_FALSE): {
+                    MARK_EXC_IP_SELECTIVE();
+                    bool jump_if = ip[-1] == MP_BC_COMPARE_POP_JUMP_IF_TRUE;
+                    mp_binary_op_t op = *ip++;
+                    DECODE_SLABEL;
+                    mp_obj_t rhs = POP();
+                    mp_obj_t lhs = POP();
+                    if (vm_compare(op, lhs, rhs) == jump_if) {
+                        ip += slab;
+                        TIER_COUNT_BACK_EDGE();
+                    }
+                    DISPATCH_WITH_PEND_EXC_CHECK();
+                }
+                #endif
+
 #if MICROPY_OPT_COMPUTED_GOTO
                 ENTRY(MP_BC_LOAD_CONST_SMALL_INT_MULTI):
                     PUSH(MP_OBJ_NEW_SMALL_INT((mp_int_t)ip[-1] - MP_BC_LOAD_CONST_SMALL_INT_MULTI - 16));
@@ -1395,8 +1530,8 @@ unwind_loop:
                 ip = mp_decode_uint_skip(ip); // skip code_info_size
                 bc -= code_info_size;
                 #if MICROPY_PERSISTENT_CODE
-                qstr block_name = ip[0] | (ip[1] << 8);
-                qstr source_file = ip[2] | (ip[3] << 8);
+                qstr block_name = mp_bc_resolve_qstr(ip[0] | (ip[1] << 8), code_state->fun_bc->const_table);
+                qstr source_file = mp_bc_resolve_qstr(ip[2] | (ip[3] << 8), code_state->fun_bc->const_table);
                 ip += 4;
                 #else
                 qstr block_name = mp_decode_uint_value(ip);
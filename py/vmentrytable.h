@@ -108,6 +108,13 @@ static const void *const PLACE_IN_DTCM_DATA(entry_table[256]) = {
     [MP_BC_IMPORT_NAME] = &&entry_MP_BC_IMPORT_NAME,
     [MP_BC_IMPORT_FROM] = &&entry_MP_BC_IMPORT_FROM,
     [MP_BC_IMPORT_STAR] = &&entry_MP_BC_IMPORT_STAR,
+    #if MICROPY_OPT_BC_SUPERINSTRUCTIONS
+    [MP_BC_LOAD_FAST_LOAD_ATTR] = &&entry_MP_BC_LOAD_FAST_LOAD_ATTR,
+    [MP_BC_BINARY_OP_SMALL_INT] = &&entry_MP_BC_BINARY_OP_SMALL_INT,
+    [MP_BC_LOAD_FAST_BINARY_OP_SMALL_INT] = &&entry_MP_BC_LOAD_FAST_BINARY_OP_SMALL_INT,
+    [MP_BC_COMPARE_POP_JUMP_IF_TRUE] = &&entry_MP_BC_COMPARE_POP_JUMP_IF_TRUE,
+    [MP_BC_COMPARE_POP_JUMP_IF_FALSE] = &&entry_MP_BC_COMPARE_POP_JUMP_IF_FALSE,
+    #endif
     [MP_BC_LOAD_CONST_SMALL_INT_MULTI ... MP_BC_LOAD_CONST_SMALL_INT_MULTI + 63] = &&entry_MP_BC_LOAD_CONST_SMALL_INT_MULTI,
     [MP_BC_LOAD_FAST_MULTI ... MP_BC_LOAD_FAST_MULTI + 15] = &&entry_MP_BC_LOAD_FAST_MULTI,
     [MP_BC_STORE_FAST_MULTI ... MP_BC_STORE_FAST_MULTI + 15] = &&entry_MP_BC_STORE_FAST_MULTI,
@@ -36,6 +36,14 @@
 // returned value is always at least 1 greater than argument
 #define ROUND_ALLOC(a) (((a) & ((~0U) - 7)) + 8)
 
+#if MICROPY_COMPILE_ARENA
+#define vstr_renew(vstr, new_alloc) ((vstr)->long_lived \
+    ? m_renew_ll(char, (vstr)->buf, (vstr)->alloc, (new_alloc)) \
+    : m_renew(char, (vstr)->buf, (vstr)->alloc, (new_alloc)))
+#else
+#define vstr_renew(vstr, new_alloc) m_renew(char, (vstr)->buf, (vstr)->alloc, (new_alloc))
+#endif
+
 // Init the vstr so it allocs exactly given number of bytes.  Set length to zero.
 void vstr_init(vstr_t *vstr, size_t alloc) {
     if (alloc < 1) {
@@ -45,6 +53,9 @@ void vstr_init(vstr_t *vstr, size_t alloc) {
     vstr->len = 0;
     vstr->buf = m_new(char, vstr->alloc);
     vstr->fixed_buf = false;
+    #if MICROPY_COMPILE_ARENA
+    vstr->long_lived = false;
+    #endif
 }
 
 // Init the vstr so it allocs exactly enough ram to hold a null-terminated
@@ -62,6 +73,9 @@ void vstr_init_fixed_buf(vstr_t *vstr, size_t alloc, char *buf) {
     vstr->len = 0;
     vstr->buf = buf;
     vstr->fixed_buf = true;
+    #if MICROPY_COMPILE_ARENA
+    vstr->long_lived = false;
+    #endif
 }
 
 void vstr_init_print(vstr_t *vstr, size_t alloc, mp_print_t *print) {
@@ -99,7 +113,7 @@ char *vstr_extend(vstr_t *vstr, size_t size) {
         // be there, so the only safe option is to raise an exception.
         mp_raise_msg(&mp_type_RuntimeError, NULL);
     }
-    char *new_buf = m_renew(char, vstr->buf, vstr->alloc, vstr->alloc + size);
+    char *new_buf = vstr_renew(vstr, vstr->alloc + size);
     char *p = new_buf + vstr->alloc;
     vstr->alloc += size;
     vstr->buf = new_buf;
@@ -114,7 +128,7 @@ STATIC void vstr_ensure_extra(vstr_t *vstr, size_t size) {
             mp_raise_msg(&mp_type_RuntimeError, NULL);
         }
         size_t new_alloc = ROUND_ALLOC((vstr->len + size) + 16);
-        char *new_buf = m_renew(char, vstr->buf, vstr->alloc, new_alloc);
+        char *new_buf = vstr_renew(vstr, new_alloc);
         vstr->alloc = new_alloc;
         vstr->buf = new_buf;
     }
@@ -49,13 +49,14 @@
 //|     25MHz.  Usually an SDCard object is used with ``storage.VfsFat``
 //|     to allow file I/O to an SD card."""
 //|
-//|     def __init__(self, clock: microcontroller.Pin, command: microcontroller.Pin, data: Sequence[microcontroller.Pin], frequency: int) -> None:
+//|     def __init__(self, clock: microcontroller.Pin, command: microcontroller.Pin, data: Sequence[microcontroller.Pin], frequency: int, cache_blocks: int = 0) -> None:
 //|         """Construct an SDIO SD Card object with the given properties
 //|
 //|         :param ~microcontroller.Pin clock: the pin to use for the clock.
 //|         :param ~microcontroller.Pin command: the pin to use for the command.
 //|         :param data: A sequence of pins to use for data.
 //|         :param frequency: The frequency of the bus in Hz
+//|         :param int cache_blocks: The number of 512-byte blocks to buffer, up to 128. Half of them are used to read ahead when reading sequentially and half to hold back writes, which are then written in block order with one command per run of blocks. Held back writes are written by `sync` and `deinit`. ``storage.VfsFat`` calls `sync` when files are flushed or closed.
 //|
 //|         Example usage:
 //|
@@ -78,15 +79,31 @@
 //|         ...
 //|
 
+STATIC int sdcard_readblocks(void *dev, uint32_t start_block, uint8_t *buf, uint32_t num_blocks) {
+    mp_buffer_info_t bufinfo = { .buf = buf, .len = num_blocks * SDIOIO_BLOCK_SIZE };
+    return common_hal_sdioio_sdcard_readblocks(dev, start_block, &bufinfo);
+}
+
+STATIC int sdcard_writeblocks(void *dev, uint32_t start_block, const uint8_t *buf, uint32_t num_blocks) {
+    mp_buffer_info_t bufinfo = { .buf = (void*)buf, .len = num_blocks * SDIOIO_BLOCK_SIZE };
+    return common_hal_sdioio_sdcard_writeblocks(dev, start_block, &bufinfo);
+}
+
+STATIC const sdioio_block_cache_io_t sdcard_cache_io = {
+    .readblocks = sdcard_readblocks,
+    .writeblocks = sdcard_writeblocks,
+};
+
 STATIC mp_obj_t sdioio_sdcard_make_new(const mp_obj_type_t *type, size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
     sdioio_sdcard_obj_t *self = m_new_obj(sdioio_sdcard_obj_t);
     self->base.type = &sdioio_SDCard_type;
-    enum { ARG_clock, ARG_command, ARG_data, ARG_frequency, NUM_ARGS };
+    enum { ARG_clock, ARG_command, ARG_data, ARG_frequency, ARG_cache_blocks, NUM_ARGS };
     static const mp_arg_t allowed_args[] = {
         { MP_QSTR_clock, MP_ARG_REQUIRED | MP_ARG_KW_ONLY | MP_ARG_OBJ },
         { MP_QSTR_command, MP_ARG_REQUIRED | MP_ARG_KW_ONLY | MP_ARG_OBJ },
         { MP_QSTR_data, MP_ARG_REQUIRED | MP_ARG_KW_ONLY | MP_ARG_OBJ },
         { MP_QSTR_frequency, MP_ARG_REQUIRED | MP_ARG_KW_ONLY | MP_ARG_INT },
+        { MP_QSTR_cache_blocks, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 0} },
     };
     MP_STATIC_ASSERT( MP_ARRAY_SIZE(allowed_args) == NUM_ARGS );
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
@@ -99,7 +116,13 @@ STATIC mp_obj_t sdioio_sdcard_make_new(const mp_obj_type_t *type, size_t n_args,
     uint8_t num_data;
     validate_list_is_free_pins(MP_QSTR_data, data_pins, MP_ARRAY_SIZE(data_pins), args[ARG_data].u_obj, &num_data);
 
+    mp_int_t cache_blocks = args[ARG_cache_blocks].u_int;
+    if (cache_blocks < 0 || cache_blocks > SDIOIO_BLOCK_CACHE_MAX_SIZE) {
+        mp_raise_ValueError_varg(translate("Invalid %q"), MP_QSTR_cache_blocks);
+    }
+
     common_hal_sdioio_sdcard_construct(self, clock, command, num_data, data_pins, args[ARG_frequency].u_int);
+    sdioio_block_cache_init(&self->cache, &sdcard_cache_io, self, common_hal_sdioio_sdcard_get_count(self), cache_blocks);
     return MP_OBJ_FROM_PTR(self);
 }
 
@@ -109,6 +132,12 @@ STATIC void check_for_deinit(sdioio_sdcard_obj_t *self) {
     }
 }
 
+STATIC void check_whole_block(mp_buffer_info_t *bufinfo) {
+    if (bufinfo->len % SDIOIO_BLOCK_SIZE) {
+        mp_raise_ValueError(translate("Buffer must be a multiple of 512 bytes"));
+    }
+}
+
 //|     def configure(self, frequency: int = 0, width: int = 0) -> None:
 //|         """Configures the SDIO bus.
 //|
@@ -173,7 +202,9 @@ mp_obj_t sdioio_sdcard_readblocks(mp_obj_t self_in, mp_obj_t start_block_in, mp_
     mp_buffer_info_t bufinfo;
     mp_get_buffer_raise(buf_in, &bufinfo, MP_BUFFER_WRITE);
     sdioio_sdcard_obj_t *self = (sdioio_sdcard_obj_t*)self_in;
-    int result = common_hal_sdioio_sdcard_readblocks(self, start_block, &bufinfo);
+    check_for_deinit(self);
+    check_whole_block(&bufinfo);
+    int result = sdioio_block_cache_readblocks(&self->cache, start_block, bufinfo.buf, bufinfo.len / SDIOIO_BLOCK_SIZE);
     if (result < 0) {
         mp_raise_OSError(-result);
     }
@@ -196,7 +227,9 @@ mp_obj_t sdioio_sdcard_writeblocks(mp_obj_t self_in, mp_obj_t start_block_in, mp
     mp_buffer_info_t bufinfo;
     mp_get_buffer_raise(buf_in, &bufinfo, MP_BUFFER_READ);
     sdioio_sdcard_obj_t *self = (sdioio_sdcard_obj_t*)self_in;
-    int result = common_hal_sdioio_sdcard_writeblocks(self, start_block, &bufinfo);
+    check_for_deinit(self);
+    check_whole_block(&bufinfo);
+    int result = sdioio_block_cache_writeblocks(&self->cache, start_block, bufinfo.buf, bufinfo.len / SDIOIO_BLOCK_SIZE);
     if (result < 0) {
         mp_raise_OSError(-result);
     }
@@ -205,6 +238,24 @@ mp_obj_t sdioio_sdcard_writeblocks(mp_obj_t self_in, mp_obj_t start_block_in, mp
 
 MP_DEFINE_CONST_FUN_OBJ_3(sdioio_sdcard_writeblocks_obj, sdioio_sdcard_writeblocks);
 
+//|     def sync(self) -> None:
+//|
+//|         """Write any blocks held back by the cache to the card
+//|
+//|         :return: None"""
+//|
+mp_obj_t sdioio_sdcard_sync(mp_obj_t self_in) {
+    sdioio_sdcard_obj_t *self = (sdioio_sdcard_obj_t*)self_in;
+    check_for_deinit(self);
+    int result = sdioio_block_cache_flush(&self->cache);
+    if (result < 0) {
+        mp_raise_OSError(-result);
+    }
+    return mp_const_none;
+}
+
+MP_DEFINE_CONST_FUN_OBJ_1(sdioio_sdcard_sync_obj, sdioio_sdcard_sync);
+
 //|     @property
 //|     def frequency(self) -> int:
 //|         """The actual SDIO bus frequency. This may not match the frequency
@@ -248,9 +299,21 @@ const mp_obj_property_t sdioio_sdcard_width_obj = {
 //|         """Disable permanently.
 //|
 //|         :return: None"""
+STATIC void sdcard_deinit(sdioio_sdcard_obj_t *self) {
+    if (common_hal_sdioio_sdcard_deinited(self)) {
+        return;
+    }
+    int result = sdioio_block_cache_flush(&self->cache);
+    sdioio_block_cache_deinit(&self->cache);
+    common_hal_sdioio_sdcard_deinit(self);
+    if (result < 0) {
+        mp_raise_OSError(-result);
+    }
+}
+
 STATIC mp_obj_t sdioio_sdcard_obj_deinit(mp_obj_t self_in) {
     sdioio_sdcard_obj_t *self = MP_OBJ_TO_PTR(self_in);
-    common_hal_sdioio_sdcard_deinit(self);
+    sdcard_deinit(self);
     return mp_const_none;
 }
 MP_DEFINE_CONST_FUN_OBJ_1(sdioio_sdcard_deinit_obj, sdioio_sdcard_obj_deinit);
@@ -268,7 +331,7 @@ MP_DEFINE_CONST_FUN_OBJ_1(sdioio_sdcard_deinit_obj, sdioio_sdcard_obj_deinit);
 //|
 STATIC mp_obj_t sdioio_sdcard_obj___exit__(size_t n_args, const mp_obj_t *args) {
     (void)n_args;
-    common_hal_sdioio_sdcard_deinit(args[0]);
+    sdcard_deinit(args[0]);
     return mp_const_none;
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(sdioio_sdcard_obj___exit___obj, 4, 4, sdioio_sdcard_obj___exit__);
@@ -285,6 +348,7 @@ STATIC const mp_rom_map_elem_t sdioio_sdcard_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_count), MP_ROM_PTR(&sdioio_sdcard_count_obj) },
     { MP_ROM_QSTR(MP_QSTR_readblocks), MP_ROM_PTR(&sdioio_sdcard_readblocks_obj) },
     { MP_ROM_QSTR(MP_QSTR_writeblocks), MP_ROM_PTR(&sdioio_sdcard_writeblocks_obj) },
+    { MP_ROM_QSTR(MP_QSTR_sync), MP_ROM_PTR(&sdioio_sdcard_sync_obj) },
 };
 STATIC MP_DEFINE_CONST_DICT(sdioio_sdcard_locals_dict, sdioio_sdcard_locals_dict_table);
 
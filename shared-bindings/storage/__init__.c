@@ -158,6 +158,63 @@ mp_obj_t storage_erase_filesystem(void) {
 }
 MP_DEFINE_CONST_FUN_OBJ_0(storage_erase_filesystem_obj, storage_erase_filesystem);
 
+#if MICROPY_VFS_MMAP
+//| def mmap(path: str) -> memoryview:
+//|     """Returns a read-only `memoryview` of the whole file that reads it in place
+//|     instead of copying it to RAM. It can be passed to anything that takes a buffer,
+//|     such as `audiocore.RawSample`.
+//|
+//|     This only works for files on internal flash that are stored in one contiguous
+//|     run of clusters. Otherwise `OSError` is raised and the file has to be read
+//|     normally. Copying a file to a freshly erased filesystem usually stores it
+//|     contiguously.
+//|
+//|     .. warning:: The view keeps showing what is stored at the file's old location
+//|          when the file is changed or deleted, including from the host computer over USB."""
+//|     ...
+//|
+mp_obj_t storage_mmap(mp_obj_t path_in) {
+    return common_hal_storage_mmap(path_in);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(storage_mmap_obj, storage_mmap);
+#endif
+
+#if MICROPY_VFS_FAT_BENCHMARK
+//| def benchmark(device: Any = None, *, write: bool = False, random: bool = False, count: int = 64, blocks: int = 1) -> Tuple[int, int, int, int, Tuple[int, ...]]:
+//|     """Times ``count`` reads, or writes, of ``blocks`` blocks at a time on a block
+//|     device, such as `sdcardio.SDCard` or `sdioio.SDCard`, or on the device under a
+//|     `VfsFat`. The default is the ``CIRCUITPY`` filesystem on flash. Blocks are
+//|     accessed one after another, or all over the device when ``random`` is true.
+//|
+//|     Returns a named tuple with the throughput in ``bytes_per_second``, the median
+//|     and 99th percentile latencies ``p50_us`` and ``p99_us``, ``max_us``, and the
+//|     ``histogram`` of latencies, where item ``i`` counts the operations that took
+//|     less than ``2**i`` but at least ``2**(i - 1)`` microseconds. Times are only
+//|     as fine as the board's clock, which is about 30 microseconds on most boards.
+//|
+//|     Writes put back the data just read from the same blocks, so nothing on the
+//|     device changes, and only the writes and a final sync are timed. Writing to a
+//|     filesystem that is writable over USB raises `OSError`."""
+//|     ...
+//|
+mp_obj_t storage_benchmark(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_device, ARG_write, ARG_random, ARG_count, ARG_blocks };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_device, MP_ARG_OBJ, {.u_obj = mp_const_none} },
+        { MP_QSTR_write, MP_ARG_KW_ONLY | MP_ARG_BOOL, {.u_bool = false} },
+        { MP_QSTR_random, MP_ARG_KW_ONLY | MP_ARG_BOOL, {.u_bool = false} },
+        { MP_QSTR_count, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 64} },
+        { MP_QSTR_blocks, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 1} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    return common_hal_storage_benchmark(args[ARG_device].u_obj, args[ARG_write].u_bool,
+        args[ARG_random].u_bool, args[ARG_count].u_int, args[ARG_blocks].u_int);
+}
+MP_DEFINE_CONST_FUN_OBJ_KW(storage_benchmark_obj, 0, storage_benchmark);
+#endif
+
 STATIC const mp_rom_map_elem_t storage_module_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_storage) },
 
@@ -166,6 +223,12 @@ STATIC const mp_rom_map_elem_t storage_module_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR_remount), MP_ROM_PTR(&storage_remount_obj) },
     { MP_ROM_QSTR(MP_QSTR_getmount), MP_ROM_PTR(&storage_getmount_obj) },
     { MP_ROM_QSTR(MP_QSTR_erase_filesystem), MP_ROM_PTR(&storage_erase_filesystem_obj) },
+    #if MICROPY_VFS_MMAP
+    { MP_ROM_QSTR(MP_QSTR_mmap), MP_ROM_PTR(&storage_mmap_obj) },
+    #endif
+    #if MICROPY_VFS_FAT_BENCHMARK
+    { MP_ROM_QSTR(MP_QSTR_benchmark), MP_ROM_PTR(&storage_benchmark_obj) },
+    #endif
 
 //| class VfsFat:
 //|     def __init__(self, block_device: str) -> None:
@@ -36,5 +36,7 @@ void common_hal_storage_umount_object(mp_obj_t vfs_obj);
 void common_hal_storage_remount(const char* path, bool readonly, bool disable_concurrent_write_protection);
 mp_obj_t common_hal_storage_getmount(const char* path);
 void common_hal_storage_erase_filesystem(void);
+mp_obj_t common_hal_storage_mmap(mp_obj_t path);
+mp_obj_t common_hal_storage_benchmark(mp_obj_t device, bool write, bool random, mp_int_t count, mp_int_t blocks);
 
 #endif  // MICROPY_INCLUDED_SHARED_BINDINGS_STORAGE___INIT___H
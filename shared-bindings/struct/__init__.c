@@ -34,6 +34,7 @@
 #include "py/objtuple.h"
 #include "py/binary.h"
 #include "py/parsenum.h"
+#include "shared-bindings/struct/Struct.h"
 #include "shared-bindings/struct/__init__.h"
 #include "shared-module/struct/__init__.h"
 #include "supervisor/shared/translate.h"
@@ -60,7 +61,7 @@ STATIC mp_obj_t struct_calcsize(mp_obj_t fmt_in) {
 
     return MP_OBJ_NEW_SMALL_INT(shared_modules_struct_calcsize(fmt_in));
 }
-MP_DEFINE_CONST_FUN_OBJ_1(struct_calcsize_obj, struct_calcsize);
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(struct_calcsize_obj, struct_calcsize);
 
 //| def pack(fmt: str, *values: Any) -> bytes:
 //|     """Pack the values according to the format string fmt.
@@ -78,7 +79,7 @@ STATIC mp_obj_t struct_pack(size_t n_args, const mp_obj_t *args) {
     shared_modules_struct_pack_into(args[0], p, end_p, n_args - 1, &args[1]);
     return mp_obj_new_str_from_vstr(&mp_type_bytes, &vstr);
 }
-MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(struct_pack_obj, 1, MP_OBJ_FUN_ARGS_MAX, struct_pack);
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(struct_pack_obj, 1, MP_OBJ_FUN_ARGS_MAX, struct_pack);
 
 //| def pack_into(fmt: str, buffer: WriteableBuffer, offset: int, *values: Any) -> None:
 //|     """Pack the values according to the format string fmt into a buffer
@@ -104,7 +105,7 @@ STATIC mp_obj_t struct_pack_into(size_t n_args, const mp_obj_t *args) {
     shared_modules_struct_pack_into(args[0], p, end_p, n_args - 3, &args[3]);
     return mp_const_none;
 }
-MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(struct_pack_into_obj, 3, MP_OBJ_FUN_ARGS_MAX, struct_pack_into);
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(struct_pack_into_obj, 3, MP_OBJ_FUN_ARGS_MAX, struct_pack_into);
 
 //| def unpack(fmt: str, data: ReadableBuffer) -> Tuple[Any, ...]:
 //|     """Unpack from the data according to the format string fmt. The return value
@@ -114,6 +115,7 @@ MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(struct_pack_into_obj, 3, MP_OBJ_FUN_ARGS_MAX
 //|
 
 STATIC mp_obj_t struct_unpack(size_t n_args, const mp_obj_t *args) {
+    (void)n_args;
     mp_buffer_info_t bufinfo;
     mp_get_buffer_raise(args[1], &bufinfo, MP_BUFFER_READ);
     byte *p = bufinfo.buf;
@@ -122,7 +124,7 @@ STATIC mp_obj_t struct_unpack(size_t n_args, const mp_obj_t *args) {
     // true means check the size must be exactly right.
     return MP_OBJ_FROM_PTR(shared_modules_struct_unpack_from(args[0] , p, end_p, true));
 }
-MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(struct_unpack_obj, 2, 3, struct_unpack);
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(struct_unpack_obj, 2, 3, struct_unpack);
 
 //| def unpack_from(fmt: str, data: ReadableBuffer, offset: int = 0) -> Tuple[Any, ...]:
 //|     """Unpack from the data starting at offset according to the format string fmt.
@@ -162,7 +164,22 @@ STATIC mp_obj_t struct_unpack_from(size_t n_args, const mp_obj_t *pos_args, mp_m
     // that be buffer be big enough.
     return MP_OBJ_FROM_PTR(shared_modules_struct_unpack_from(args[ARG_format].u_obj, p, end_p, false));
 }
-MP_DEFINE_CONST_FUN_OBJ_KW(struct_unpack_from_obj, 0, struct_unpack_from);
+STATIC MP_DEFINE_CONST_FUN_OBJ_KW(struct_unpack_from_obj, 0, struct_unpack_from);
+
+//| def iter_unpack(fmt: str, data: ReadableBuffer) -> Iterator[Tuple[Any, ...]]:
+//|     """Return an iterator that unpacks consecutive records from the data
+//|     according to the format string fmt. The data must be a multiple of
+//|     ``calcsize(fmt)`` bytes long. The format is parsed only once, see `Struct`."""
+//|     ...
+//|
+
+STATIC mp_obj_t struct_iter_unpack(mp_obj_t fmt_in, mp_obj_t data) {
+    struct_struct_obj_t *st = m_new_obj(struct_struct_obj_t);
+    st->base.type = &struct_struct_type;
+    shared_modules_struct_struct_construct(st, fmt_in);
+    return shared_modules_struct_struct_iter_unpack(st, data);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_2(struct_iter_unpack_obj, struct_iter_unpack);
 
 STATIC const mp_rom_map_elem_t mp_module_struct_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_struct) },
@@ -171,6 +188,8 @@ STATIC const mp_rom_map_elem_t mp_module_struct_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR_pack_into), MP_ROM_PTR(&struct_pack_into_obj) },
     { MP_ROM_QSTR(MP_QSTR_unpack), MP_ROM_PTR(&struct_unpack_obj) },
     { MP_ROM_QSTR(MP_QSTR_unpack_from), MP_ROM_PTR(&struct_unpack_from_obj) },
+    { MP_ROM_QSTR(MP_QSTR_iter_unpack), MP_ROM_PTR(&struct_iter_unpack_obj) },
+    { MP_ROM_QSTR(MP_QSTR_Struct), MP_ROM_PTR(&struct_struct_type) },
 };
 
 STATIC MP_DEFINE_CONST_DICT(mp_module_struct_globals, mp_module_struct_globals_table);
@@ -26,6 +26,8 @@
 
 // This implementation largely follows the structure of adafruit_sdcard.py
 
+#include <string.h>
+
 #include "shared-bindings/busio/SPI.h"
 #include "shared-bindings/digitalio/DigitalInOut.h"
 #include "shared-bindings/time/__init__.h"
@@ -49,6 +51,11 @@
 #define TOKEN_STOP_TRAN (0xFD)
 #define TOKEN_DATA (0xFE)
 
+// Number of bytes clocked in at once while polling the card for a token or
+// for it to become ready. One call per chunk is much cheaper than one per
+// byte, and bytes that arrive after a data token are kept.
+#define POLL_CHUNK (8)
+
 STATIC bool lock_and_configure_bus(sdcardio_sdcard_obj_t *self) {
     if (!common_hal_busio_spi_try_lock(self->bus)) {
         return false;
@@ -93,15 +100,62 @@ static uint8_t CRC7(const uint8_t* data, uint8_t n) {
 }
 
 #define READY_TIMEOUT_NS (300 * 1000 * 1000) // 300ms
+#define WRITE_TIMEOUT_NS (500 * 1000 * 1000) // 500ms
+// The card holds its output low while busy and sends 0xff once it's ready.
+// Extra clocks while waiting are ignored by the card.
+STATIC bool wait_for_ready_timeout(sdcardio_sdcard_obj_t *self, uint64_t timeout_ns) {
+    uint64_t deadline = common_hal_time_monotonic_ns() + timeout_ns;
+    uint8_t buf[POLL_CHUNK];
+    do {
+        common_hal_busio_spi_read(self->bus, buf, sizeof(buf), 0xff);
+        if (buf[sizeof(buf) - 1] == 0xff) {
+            return true;
+        }
+    } while (common_hal_time_monotonic_ns() < deadline);
+    return false;
+}
+
 STATIC void wait_for_ready(sdcardio_sdcard_obj_t *self) {
+    wait_for_ready_timeout(self, READY_TIMEOUT_NS);
+}
+
+// Wait for the token that starts a data block and read the block into buf.
+// The first skip bytes clocked in are discarded, which lets the caller read
+// the CRC of the previous block along with the first poll. Returns how many
+// bytes of this block's CRC are still to be read, or a negative error.
+STATIC int read_data_block(sdcardio_sdcard_obj_t *self, uint8_t *buf, size_t size, size_t skip) {
+    uint8_t chunk[2 + POLL_CHUNK];
+    // Don't clock in anything past the end of this block.
+    size_t poll_len = MIN(POLL_CHUNK, size + 3);
     uint64_t deadline = common_hal_time_monotonic_ns() + READY_TIMEOUT_NS;
-    while (common_hal_time_monotonic_ns() < deadline) {
-        uint8_t b;
-        common_hal_busio_spi_read(self->bus, &b, 1, 0xff);
-        if (b == 0xff) {
-            break;
+    size_t start = 0;
+    size_t rest = 0;
+    bool found = false;
+    while (!found) {
+        size_t len = skip + poll_len;
+        common_hal_busio_spi_read(self->bus, chunk, len, 0xff);
+        for (size_t i = skip; i < len; i++) {
+            if (chunk[i] == TOKEN_DATA) {
+                found = true;
+                start = i + 1;
+                rest = len - start;
+                break;
+            }
+            if ((chunk[i] & 0xf0) == 0) {
+                // Data error token
+                return -EIO;
+            }
+        }
+        skip = 0;
+        if (!found && common_hal_time_monotonic_ns() > deadline) {
+            return -EIO;
         }
     }
+    // Bytes that came in after the token are the start of the data.
+    size_t early = MIN(rest, size);
+    memcpy(buf, chunk + start, early);
+    common_hal_busio_spi_read(self->bus, buf + early, size - early, 0xff);
+    return 2 - (rest - early);
 }
 
 // In Python API, defaults are response=None, data_block=True, wait=True
@@ -138,18 +192,18 @@ STATIC int cmd(sdcardio_sdcard_obj_t *self, int cmd, int arg, void *response_buf
     if (response_buf) {
 
         if (data_block) {
-            cmdbuf[1] = 0xff;
-            do {
-                // Wait for the start block byte
-                common_hal_busio_spi_read(self->bus, cmdbuf+1, 1, 0xff);
-            } while (cmdbuf[1] != 0xfe);
-        }
-
-        common_hal_busio_spi_read(self->bus, response_buf, response_len, 0xff);
-
-        if (data_block) {
+            // No data follows a rejected command.
+            if (cmdbuf[0] != 0) {
+                return cmdbuf[0];
+            }
+            int crc_left = read_data_block(self, response_buf, response_len, 0);
+            if (crc_left < 0) {
+                return crc_left;
+            }
             // Read and discard the CRC-CCITT checksum
-            common_hal_busio_spi_read(self->bus, cmdbuf+1, 2, 0xff);
+            common_hal_busio_spi_read(self->bus, cmdbuf+1, crc_left, 0xff);
+        } else {
+            common_hal_busio_spi_read(self->bus, response_buf, response_len, 0xff);
         }
 
     }
@@ -313,19 +367,6 @@ int common_hal_sdcardio_sdcard_get_blockcount(sdcardio_sdcard_obj_t *self) {
     return self->sectors;
 }
 
-int readinto(sdcardio_sdcard_obj_t *self, void *buf, size_t size) {
-    uint8_t aux[2] = {0, 0};
-    while (aux[0] != 0xfe) {
-        common_hal_busio_spi_read(self->bus, aux, 1, 0xff);
-    }
-
-    common_hal_busio_spi_read(self->bus, buf, size, 0xff);
-
-    // Read checksum and throw it away
-    common_hal_busio_spi_read(self->bus, aux, sizeof(aux), 0xff);
-    return 0;
-}
-
 int readblocks(sdcardio_sdcard_obj_t *self, uint32_t start_block, mp_buffer_info_t *buf) {
     uint32_t nblocks = buf->len / 512;
     if (nblocks == 1) {
@@ -338,14 +379,19 @@ int readblocks(sdcardio_sdcard_obj_t *self, uint32_t start_block, mp_buffer_info
             return r;
         }
 
+        // The checksum of each block is read and thrown away along with the
+        // first poll for the next block's token.
         uint8_t *ptr = buf->buf;
+        int crc_left = 0;
         while (nblocks--) {
-            r = readinto(self, ptr, 512);
-            if (r < 0) {
-                return r;
+            crc_left = read_data_block(self, ptr, 512, crc_left);
+            if (crc_left < 0) {
+                return crc_left;
             }
             ptr += 512;
         }
+        uint8_t crc[2];
+        common_hal_busio_spi_read(self->bus, crc, crc_left, 0xff);
 
         // End the multi-block read
         r = cmd(self, 12, 0, NULL, 0, true, false);
@@ -378,14 +424,17 @@ int common_hal_sdcardio_sdcard_readblocks(sdcardio_sdcard_obj_t *self, uint32_t
 int _write(sdcardio_sdcard_obj_t *self, uint8_t token, void *buf, size_t size) {
     wait_for_ready(self);
 
-    uint8_t cmd[2];
+    uint8_t cmd[2 + POLL_CHUNK];
     cmd[0] = token;
 
     common_hal_busio_spi_write(self->bus, cmd, 1);
     common_hal_busio_spi_write(self->bus, buf, size);
 
-    cmd[0] = cmd[1] = 0xff;
-    common_hal_busio_spi_write(self->bus, cmd, 2);
+    // The CRC isn't checked in SPI mode so it's sent as 0xff, clocked out
+    // while reading the first bytes of the response.
+    size_t len = sizeof(cmd);
+    size_t i = 2;
+    common_hal_busio_spi_read(self->bus, cmd, len, 0xff);
 
     // Check the response
     // This differs from the traditional adafruit_sdcard handling,
@@ -399,22 +448,33 @@ int _write(sdcardio_sdcard_obj_t *self, uint8_t token, void *buf, size_t size) {
     // with STATUS 010 indicating "data accepted", and other status bit
     // combinations indicating failure.
     // In practice, I was seeing cmd[0] as 0xe5, indicating success
-    for (int i=0; i<CMD_TIMEOUT; i++) {
-        common_hal_busio_spi_read(self->bus, cmd, 1, 0xff);
-        DEBUG_PRINT("i=%02d cmd[0] = 0x%02x\n", i, cmd[0]);
-        if ((cmd[0] & 0b00010001) == 0b00000001) {
-            if ((cmd[0] & 0x1f) != 0x5) {
-                return -EIO;
-            } else {
+    int response = -1;
+    for (int polled = 0; polled < CMD_TIMEOUT; polled += POLL_CHUNK) {
+        if (polled > 0) {
+            len = POLL_CHUNK;
+            i = 0;
+            common_hal_busio_spi_read(self->bus, cmd, len, 0xff);
+        }
+        for (; i < len; i++) {
+            DEBUG_PRINT("i=%02d cmd[i] = 0x%02x\n", (int)i, cmd[i]);
+            if ((cmd[i] & 0b00010001) == 0b00000001) {
+                response = cmd[i++];
                 break;
             }
         }
+        if (response >= 0) {
+            break;
+        }
+    }
+    if ((response & 0x1f) != 0x5) {
+        return -EIO;
     }
 
-    // Wait for the write to finish
-    do {
-        common_hal_busio_spi_read(self->bus, cmd, 1, 0xff);
-    } while (cmd[0] == 0);
+    // Wait for the write to finish, unless the card was already done by the
+    // end of what we read.
+    if ((i == len || cmd[len - 1] != 0xff) && !wait_for_ready_timeout(self, WRITE_TIMEOUT_NS)) {
+        return -EIO;
+    }
 
     // Success
     return 0;
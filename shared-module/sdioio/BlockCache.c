@@ -0,0 +1,242 @@
+
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2020 MicroPython & CircuitPython contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "shared-module/sdioio/BlockCache.h"
+
+#include <string.h>
+
+#include "py/misc.h"
+
+STATIC uint8_t *window_block(sdioio_block_cache_t *self, uint32_t block) {
+    return self->buf + (block - self->window_start) * SDIOIO_BLOCK_SIZE;
+}
+
+STATIC uint8_t *slot_data(sdioio_block_cache_t *self, uint16_t slot) {
+    return self->buf + (self->window_size + slot) * SDIOIO_BLOCK_SIZE;
+}
+
+STATIC size_t allocation_size(uint16_t size) {
+    return size * (SDIOIO_BLOCK_SIZE + sizeof(uint32_t));
+}
+
+void sdioio_block_cache_init(sdioio_block_cache_t *self, const sdioio_block_cache_io_t *io, void *dev, uint32_t block_count, uint16_t size) {
+    self->io = io;
+    self->dev = dev;
+    self->block_count = block_count;
+    self->buf = NULL;
+    self->slot_blocks = NULL;
+    if (size > 0) {
+        self->buf = m_new(uint8_t, allocation_size(size));
+        self->slot_blocks = (uint32_t*) (self->buf + size * SDIOIO_BLOCK_SIZE);
+    }
+    self->window_size = size / 2;
+    self->slot_count = size - self->window_size;
+    self->window_start = 0;
+    self->window_count = 0;
+    self->next_read[0] = SDIOIO_NO_BLOCK;
+    self->next_read[1] = SDIOIO_NO_BLOCK;
+    self->slots_used = 0;
+}
+
+void sdioio_block_cache_deinit(sdioio_block_cache_t *self) {
+    if (self->buf != NULL) {
+        m_del(uint8_t, self->buf, allocation_size(self->window_size + self->slot_count));
+        self->buf = NULL;
+    }
+    self->window_size = 0;
+    self->window_count = 0;
+    self->slot_count = 0;
+    self->slots_used = 0;
+}
+
+STATIC int find_slot(sdioio_block_cache_t *self, uint32_t block) {
+    for (uint16_t i = 0; i < self->slots_used; i++) {
+        if (self->slot_blocks[i] == block) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+// Copy the held back blocks within the given range over data read from the
+// card.
+STATIC void overlay_slots(sdioio_block_cache_t *self, uint32_t start_block, uint8_t *buf, uint32_t num_blocks) {
+    for (uint16_t i = 0; i < self->slots_used; i++) {
+        uint32_t block = self->slot_blocks[i];
+        if (block >= start_block && block < start_block + num_blocks) {
+            memcpy(buf + (block - start_block) * SDIOIO_BLOCK_SIZE, slot_data(self, i), SDIOIO_BLOCK_SIZE);
+        }
+    }
+}
+
+int sdioio_block_cache_flush(sdioio_block_cache_t *self) {
+    if (self->slots_used == 0) {
+        return 0;
+    }
+    // Sort the slots by block.
+    uint8_t order[SDIOIO_BLOCK_CACHE_MAX_SIZE / 2];
+    for (uint16_t i = 0; i < self->slots_used; i++) {
+        uint16_t j = i;
+        while (j > 0 && self->slot_blocks[order[j - 1]] > self->slot_blocks[i]) {
+            order[j] = order[j - 1];
+            j--;
+        }
+        order[j] = i;
+    }
+    int result = 0;
+    uint16_t i = 0;
+    while (i < self->slots_used) {
+        uint32_t first = self->slot_blocks[order[i]];
+        uint16_t run = 1;
+        while (i + run < self->slots_used && run < self->window_size &&
+               self->slot_blocks[order[i + run]] == first + run) {
+            run++;
+        }
+        const uint8_t *data = slot_data(self, order[i]);
+        if (run > 1) {
+            // Gather the run in the window, which is refilled later.
+            self->window_count = 0;
+            for (uint16_t j = 0; j < run; j++) {
+                memcpy(self->buf + j * SDIOIO_BLOCK_SIZE, slot_data(self, order[i + j]), SDIOIO_BLOCK_SIZE);
+            }
+            data = self->buf;
+        }
+        int r = self->io->writeblocks(self->dev, first, data, run);
+        if (r < 0) {
+            result = r;
+        }
+        i += run;
+    }
+    self->slots_used = 0;
+    return result;
+}
+
+int sdioio_block_cache_readblocks(sdioio_block_cache_t *self, uint32_t start_block, uint8_t *buf, uint32_t num_blocks) {
+    if (self->window_size + self->slot_count == 0) {
+        return self->io->readblocks(self->dev, start_block, buf, num_blocks);
+    }
+    bool sequential = true;
+    if (start_block == self->next_read[1]) {
+        self->next_read[1] = start_block + num_blocks;
+    } else {
+        sequential = start_block == self->next_read[0];
+        if (!sequential) {
+            self->next_read[1] = self->next_read[0];
+        }
+        self->next_read[0] = start_block + num_blocks;
+    }
+    uint32_t window_end = self->window_start + self->window_count;
+    if (start_block >= self->window_start && start_block < window_end) {
+        // Copy out what's in the window, which is kept up to date with the
+        // held back writes, and read ahead for the rest.
+        uint32_t held = MIN(num_blocks, window_end - start_block);
+        memcpy(buf, window_block(self, start_block), held * SDIOIO_BLOCK_SIZE);
+        if (held == num_blocks) {
+            return 0;
+        }
+        start_block += held;
+        buf += held * SDIOIO_BLOCK_SIZE;
+        num_blocks -= held;
+        sequential = true;
+    }
+    // Blocks that were just written, such as the FAT sector that FatFs
+    // rereads while a file grows, don't need the card at all.
+    uint32_t in_slots = 0;
+    while (in_slots < num_blocks && find_slot(self, start_block + in_slots) >= 0) {
+        in_slots++;
+    }
+    if (in_slots == num_blocks) {
+        overlay_slots(self, start_block, buf, num_blocks);
+        return 0;
+    }
+    if (!sequential || num_blocks >= self->window_size ||
+        start_block + self->window_size > self->block_count) {
+        int r = self->io->readblocks(self->dev, start_block, buf, num_blocks);
+        if (r < 0) {
+            return r;
+        }
+        overlay_slots(self, start_block, buf, num_blocks);
+        return 0;
+    }
+    self->window_count = 0;
+    int r = self->io->readblocks(self->dev, start_block, self->buf, self->window_size);
+    if (r < 0) {
+        return r;
+    }
+    self->window_start = start_block;
+    self->window_count = self->window_size;
+    overlay_slots(self, start_block, self->buf, self->window_size);
+    memcpy(buf, self->buf, num_blocks * SDIOIO_BLOCK_SIZE);
+    return 0;
+}
+
+int sdioio_block_cache_writeblocks(sdioio_block_cache_t *self, uint32_t start_block, const uint8_t *buf, uint32_t num_blocks) {
+    if (self->slot_count == 0 || start_block + num_blocks > self->block_count) {
+        return self->io->writeblocks(self->dev, start_block, buf, num_blocks);
+    }
+    // Keep the window up to date.
+    uint32_t window_end = self->window_start + self->window_count;
+    if (start_block < window_end && start_block + num_blocks > self->window_start) {
+        uint32_t first = MAX(start_block, self->window_start);
+        uint32_t last = MIN(start_block + num_blocks, window_end);
+        memcpy(window_block(self, first), buf + (first - start_block) * SDIOIO_BLOCK_SIZE,
+            (last - first) * SDIOIO_BLOCK_SIZE);
+    }
+    if (num_blocks > self->slot_count / 2) {
+        // Large writes go straight to the card and replace what's held back
+        // for the same blocks.
+        uint16_t i = 0;
+        while (i < self->slots_used) {
+            uint32_t block = self->slot_blocks[i];
+            if (block >= start_block && block < start_block + num_blocks) {
+                self->slots_used--;
+                self->slot_blocks[i] = self->slot_blocks[self->slots_used];
+                memcpy(slot_data(self, i), slot_data(self, self->slots_used), SDIOIO_BLOCK_SIZE);
+            } else {
+                i++;
+            }
+        }
+        return self->io->writeblocks(self->dev, start_block, buf, num_blocks);
+    }
+    int result = 0;
+    for (uint32_t i = 0; i < num_blocks; i++) {
+        uint32_t block = start_block + i;
+        int slot = find_slot(self, block);
+        if (slot < 0) {
+            if (self->slots_used == self->slot_count) {
+                int r = sdioio_block_cache_flush(self);
+                if (r < 0) {
+                    result = r;
+                }
+            }
+            slot = self->slots_used++;
+            self->slot_blocks[slot] = block;
+        }
+        memcpy(slot_data(self, slot), buf + i * SDIOIO_BLOCK_SIZE, SDIOIO_BLOCK_SIZE);
+    }
+    return result;
+}
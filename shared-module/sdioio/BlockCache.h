@@ -0,0 +1,84 @@
+
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2020 MicroPython & CircuitPython contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef MICROPY_INCLUDED_SHARED_MODULE_SDIOIO_BLOCKCACHE_H
+#define MICROPY_INCLUDED_SHARED_MODULE_SDIOIO_BLOCKCACHE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Buffers blocks between the filesystem and an SD card so that small
+// requests turn into large multi-block transfers. Half of the buffers form a
+// read ahead window: reads that continue where the previous one ended fill
+// the whole window starting at the requested block. The other half hold back
+// written blocks, such as the data and FAT sectors that FatFs writes in
+// turn. Once they are all taken, or the cache is flushed, they are written
+// back in block order with one command per contiguous run.
+
+#define SDIOIO_BLOCK_SIZE (512)
+#define SDIOIO_NO_BLOCK (0xffffffff)
+
+// FatFs never transfers more than 128 blocks at once.
+#define SDIOIO_BLOCK_CACHE_MAX_SIZE (128)
+
+typedef struct {
+    int (*readblocks)(void *dev, uint32_t start_block, uint8_t *buf, uint32_t num_blocks);
+    int (*writeblocks)(void *dev, uint32_t start_block, const uint8_t *buf, uint32_t num_blocks);
+} sdioio_block_cache_io_t;
+
+typedef struct {
+    const sdioio_block_cache_io_t *io;
+    void *dev;
+    // The read ahead window followed by the write slots.
+    uint8_t *buf;
+    // Block held back in each write slot.
+    uint32_t *slot_blocks;
+    uint32_t block_count;
+    // First block in the window.
+    uint32_t window_start;
+    // Blocks after the ends of the last two reads, to spot sequential reads
+    // even when FatFs looks up the FAT between them.
+    uint32_t next_read[2];
+    uint16_t window_size;
+    uint16_t window_count;
+    uint16_t slot_count;
+    uint16_t slots_used;
+} sdioio_block_cache_t;
+
+// Size is the total number of blocks buffered. 0 passes every request
+// straight through. The buffers are allocated on the heap.
+void sdioio_block_cache_init(sdioio_block_cache_t *self, const sdioio_block_cache_io_t *io, void *dev, uint32_t block_count, uint16_t size);
+void sdioio_block_cache_deinit(sdioio_block_cache_t *self);
+
+// Return 0 on success and a negative errno otherwise, like the common_hal
+// functions they wrap.
+int sdioio_block_cache_readblocks(sdioio_block_cache_t *self, uint32_t start_block, uint8_t *buf, uint32_t num_blocks);
+int sdioio_block_cache_writeblocks(sdioio_block_cache_t *self, uint32_t start_block, const uint8_t *buf, uint32_t num_blocks);
+// Write out the held back blocks.
+int sdioio_block_cache_flush(sdioio_block_cache_t *self);
+
+#endif // MICROPY_INCLUDED_SHARED_MODULE_SDIOIO_BLOCKCACHE_H
@@ -29,6 +29,7 @@
 #include <string.h>
 
 #include "extmod/vfs.h"
+#include "extmod/vfs_fat.h"
 #include "py/mperrno.h"
 #include "py/mphal.h"
 #include "py/obj.h"
@@ -144,6 +145,21 @@ mp_obj_t common_hal_storage_getmount(const char *mount_path) {
     return storage_object_from_path(mount_path);
 }
 
+#if MICROPY_VFS_MMAP
+mp_obj_t common_hal_storage_mmap(mp_obj_t path) {
+    return mp_vfs_mmap(path);
+}
+#endif
+
+#if MICROPY_VFS_FAT_BENCHMARK
+mp_obj_t common_hal_storage_benchmark(mp_obj_t device, bool write, bool random, mp_int_t count, mp_int_t blocks) {
+    if (device == mp_const_none) {
+        device = storage_object_from_path("/");
+    }
+    return fat_vfs_benchmark(device, write, random, count, blocks);
+}
+#endif
+
 void common_hal_storage_remount(const char *mount_path, bool readonly, bool disable_concurrent_write_protection) {
     if (strcmp(mount_path, "/") != 0) {
         mp_raise_OSError(MP_EINVAL);
@@ -0,0 +1,260 @@
+
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2020 MicroPython & CircuitPython contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <string.h>
+
+#include "py/runtime.h"
+#include "py/binary.h"
+#include "py/objint.h"
+#include "py/smallint.h"
+#include "py/objtuple.h"
+#include "shared-bindings/struct/Struct.h"
+#include "shared-module/struct/__init__.h"
+#include "supervisor/shared/translate.h"
+
+#define is_signed(typecode) (typecode > 'Z')
+
+void shared_modules_struct_struct_construct(struct_struct_obj_t *self, mp_obj_t format) {
+    const char *fmt = mp_obj_str_get_str(format);
+    char fmt_type = get_fmt_type(&fmt);
+
+    // Every code other than a pad byte becomes one op, whatever its count.
+    size_t num_ops = 0;
+    for (const char *f = fmt; *f; f++) {
+        if (!unichar_isdigit(*f) && *f != 'x') {
+            num_ops++;
+        }
+    }
+
+    self->format = format;
+    self->ops = m_new(struct_struct_op_t, num_ops);
+    self->num_ops = 0;
+    self->num_items = 0;
+    #if MP_ENDIANNESS_BIG
+    self->big_endian = fmt_type != '<';
+    #else
+    self->big_endian = fmt_type == '>';
+    #endif
+
+    // Offsets are aligned relative to the start of the data, as calcsize() does.
+    mp_uint_t offset = 0;
+    while (*fmt) {
+        mp_uint_t cnt = 1;
+        if (unichar_isdigit(*fmt)) {
+            cnt = get_fmt_num(&fmt);
+        }
+        char type = *fmt++;
+        struct_validate_format(type);
+
+        if (type == 's') {
+            self->ops[self->num_ops++] = (struct_struct_op_t) { offset, cnt, type, 1 };
+            self->num_items++;
+            offset += cnt;
+        } else {
+            mp_uint_t align;
+            size_t sz = mp_binary_get_size(fmt_type, type, &align);
+            offset = (offset + align - 1) & ~(align - 1);
+            if (type != 'x') {
+                self->ops[self->num_ops++] = (struct_struct_op_t) { offset, cnt, type, sz };
+                self->num_items += cnt;
+            }
+            offset += sz * cnt;
+        }
+    }
+    self->size = offset;
+}
+
+STATIC mp_obj_t struct_get_item(const struct_struct_op_t *op, bool big_endian, const byte *p) {
+    long long val = mp_binary_get_int(op->size, is_signed(op->type), big_endian, p);
+    #if MICROPY_PY_BUILTINS_FLOAT
+    if (op->type == 'f') {
+        union { uint32_t i; float f; } fpu = {val};
+        return mp_obj_new_float((mp_float_t) fpu.f);
+    } else if (op->type == 'd') {
+        union { uint64_t i; double f; } fpu = {val};
+        return mp_obj_new_float(fpu.f);
+    }
+    #endif
+    if (is_signed(op->type)) {
+        if ((long long)MP_SMALL_INT_MIN <= val && val <= (long long)MP_SMALL_INT_MAX) {
+            return MP_OBJ_NEW_SMALL_INT((mp_int_t)val);
+        }
+        return mp_obj_new_int_from_ll(val);
+    } else {
+        if ((unsigned long long)val <= (unsigned long long)MP_SMALL_INT_MAX) {
+            return MP_OBJ_NEW_SMALL_INT((mp_int_t)val);
+        }
+        return mp_obj_new_int_from_ull(val);
+    }
+}
+
+STATIC void struct_set_item(const struct_struct_op_t *op, bool big_endian, mp_obj_t val_in, byte *p) {
+    size_t size = op->size;
+    mp_uint_t val;
+    switch (op->type) {
+        #if MICROPY_PY_BUILTINS_FLOAT
+        case 'f': {
+            union { uint32_t i; float f; } fp_sp;
+            fp_sp.f = mp_obj_get_float(val_in);
+            val = fp_sp.i;
+            break;
+        }
+        case 'd': {
+            union { uint64_t i64; uint32_t i32[2]; double f; } fp_dp;
+            fp_dp.f = mp_obj_get_float(val_in);
+            if (BYTES_PER_WORD == 8) {
+                val = fp_dp.i64;
+            } else {
+                mp_binary_set_int(sizeof(uint32_t), big_endian, p, fp_dp.i32[MP_ENDIANNESS_BIG ^ big_endian]);
+                p += sizeof(uint32_t);
+                val = fp_dp.i32[MP_ENDIANNESS_LITTLE ^ big_endian];
+            }
+            break;
+        }
+        #endif
+        default: {
+            bool signed_type = is_signed(op->type);
+            #if MICROPY_LONGINT_IMPL != MICROPY_LONGINT_IMPL_NONE
+            if (MP_OBJ_IS_TYPE(val_in, &mp_type_int)) {
+                mp_obj_int_buffer_overflow_check(val_in, size, signed_type);
+                mp_obj_int_to_bytes_impl(val_in, big_endian, size, p);
+                return;
+            }
+            #endif
+            val = mp_obj_get_int(val_in);
+            mp_small_int_buffer_overflow_check(val, size, signed_type);
+            // zero/sign extend if needed
+            if (BYTES_PER_WORD < 8 && size > sizeof(val)) {
+                int c = (signed_type && (mp_int_t)val < 0) ? 0xff : 0x00;
+                memset(p, c, size);
+                if (big_endian) {
+                    p += size - sizeof(val);
+                }
+            }
+        }
+    }
+    mp_binary_set_int(MIN(size, sizeof(val)), big_endian, p, val);
+}
+
+void shared_modules_struct_struct_pack_into(struct_struct_obj_t *self, byte *p, byte *end_p, size_t n_args, const mp_obj_t *args) {
+    if (p > end_p || (mp_uint_t)(end_p - p) < self->size) {
+        mp_raise_RuntimeError(translate("buffer too small"));
+    }
+    if (n_args > self->num_items) {
+        // CPython raises struct.error here
+        mp_raise_RuntimeError(translate("too many arguments provided with the given format"));
+    }
+
+    // Pad bytes, and any values not given, are left as zero.
+    memset(p, 0, self->size);
+    size_t i = 0;
+    for (const struct_struct_op_t *op = self->ops; i < n_args; op++) {
+        byte *q = p + op->offset;
+        if (op->type == 's') {
+            mp_buffer_info_t bufinfo;
+            mp_get_buffer_raise(args[i++], &bufinfo, MP_BUFFER_READ);
+            memcpy(q, bufinfo.buf, MIN(bufinfo.len, op->count));
+        } else {
+            for (mp_uint_t n = op->count; n > 0 && i < n_args; n--) {
+                struct_set_item(op, self->big_endian, args[i++], q);
+                q += op->size;
+            }
+        }
+    }
+}
+
+mp_obj_tuple_t *shared_modules_struct_struct_unpack_from(struct_struct_obj_t *self, const byte *p, const byte *end_p, bool exact_size) {
+    // If exact_size, make sure the buffer is exactly the right size.
+    // Otherwise just make sure it's big enough.
+    if (exact_size) {
+        if (p > end_p || (mp_uint_t)(end_p - p) != self->size) {
+            mp_raise_RuntimeError(translate("buffer size must match format"));
+        }
+    } else {
+        if (p > end_p || (mp_uint_t)(end_p - p) < self->size) {
+            mp_raise_RuntimeError(translate("buffer too small"));
+        }
+    }
+
+    mp_obj_tuple_t *res = MP_OBJ_TO_PTR(mp_obj_new_tuple(self->num_items, NULL));
+    mp_obj_t *item = res->items;
+    const struct_struct_op_t *op_end = self->ops + self->num_ops;
+    for (const struct_struct_op_t *op = self->ops; op < op_end; op++) {
+        const byte *q = p + op->offset;
+        if (op->type == 's') {
+            *item++ = mp_obj_new_bytes(q, op->count);
+        } else {
+            for (mp_uint_t n = op->count; n > 0; n--) {
+                *item++ = struct_get_item(op, self->big_endian, q);
+                q += op->size;
+            }
+        }
+    }
+    return res;
+}
+
+typedef struct {
+    mp_obj_base_t base;
+    struct_struct_obj_t *st;
+    mp_obj_t buffer;
+    mp_uint_t offset;
+} struct_struct_iter_obj_t;
+
+STATIC mp_obj_t struct_struct_iter_iternext(mp_obj_t self_in) {
+    struct_struct_iter_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    mp_buffer_info_t bufinfo;
+    // Fetched each time, in case the buffer was resized since the last record.
+    mp_get_buffer_raise(self->buffer, &bufinfo, MP_BUFFER_READ);
+    if (self->offset + self->st->size > bufinfo.len) {
+        return MP_OBJ_STOP_ITERATION;
+    }
+    const byte *p = (const byte *)bufinfo.buf + self->offset;
+    self->offset += self->st->size;
+    return MP_OBJ_FROM_PTR(shared_modules_struct_struct_unpack_from(self->st, p, p + self->st->size, true));
+}
+
+STATIC const mp_obj_type_t struct_struct_iter_type = {
+    { &mp_type_type },
+    .name = MP_QSTR_iterator,
+    .getiter = mp_identity_getiter,
+    .iternext = struct_struct_iter_iternext,
+};
+
+mp_obj_t shared_modules_struct_struct_iter_unpack(struct_struct_obj_t *self, mp_obj_t buffer) {
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(buffer, &bufinfo, MP_BUFFER_READ);
+    if (self->size == 0 || bufinfo.len % self->size != 0) {
+        mp_raise_RuntimeError(translate("buffer size must match format"));
+    }
+
+    struct_struct_iter_obj_t *iter = m_new_obj(struct_struct_iter_obj_t);
+    iter->base.type = &struct_struct_iter_type;
+    iter->st = self;
+    iter->buffer = buffer;
+    iter->offset = 0;
+    return MP_OBJ_FROM_PTR(iter);
+}
@@ -37,6 +37,8 @@ void filesystem_background(void);
 void filesystem_tick(void);
 void filesystem_init(bool create_allowed, bool force_create);
 void filesystem_flush(void);
+// Called when file I/O is queued, to have it serviced until none is left.
+void filesystem_schedule_async_io(void);
 bool filesystem_present(void);
 void filesystem_set_internal_writable_by_usb(bool usb_writable);
 void filesystem_set_internal_concurrent_write_protection(bool concurrent_write_protection);
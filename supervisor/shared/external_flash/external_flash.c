@@ -30,6 +30,7 @@
 #include "supervisor/flash.h"
 #include "supervisor/spi_flash_api.h"
 #include "supervisor/shared/external_flash/common_commands.h"
+#include "supervisor/shared/external_flash/flash_ftl.h"
 #include "extmod/vfs.h"
 #include "extmod/vfs_fat.h"
 #include "py/misc.h"
@@ -39,20 +40,45 @@
 #include "shared-bindings/microcontroller/__init__.h"
 #include "supervisor/memory.h"
 #include "supervisor/shared/rgb_led_status.h"
+#include "supervisor/shared/safe_mode.h"
 
 #define NO_SECTOR_LOADED 0xFFFFFFFF
 
-// The currently cached sector in the cache, ram or flash based.
-static uint32_t current_sector;
+#define BLOCKS_PER_SECTOR (SPI_FLASH_ERASE_SIZE / FILESYSTEM_BLOCK_SIZE)
+#define PAGES_PER_BLOCK (FILESYSTEM_BLOCK_SIZE / SPI_FLASH_PAGE_SIZE)
+#define PAGES_PER_SECTOR (SPI_FLASH_ERASE_SIZE / SPI_FLASH_PAGE_SIZE)
+
+// One erase sector held in the cache, ram or flash based.
+typedef struct {
+    // Address of the cached sector or NO_SECTOR_LOADED if the line is unused.
+    uint32_t sector;
+    // Track which blocks (up to 32) of the sector currently live in the cache.
+    uint32_t valid_mask;
+    // Value of cache_use_count when the line was last written. Used for LRU
+    // eviction.
+    uint32_t last_used;
+    // Background flush passes at which the line was last written and at
+    // which it became dirty.
+    uint16_t last_write_pass;
+    uint16_t dirty_pass;
+    // Whether the cache holds data that isn't on the flash yet.
+    bool dirty;
+} cache_line_t;
+
+static cache_line_t cache_lines[CIRCUITPY_EXTERNAL_FLASH_CACHE_SECTORS];
+
+// Number of lines backed by ram and how many of them form a set. When there
+// is no ram cache a single line is cached in the scratch sector of the flash.
+static uint8_t cache_line_count;
+static uint8_t cache_ways;
+
+static uint32_t cache_use_count;
+static uint16_t flush_pass;
 
 const external_flash_device possible_devices[EXTERNAL_FLASH_DEVICE_COUNT] = {EXTERNAL_FLASH_DEVICES};
 
 static const external_flash_device* flash_device = NULL;
 
-// Track which blocks (up to 32) in the current sector currently live in the
-// cache.
-static uint32_t dirty_mask;
-
 static supervisor_allocation* supervisor_cache = NULL;
 
 // Wait until both the write enable and write in progress bits have cleared.
@@ -124,34 +150,46 @@ static bool write_flash(uint32_t address, const uint8_t* data, uint32_t data_len
     return true;
 }
 
-static bool page_erased(uint32_t sector_address) {
-    // Check the first few bytes to catch the common case where there is data
-    // without using a bunch of memory.
-    if (flash_device->no_erase_cmd){
-        // skip this if device doesn't have an erase command.
-        return true;
-    }
-    uint8_t short_buffer[4];
-    if (read_flash(sector_address, short_buffer, 4)) {
-        for (uint16_t i = 0; i < 4; i++) {
-            if (short_buffer[i] != 0xff) {
-                return false;
-            }
+static bool page_erased(const uint8_t* page) {
+    for (uint16_t i = 0; i < SPI_FLASH_PAGE_SIZE; i++) {
+        if (page[i] != 0xff) {
+            return false;
         }
-    } else {
-        return false;
     }
+    return true;
+}
 
-    // Now check the full length.
-    uint8_t full_buffer[FILESYSTEM_BLOCK_SIZE];
-    if (read_flash(sector_address, full_buffer, FILESYSTEM_BLOCK_SIZE)) {
-        for (uint16_t i = 0; i < FILESYSTEM_BLOCK_SIZE; i++) {
-            if (short_buffer[i] != 0xff) {
-                return false;
-            }
+// Program a block without erasing its sector first. This works when each page
+// of the block is either erased or already holds the new data. Pages that
+// already hold the data aren't programmed again. Returns false without
+// writing anything if the sector would need an erase.
+static bool write_block_in_place(uint32_t address, const uint8_t* data) {
+    if (flash_device->no_erase_cmd) {
+        // Devices without an erase command can be written anywhere.
+        return write_flash(address, data, FILESYSTEM_BLOCK_SIZE);
+    }
+    // Check a page at a time so we don't need a whole block on the stack.
+    uint8_t page[SPI_FLASH_PAGE_SIZE];
+    uint8_t program_mask = 0;
+    for (uint8_t i = 0; i < PAGES_PER_BLOCK; i++) {
+        uint32_t offset = i * SPI_FLASH_PAGE_SIZE;
+        if (!read_flash(address + offset, page, SPI_FLASH_PAGE_SIZE)) {
+            return false;
+        }
+        if (memcmp(page, data + offset, SPI_FLASH_PAGE_SIZE) == 0) {
+            continue;
+        }
+        if (!page_erased(page)) {
+            return false;
+        }
+        program_mask |= 1 << i;
+    }
+    for (uint8_t i = 0; i < PAGES_PER_BLOCK; i++) {
+        uint32_t offset = i * SPI_FLASH_PAGE_SIZE;
+        if ((program_mask & (1 << i)) != 0 &&
+            !write_flash(address + offset, data + offset, SPI_FLASH_PAGE_SIZE)) {
+            return false;
         }
-    } else {
-        return false;
     }
     return true;
 }
@@ -175,6 +213,72 @@ static bool erase_sector(uint32_t sector_address) {
     return true;
 }
 
+#if CIRCUITPY_EXTERNAL_FLASH_FTL
+// The whole flash is handed to the FTL which keeps the block map and sector
+// table outside the heap.
+static flash_ftl_t ftl;
+static bool ftl_mounted = false;
+
+static bool ftl_read(void *ctx, uint32_t address, uint8_t *data, uint32_t length) {
+    return read_flash(address, data, length);
+}
+
+// Unlike write_flash this programs partial pages, such as the entries of a
+// sector header.
+static bool ftl_program(void *ctx, uint32_t address, const uint8_t *data, uint32_t length) {
+    while (length > 0) {
+        uint32_t chunk = SPI_FLASH_PAGE_SIZE - address % SPI_FLASH_PAGE_SIZE;
+        if (chunk > length) {
+            chunk = length;
+        }
+        if (!wait_for_flash_ready() || !write_enable()) {
+            return false;
+        }
+        if (!spi_flash_write_data(address, (uint8_t*) data, chunk)) {
+            return false;
+        }
+        address += chunk;
+        data += chunk;
+        length -= chunk;
+    }
+    return true;
+}
+
+static bool ftl_erase(void *ctx, uint32_t sector_address) {
+    return erase_sector(sector_address) && wait_for_flash_ready();
+}
+
+static const flash_ftl_driver_t ftl_driver = {
+    .read = ftl_read,
+    .program = ftl_program,
+    .erase = ftl_erase,
+};
+
+static void mount_ftl(void) {
+    uint16_t sector_count = flash_device->total_size / SPI_FLASH_ERASE_SIZE;
+    uint32_t block_count = FLASH_FTL_BLOCK_COUNT(SPI_FLASH_ERASE_SIZE, sector_count);
+    // The sector table is word sized per entry so the map after it stays
+    // aligned.
+    uint32_t sectors_size = sector_count * sizeof(flash_ftl_sector_t);
+    uint32_t map_size = (block_count * sizeof(uint16_t) + 3) & ~3;
+    supervisor_allocation* tables = allocate_memory(sectors_size + map_size, false);
+    if (tables != NULL) {
+        flash_ftl_init(&ftl, &ftl_driver, SPI_FLASH_ERASE_SIZE, sector_count,
+            (flash_ftl_sector_t*) tables->ptr, (uint16_t*) ((uint8_t*) tables->ptr + sectors_size));
+        ftl_mounted = flash_ftl_mount(&ftl);
+    }
+    if (!ftl_mounted) {
+        // The flash holds the FTL's layout, so the plain sector path would
+        // only show garbage or format over it. Show no disk at all, and say
+        // why from safe mode.
+        ftl.block_count = 0;
+        if (get_safe_mode() == NO_SAFE_MODE) {
+            reset_into_safe_mode(FLASH_FTL_MOUNT_FAIL);
+        }
+    }
+}
+#endif
+
 // Sector is really 24 bits.
 static bool copy_block(uint32_t src_address, uint32_t dest_address) {
     // Copy page by page to minimize RAM buffer.
@@ -191,6 +295,17 @@ static bool copy_block(uint32_t src_address, uint32_t dest_address) {
     return true;
 }
 
+// Forget everything in the cache and split count lines into sets.
+static void reset_cache_lines(uint8_t count) {
+    for (uint8_t i = 0; i < CIRCUITPY_EXTERNAL_FLASH_CACHE_SECTORS; i++) {
+        cache_lines[i].sector = NO_SECTOR_LOADED;
+        cache_lines[i].valid_mask = 0;
+        cache_lines[i].dirty = false;
+    }
+    cache_line_count = count;
+    cache_ways = count < CIRCUITPY_EXTERNAL_FLASH_CACHE_WAYS ? count : CIRCUITPY_EXTERNAL_FLASH_CACHE_WAYS;
+}
+
 void supervisor_flash_init(void) {
     if (flash_device != NULL) {
         return;
@@ -280,9 +395,12 @@ void supervisor_flash_init(void) {
 
     wait_for_flash_ready();
 
-    current_sector = NO_SECTOR_LOADED;
-    dirty_mask = 0;
+    reset_cache_lines(1);
     MP_STATE_VM(flash_ram_cache) = NULL;
+
+    #if CIRCUITPY_EXTERNAL_FLASH_FTL
+    mount_ftl();
+    #endif
 }
 
 // The size of each individual block.
@@ -292,25 +410,30 @@ uint32_t supervisor_flash_get_block_size(void) {
 
 // The total number of available blocks.
 uint32_t supervisor_flash_get_block_count(void) {
+    #if CIRCUITPY_EXTERNAL_FLASH_FTL
+    return ftl.block_count;
+    #else
     // We subtract one erase sector size because we may use it as a staging area
     // for writes.
     return (flash_device->total_size - SPI_FLASH_ERASE_SIZE) / FILESYSTEM_BLOCK_SIZE;
+    #endif
 }
 
 // Flush the cache that was written to the scratch portion of flash. Only used
 // when ram is tight.
 static bool flush_scratch_flash(void) {
-    if (current_sector == NO_SECTOR_LOADED) {
+    cache_line_t *line = &cache_lines[0];
+    if (line->sector == NO_SECTOR_LOADED) {
         return true;
     }
     // First, copy out any blocks that we haven't touched from the sector we've
     // cached.
     bool copy_to_scratch_ok = true;
     uint32_t scratch_sector = flash_device->total_size - SPI_FLASH_ERASE_SIZE;
-    for (uint8_t i = 0; i < SPI_FLASH_ERASE_SIZE / FILESYSTEM_BLOCK_SIZE; i++) {
-        if ((dirty_mask & (1 << i)) == 0) {
+    for (uint8_t i = 0; i < BLOCKS_PER_SECTOR; i++) {
+        if ((line->valid_mask & (1 << i)) == 0) {
             copy_to_scratch_ok = copy_to_scratch_ok &&
-                copy_block(current_sector + i * FILESYSTEM_BLOCK_SIZE,
+                copy_block(line->sector + i * FILESYSTEM_BLOCK_SIZE,
                            scratch_sector + i * FILESYSTEM_BLOCK_SIZE);
         }
     }
@@ -320,35 +443,40 @@ static bool flush_scratch_flash(void) {
         return false;
     }
     // Second, erase the current sector.
-    erase_sector(current_sector);
+    erase_sector(line->sector);
     // Finally, copy the new version into it.
-    for (uint8_t i = 0; i < SPI_FLASH_ERASE_SIZE / FILESYSTEM_BLOCK_SIZE; i++) {
+    for (uint8_t i = 0; i < BLOCKS_PER_SECTOR; i++) {
         copy_block(scratch_sector + i * FILESYSTEM_BLOCK_SIZE,
-                   current_sector + i * FILESYSTEM_BLOCK_SIZE);
+                   line->sector + i * FILESYSTEM_BLOCK_SIZE);
     }
+    // The scratch sector is erased again before it is reused so nothing stays
+    // cached.
+    line->sector = NO_SECTOR_LOADED;
+    line->valid_mask = 0;
+    line->dirty = false;
     return true;
 }
 
-// Attempts to allocate a new set of page buffers for caching a full sector in
-// ram. Each page is allocated separately so that the GC doesn't need to provide
-// one huge block. We can free it as we write if we want to also.
+// Attempts to allocate a new set of page buffers for caching sectors in ram.
+// Outside the heap we take as many sectors as we can get, up to
+// CIRCUITPY_EXTERNAL_FLASH_CACHE_SECTORS. From the heap we only take a single
+// sector and each page is allocated separately so that the GC doesn't need to
+// provide one huge block. We can free it as we write if we want to also.
 static bool allocate_ram_cache(void) {
-    uint8_t blocks_per_sector = SPI_FLASH_ERASE_SIZE / FILESYSTEM_BLOCK_SIZE;
-    uint8_t pages_per_block = FILESYSTEM_BLOCK_SIZE / SPI_FLASH_PAGE_SIZE;
-
-    uint32_t table_size = blocks_per_sector * pages_per_block * sizeof(uint32_t);
     // Attempt to allocate outside the heap first.
-    supervisor_cache = allocate_memory(table_size + SPI_FLASH_ERASE_SIZE, false);
-    if (supervisor_cache != NULL) {
+    for (uint8_t count = CIRCUITPY_EXTERNAL_FLASH_CACHE_SECTORS; count > 0; count /= 2) {
+        uint32_t table_size = count * PAGES_PER_SECTOR * sizeof(uint8_t*);
+        supervisor_cache = allocate_memory(table_size + count * SPI_FLASH_ERASE_SIZE, false);
+        if (supervisor_cache == NULL) {
+            continue;
+        }
         MP_STATE_VM(flash_ram_cache) = (uint8_t **) supervisor_cache->ptr;
         uint8_t* page_start = (uint8_t *) supervisor_cache->ptr + table_size;
 
-        for (uint8_t i = 0; i < blocks_per_sector; i++) {
-            for (uint8_t j = 0; j < pages_per_block; j++) {
-                uint32_t offset = i * pages_per_block + j;
-                MP_STATE_VM(flash_ram_cache)[offset] = page_start + offset * SPI_FLASH_PAGE_SIZE;
-            }
+        for (uint32_t i = 0; i < count * PAGES_PER_SECTOR; i++) {
+            MP_STATE_VM(flash_ram_cache)[i] = page_start + i * SPI_FLASH_PAGE_SIZE;
         }
+        reset_cache_lines(count);
         return true;
     }
 
@@ -356,135 +484,160 @@ static bool allocate_ram_cache(void) {
         return false;
     }
 
-    MP_STATE_VM(flash_ram_cache) = m_malloc_maybe(blocks_per_sector * pages_per_block * sizeof(uint32_t), false);
+    MP_STATE_VM(flash_ram_cache) = m_malloc_maybe(PAGES_PER_SECTOR * sizeof(uint8_t*), false);
     if (MP_STATE_VM(flash_ram_cache) == NULL) {
         return false;
     }
-    // Declare i and j outside the loops in case we fail to allocate everything
-    // we need. In that case we'll give it back.
+    // Declare i outside the loop in case we fail to allocate everything we
+    // need. In that case we'll give it back.
     uint8_t i = 0;
-    uint8_t j = 0;
     bool success = true;
-    for (i = 0; i < blocks_per_sector; i++) {
-        for (j = 0; j < pages_per_block; j++) {
-            uint8_t *page_cache = m_malloc_maybe(SPI_FLASH_PAGE_SIZE, false);
-            if (page_cache == NULL) {
-                success = false;
-                break;
-            }
-            MP_STATE_VM(flash_ram_cache)[i * pages_per_block + j] = page_cache;
-        }
-        if (!success) {
+    for (i = 0; i < PAGES_PER_SECTOR; i++) {
+        uint8_t *page_cache = m_malloc_maybe(SPI_FLASH_PAGE_SIZE, false);
+        if (page_cache == NULL) {
+            success = false;
             break;
         }
+        MP_STATE_VM(flash_ram_cache)[i] = page_cache;
     }
     // We couldn't allocate enough so give back what we got.
     if (!success) {
-        // We add 1 so that we delete 0 when i is 1. Going to zero (i >= 0)
-        // would never stop because i is unsigned.
-        i++;
         for (; i > 0; i--) {
-            for (; j > 0; j--) {
-                m_free(MP_STATE_VM(flash_ram_cache)[(i - 1) * pages_per_block + (j - 1)]);
-            }
-            j = pages_per_block;
+            m_free(MP_STATE_VM(flash_ram_cache)[i - 1]);
         }
         m_free(MP_STATE_VM(flash_ram_cache));
         MP_STATE_VM(flash_ram_cache) = NULL;
+        return false;
     }
-    return success;
+    reset_cache_lines(1);
+    return true;
 }
 
 static void release_ram_cache(void) {
     if (supervisor_cache != NULL) {
         free_memory(supervisor_cache);
         supervisor_cache = NULL;
-    } else if (MP_STATE_MEM(gc_pool_start)) {
+    } else if (MP_STATE_MEM(gc_pool_start) && MP_STATE_VM(flash_ram_cache) != NULL) {
+        for (uint8_t i = 0; i < PAGES_PER_SECTOR; i++) {
+            m_free(MP_STATE_VM(flash_ram_cache)[i]);
+        }
         m_free(MP_STATE_VM(flash_ram_cache));
     }
     MP_STATE_VM(flash_ram_cache) = NULL;
+    reset_cache_lines(1);
 }
 
-// Flush the cached sector from ram onto the flash. We'll free the cache unless
-// keep_cache is true.
-static bool flush_ram_cache(bool keep_cache) {
-    if (current_sector == NO_SECTOR_LOADED) {
-        if (!keep_cache) {
-            release_ram_cache();
-        }
+static inline uint8_t* cache_page(uint8_t line_index, uint8_t block_index, uint8_t page) {
+    return MP_STATE_VM(flash_ram_cache)[line_index * PAGES_PER_SECTOR + block_index * PAGES_PER_BLOCK + page];
+}
+
+// Write one cached sector from ram back onto the flash. The whole sector is
+// left in the cache so later reads and writes to it don't go to the flash.
+static bool flush_ram_line(uint8_t line_index) {
+    cache_line_t *line = &cache_lines[line_index];
+    if (line->sector == NO_SECTOR_LOADED || !line->dirty) {
         return true;
     }
     // First, copy out any blocks that we haven't touched from the sector
     // we've cached. If we don't do this we'll erase the data during the sector
     // erase below.
-    bool copy_to_ram_ok = true;
-    uint8_t pages_per_block = FILESYSTEM_BLOCK_SIZE / SPI_FLASH_PAGE_SIZE;
-    for (uint8_t i = 0; i < SPI_FLASH_ERASE_SIZE / FILESYSTEM_BLOCK_SIZE; i++) {
-        if ((dirty_mask & (1 << i)) == 0) {
-            for (uint8_t j = 0; j < pages_per_block; j++) {
-                copy_to_ram_ok = read_flash(
-                    current_sector + (i * pages_per_block + j) * SPI_FLASH_PAGE_SIZE,
-                    MP_STATE_VM(flash_ram_cache)[i * pages_per_block + j],
-                    SPI_FLASH_PAGE_SIZE);
-                if (!copy_to_ram_ok) {
-                    break;
-                }
-            }
+    for (uint8_t i = 0; i < BLOCKS_PER_SECTOR; i++) {
+        if ((line->valid_mask & (1 << i)) != 0) {
+            continue;
         }
-        if (!copy_to_ram_ok) {
-            break;
+        for (uint8_t j = 0; j < PAGES_PER_BLOCK; j++) {
+            if (!read_flash(line->sector + (i * PAGES_PER_BLOCK + j) * SPI_FLASH_PAGE_SIZE,
+                            cache_page(line_index, i, j),
+                            SPI_FLASH_PAGE_SIZE)) {
+                return false;
+            }
         }
-    }
-
-    if (!copy_to_ram_ok) {
-        return false;
+        line->valid_mask |= 1 << i;
     }
     // Second, erase the current sector.
-    erase_sector(current_sector);
+    erase_sector(line->sector);
     // Lastly, write all the data in ram that we've cached.
-    for (uint8_t i = 0; i < SPI_FLASH_ERASE_SIZE / FILESYSTEM_BLOCK_SIZE; i++) {
-        for (uint8_t j = 0; j < pages_per_block; j++) {
-            write_flash(current_sector + (i * pages_per_block + j) * SPI_FLASH_PAGE_SIZE,
-                        MP_STATE_VM(flash_ram_cache)[i * pages_per_block + j],
+    for (uint8_t i = 0; i < BLOCKS_PER_SECTOR; i++) {
+        for (uint8_t j = 0; j < PAGES_PER_BLOCK; j++) {
+            write_flash(line->sector + (i * PAGES_PER_BLOCK + j) * SPI_FLASH_PAGE_SIZE,
+                        cache_page(line_index, i, j),
                         SPI_FLASH_PAGE_SIZE);
-            if (!keep_cache && supervisor_cache == NULL && MP_STATE_MEM(gc_pool_start)) {
-                m_free(MP_STATE_VM(flash_ram_cache)[i * pages_per_block + j]);
-            }
         }
     }
-    // We're done with the cache for now so give it back.
-    if (!keep_cache) {
-        release_ram_cache();
-    }
+    line->dirty = false;
     return true;
 }
 
-// Delegates to the correct flash flush method depending on the existing cache.
-// TODO Don't blink the status indicator if we don't actually do any writing (hard to tell right now).
-static void spi_flash_flush_keep_cache(bool keep_cache) {
-    #ifdef MICROPY_HW_LED_MSC
-        port_pin_set_output_level(MICROPY_HW_LED_MSC, true);
-    #endif
-    temp_status_color(ACTIVE_WRITE);
+static bool cache_is_dirty(void) {
+    for (uint8_t i = 0; i < cache_line_count; i++) {
+        if (cache_lines[i].dirty) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Flush the lines selected by only_idle, or all of them. Returns true if the
+// whole cache is clean afterwards.
+static bool flush_cache_lines(bool only_idle) {
     // If we've cached to the flash itself flush from there.
     if (MP_STATE_VM(flash_ram_cache) == NULL) {
         flush_scratch_flash();
-    } else {
-        flush_ram_cache(keep_cache);
+        return true;
     }
-    current_sector = NO_SECTOR_LOADED;
-    clear_temp_status();
-    #ifdef MICROPY_HW_LED_MSC
-        port_pin_set_output_level(MICROPY_HW_LED_MSC, false);
-    #endif
+    bool clean = true;
+    for (uint8_t i = 0; i < cache_line_count; i++) {
+        cache_line_t *line = &cache_lines[i];
+        if (!line->dirty) {
+            continue;
+        }
+        // A line that is still being written is left alone unless it has been
+        // dirty for too long.
+        if (only_idle && line->last_write_pass == flush_pass &&
+            (uint16_t)(flush_pass - line->dirty_pass) < CIRCUITPY_EXTERNAL_FLASH_CACHE_MAX_AGE) {
+            clean = false;
+            continue;
+        }
+        if (!flush_ram_line(i)) {
+            clean = false;
+        }
+    }
+    return clean;
+}
+
+// Delegates to the correct flash flush method depending on the existing cache.
+static bool spi_flash_flush_keep_cache(bool keep_cache, bool only_idle) {
+    bool clean = true;
+    if (cache_is_dirty()) {
+        #ifdef MICROPY_HW_LED_MSC
+            port_pin_set_output_level(MICROPY_HW_LED_MSC, true);
+        #endif
+        temp_status_color(ACTIVE_WRITE);
+        clean = flush_cache_lines(only_idle);
+        clear_temp_status();
+        #ifdef MICROPY_HW_LED_MSC
+            port_pin_set_output_level(MICROPY_HW_LED_MSC, false);
+        #endif
+    }
+    // We're done with the cache for now so give it back.
+    if (!keep_cache) {
+        release_ram_cache();
+    }
+    return clean;
 }
 
 void supervisor_external_flash_flush(void) {
-    spi_flash_flush_keep_cache(true);
+    spi_flash_flush_keep_cache(true, false);
+}
+
+bool supervisor_external_flash_flush_idle(void) {
+    bool clean = spi_flash_flush_keep_cache(true, true);
+    flush_pass++;
+    return clean;
 }
 
 void supervisor_flash_release_cache(void) {
-    spi_flash_flush_keep_cache(false);
+    spi_flash_flush_keep_cache(false, false);
 }
 
 static int32_t convert_block_to_flash_addr(uint32_t block) {
@@ -496,6 +649,58 @@ static int32_t convert_block_to_flash_addr(uint32_t block) {
     return -1;
 }
 
+// Find the line caching the given sector. Sectors map onto a set of
+// cache_ways lines so only those are searched.
+static int find_cache_line(uint32_t sector) {
+    if (MP_STATE_VM(flash_ram_cache) == NULL) {
+        return cache_lines[0].sector == sector ? 0 : -1;
+    }
+    uint8_t set_count = cache_line_count / cache_ways;
+    uint8_t first = (sector / SPI_FLASH_ERASE_SIZE) % set_count * cache_ways;
+    for (uint8_t i = first; i < first + cache_ways; i++) {
+        if (cache_lines[i].sector == sector) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+// Pick a line to cache the given sector in, writing back the least recently
+// used line of its set if they are all taken.
+static int load_cache_line(uint32_t sector) {
+    if (MP_STATE_VM(flash_ram_cache) == NULL) {
+        if (cache_lines[0].sector != NO_SECTOR_LOADED) {
+            flush_scratch_flash();
+        }
+        if (!allocate_ram_cache()) {
+            erase_sector(flash_device->total_size - SPI_FLASH_ERASE_SIZE);
+            wait_for_flash_ready();
+            cache_lines[0].sector = sector;
+            return 0;
+        }
+    }
+    uint8_t set_count = cache_line_count / cache_ways;
+    uint8_t first = (sector / SPI_FLASH_ERASE_SIZE) % set_count * cache_ways;
+    int line_index = first;
+    for (uint8_t i = first; i < first + cache_ways; i++) {
+        if (cache_lines[i].sector == NO_SECTOR_LOADED) {
+            line_index = i;
+            break;
+        }
+        if (cache_lines[i].last_used < cache_lines[line_index].last_used) {
+            line_index = i;
+        }
+    }
+    if (!flush_ram_line(line_index)) {
+        return -1;
+    }
+    cache_line_t *line = &cache_lines[line_index];
+    line->sector = sector;
+    line->valid_mask = 0;
+    line->dirty = false;
+    return line_index;
+}
+
 bool external_flash_read_block(uint8_t *dest, uint32_t block) {
     int32_t address = convert_block_to_flash_addr(block);
     if (address == -1) {
@@ -505,15 +710,15 @@ bool external_flash_read_block(uint8_t *dest, uint32_t block) {
 
     // Mask out the lower bits that designate the address within the sector.
     uint32_t this_sector = address & (~(SPI_FLASH_ERASE_SIZE - 1));
-    uint8_t block_index = (address / FILESYSTEM_BLOCK_SIZE) % (SPI_FLASH_ERASE_SIZE / FILESYSTEM_BLOCK_SIZE);
-    uint8_t mask = 1 << (block_index);
-    // We're reading from the currently cached sector.
-    if (current_sector == this_sector && (mask & dirty_mask) > 0) {
+    uint8_t block_index = (address / FILESYSTEM_BLOCK_SIZE) % BLOCKS_PER_SECTOR;
+    uint32_t mask = 1 << (block_index);
+    int line_index = find_cache_line(this_sector);
+    // We're reading from a cached sector.
+    if (line_index >= 0 && (mask & cache_lines[line_index].valid_mask) > 0) {
         if (MP_STATE_VM(flash_ram_cache) != NULL) {
-            uint8_t pages_per_block = FILESYSTEM_BLOCK_SIZE / SPI_FLASH_PAGE_SIZE;
-            for (int i = 0; i < pages_per_block; i++) {
+            for (int i = 0; i < PAGES_PER_BLOCK; i++) {
                 memcpy(dest + i * SPI_FLASH_PAGE_SIZE,
-                       MP_STATE_VM(flash_ram_cache)[block_index * pages_per_block + i],
+                       cache_page(line_index, block_index, i),
                        SPI_FLASH_PAGE_SIZE);
             }
             return true;
@@ -536,32 +741,51 @@ bool external_flash_write_block(const uint8_t *data, uint32_t block) {
     wait_for_flash_ready();
     // Mask out the lower bits that designate the address within the sector.
     uint32_t this_sector = address & (~(SPI_FLASH_ERASE_SIZE - 1));
-    uint8_t block_index = (address / FILESYSTEM_BLOCK_SIZE) % (SPI_FLASH_ERASE_SIZE / FILESYSTEM_BLOCK_SIZE);
-    uint8_t mask = 1 << (block_index);
-    // Flush the cache if we're moving onto a sector or we're writing the
-    // same block again.
-    if (current_sector != this_sector || (mask & dirty_mask) > 0) {
-        // Check to see if we'd write to an erased page. In that case we
-        // can write directly.
-        if (page_erased(address)) {
-            return write_flash(address, data, FILESYSTEM_BLOCK_SIZE);
-        }
-        if (current_sector != NO_SECTOR_LOADED) {
-            supervisor_flash_flush();
-        }
-        if (MP_STATE_VM(flash_ram_cache) == NULL && !allocate_ram_cache()) {
-            erase_sector(flash_device->total_size - SPI_FLASH_ERASE_SIZE);
-            wait_for_flash_ready();
+    uint8_t block_index = (address / FILESYSTEM_BLOCK_SIZE) % BLOCKS_PER_SECTOR;
+    uint32_t mask = 1 << (block_index);
+    int line_index = find_cache_line(this_sector);
+    bool cached = line_index >= 0 && (mask & cache_lines[line_index].valid_mask) > 0;
+    bool in_ram = MP_STATE_VM(flash_ram_cache) != NULL;
+    // Write directly to the flash if we can do so without an erase. A sector
+    // being flushed rereads the blocks it doesn't hold so this is fine for
+    // blocks that aren't cached. A cached block is only skipped over when it
+    // sits in a clean ram line, whose copy we update too. Dirty lines are
+    // erased on flush anyway.
+    if ((!cached || (in_ram && !cache_lines[line_index].dirty)) &&
+        write_block_in_place(address, data)) {
+        if (cached) {
+            for (int i = 0; i < PAGES_PER_BLOCK; i++) {
+                memcpy(cache_page(line_index, block_index, i),
+                       data + i * SPI_FLASH_PAGE_SIZE,
+                       SPI_FLASH_PAGE_SIZE);
+            }
         }
-        current_sector = this_sector;
-        dirty_mask = 0;
+        return true;
+    }
+    // The scratch sector can't be rewritten in place so flush it if we're
+    // writing the same block again.
+    if (cached && !in_ram) {
+        flush_scratch_flash();
+        line_index = -1;
     }
-    dirty_mask |= mask;
+    if (line_index < 0) {
+        line_index = load_cache_line(this_sector);
+        if (line_index < 0) {
+            return false;
+        }
+    }
+    cache_line_t *line = &cache_lines[line_index];
+    if (!line->dirty) {
+        line->dirty = true;
+        line->dirty_pass = flush_pass;
+    }
+    line->valid_mask |= mask;
+    line->last_used = ++cache_use_count;
+    line->last_write_pass = flush_pass;
     // Copy the block to the appropriate cache.
     if (MP_STATE_VM(flash_ram_cache) != NULL) {
-        uint8_t pages_per_block = FILESYSTEM_BLOCK_SIZE / SPI_FLASH_PAGE_SIZE;
-        for (int i = 0; i < pages_per_block; i++) {
-            memcpy(MP_STATE_VM(flash_ram_cache)[block_index * pages_per_block + i],
+        for (int i = 0; i < PAGES_PER_BLOCK; i++) {
+            memcpy(cache_page(line_index, block_index, i),
                    data + i * SPI_FLASH_PAGE_SIZE,
                    SPI_FLASH_PAGE_SIZE);
         }
@@ -573,19 +797,33 @@ bool external_flash_write_block(const uint8_t *data, uint32_t block) {
 }
 
 mp_uint_t supervisor_flash_read_blocks(uint8_t *dest, uint32_t block_num, uint32_t num_blocks) {
+    #if CIRCUITPY_EXTERNAL_FLASH_FTL
+    if (!ftl_mounted || !flash_ftl_read_blocks(&ftl, dest, block_num, num_blocks)) {
+        return 1; // error
+    }
+    #else
     for (size_t i = 0; i < num_blocks; i++) {
         if (!external_flash_read_block(dest + i * FILESYSTEM_BLOCK_SIZE, block_num + i)) {
             return 1; // error
         }
     }
+    #endif
     return 0; // success
 }
 
 mp_uint_t supervisor_flash_write_blocks(const uint8_t *src, uint32_t block_num, uint32_t num_blocks) {
+    #if CIRCUITPY_EXTERNAL_FLASH_FTL
+    // Blocks go straight to the flash so there is nothing for the cache to
+    // flush.
+    if (!ftl_mounted || !flash_ftl_write_blocks(&ftl, src, block_num, num_blocks)) {
+        return 1; // error
+    }
+    #else
     for (size_t i = 0; i < num_blocks; i++) {
         if (!external_flash_write_block(src + i * FILESYSTEM_BLOCK_SIZE, block_num + i)) {
             return 1; // error
         }
     }
+    #endif
     return 0; // success
 }
@@ -45,6 +45,31 @@
 #define SPI_FLASH_MAX_BAUDRATE 8000000
 #endif
 
+// Number of erase sectors cached in ram when memory outside the heap allows,
+// grouped into sets of CIRCUITPY_EXTERNAL_FLASH_CACHE_WAYS sectors.
+#ifndef CIRCUITPY_EXTERNAL_FLASH_CACHE_SECTORS
+#define CIRCUITPY_EXTERNAL_FLASH_CACHE_SECTORS (4)
+#endif
+
+#ifndef CIRCUITPY_EXTERNAL_FLASH_CACHE_WAYS
+#define CIRCUITPY_EXTERNAL_FLASH_CACHE_WAYS (4)
+#endif
+
+// Number of background flushes a sector that is still being written may stay
+// dirty in the cache for.
+#ifndef CIRCUITPY_EXTERNAL_FLASH_CACHE_MAX_AGE
+#define CIRCUITPY_EXTERNAL_FLASH_CACHE_MAX_AGE (4)
+#endif
+
+// Put the log structured FTL in flash_ftl.h between the filesystem and the
+// flash. Flash formatted without it needs to be reformatted.
+#ifndef CIRCUITPY_EXTERNAL_FLASH_FTL
+#define CIRCUITPY_EXTERNAL_FLASH_FTL (0)
+#endif
+
 void supervisor_external_flash_flush(void);
+// Flush the cached sectors that haven't been written since the previous call.
+// Returns true if nothing is left to flush.
+bool supervisor_external_flash_flush_idle(void);
 
 #endif  // MICROPY_INCLUDED_SUPERVISOR_SHARED_EXTERNAL_FLASH_EXTERNAL_FLASH_H
@@ -0,0 +1,550 @@
+
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2020 MicroPython & CircuitPython contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "supervisor/shared/external_flash/flash_ftl.h"
+
+#include <string.h>
+
+#define FTL_MAGIC (0x314c5446)
+
+#define NO_SLOT (0xffff)
+#define NO_SECTOR (0xffff)
+
+// Each entry of the sector header holds a logical block number in the low 24
+// bits and flags in the top byte.
+#define ENTRY_ERASED (0xffffffff)
+#define ENTRY_BLOCK(entry) ((entry) & 0x00ffffff)
+#define ENTRY_FLAGS(entry) ((entry) >> 24)
+#define ENTRY_COMMIT (0x00)
+#define ENTRY_PENDING (0x80)
+
+#define HEADER_WORDS (3)
+
+enum {
+    // No live data. The sector is erased before it is used again.
+    SECTOR_FREE,
+    SECTOR_USED,
+    SECTOR_ACTIVE,
+};
+
+typedef struct {
+    uint32_t magic;
+    uint32_t erase_count;
+    uint32_t seq;
+    uint32_t entries[FLASH_FTL_MAX_SLOTS];
+} ftl_header_t;
+
+static uint32_t sector_address(flash_ftl_t *ftl, uint16_t sector) {
+    return sector * ftl->sector_size;
+}
+
+static uint32_t slot_address(flash_ftl_t *ftl, uint16_t slot) {
+    return sector_address(ftl, slot / ftl->slots_per_sector) +
+           (slot % ftl->slots_per_sector + 1) * FLASH_FTL_BLOCK_SIZE;
+}
+
+static bool read_header(flash_ftl_t *ftl, uint16_t sector, ftl_header_t *header) {
+    return ftl->driver->read(ftl->driver->ctx, sector_address(ftl, sector), (uint8_t *)header,
+        (HEADER_WORDS + ftl->slots_per_sector) * sizeof(uint32_t));
+}
+
+// Whether slot a was written after slot b.
+static bool slot_newer(flash_ftl_t *ftl, uint16_t a, uint16_t b) {
+    uint32_t seq_a = ftl->sectors[a / ftl->slots_per_sector].seq;
+    uint32_t seq_b = ftl->sectors[b / ftl->slots_per_sector].seq;
+    if (seq_a != seq_b) {
+        return (int32_t)(seq_a - seq_b) > 0;
+    }
+    return a > b;
+}
+
+static void add_live(flash_ftl_t *ftl, uint16_t sector) {
+    flash_ftl_sector_t *s = &ftl->sectors[sector];
+    if (s->state == SECTOR_FREE) {
+        s->state = SECTOR_USED;
+        ftl->free_count--;
+    }
+    s->live++;
+}
+
+static void remove_live(flash_ftl_t *ftl, uint16_t sector) {
+    flash_ftl_sector_t *s = &ftl->sectors[sector];
+    s->live--;
+    if (s->live == 0 && s->state == SECTOR_USED) {
+        s->state = SECTOR_FREE;
+        ftl->free_count++;
+    }
+}
+
+static void set_mapping(flash_ftl_t *ftl, uint32_t block, uint16_t slot) {
+    uint16_t old = ftl->map[block];
+    if (old != NO_SLOT) {
+        remove_live(ftl, old / ftl->slots_per_sector);
+    }
+    ftl->map[block] = slot;
+    add_live(ftl, slot / ftl->slots_per_sector);
+}
+
+static uint32_t entry_address(flash_ftl_t *ftl, uint16_t slot) {
+    return sector_address(ftl, slot / ftl->slots_per_sector) +
+           (HEADER_WORDS + slot % ftl->slots_per_sector) * sizeof(uint32_t);
+}
+
+// Mark a pending slot as committed. Only clears bits so the entry can be
+// programmed again in place.
+static bool commit_slot(flash_ftl_t *ftl, uint16_t slot, uint32_t block) {
+    uint32_t entry = (ENTRY_COMMIT << 24) | block;
+    return ftl->driver->program(ftl->driver->ctx, entry_address(ftl, slot), (const uint8_t *)&entry, sizeof(entry));
+}
+
+void flash_ftl_init(flash_ftl_t *ftl, const flash_ftl_driver_t *driver,
+    uint32_t sector_size, uint16_t sector_count, flash_ftl_sector_t *sectors, uint16_t *map) {
+    ftl->driver = driver;
+    ftl->sectors = sectors;
+    ftl->map = map;
+    ftl->sector_size = sector_size;
+    ftl->sector_count = sector_count;
+    ftl->slots_per_sector = FLASH_FTL_SLOTS_PER_SECTOR(sector_size);
+    ftl->block_count = FLASH_FTL_BLOCK_COUNT(sector_size, sector_count);
+    ftl->active = NO_SECTOR;
+    ftl->next_slot = ftl->slots_per_sector;
+    ftl->free_count = 0;
+    ftl->next_seq = 1;
+}
+
+// Whether the write that runs off the end of a sector was finished in the
+// sector written after it.
+static bool write_continues(flash_ftl_t *ftl, uint32_t seq) {
+    for (uint16_t s = 0; s < ftl->sector_count; s++) {
+        if (ftl->sectors[s].state != SECTOR_USED || ftl->sectors[s].seq != seq) {
+            continue;
+        }
+        ftl_header_t header;
+        if (!read_header(ftl, s, &header)) {
+            return false;
+        }
+        for (uint8_t i = 0; i < ftl->slots_per_sector; i++) {
+            if (header.entries[i] == ENTRY_ERASED) {
+                return false;
+            }
+            if (ENTRY_FLAGS(header.entries[i]) == ENTRY_COMMIT) {
+                return true;
+            }
+        }
+        return false;
+    }
+    return false;
+}
+
+static void mount_slots(flash_ftl_t *ftl, uint16_t sector, ftl_header_t *header, uint8_t start, uint8_t end) {
+    for (uint8_t i = start; i < end; i++) {
+        uint32_t block = ENTRY_BLOCK(header->entries[i]);
+        if (block >= ftl->block_count) {
+            continue;
+        }
+        uint16_t slot = sector * ftl->slots_per_sector + i;
+        if (ftl->map[block] == NO_SLOT || slot_newer(ftl, slot, ftl->map[block])) {
+            ftl->map[block] = slot;
+        }
+    }
+}
+
+// Carry on appending to the newest sector after mounting, past any slot that
+// may have been partly programmed.
+static bool resume_sector(flash_ftl_t *ftl, uint16_t sector, ftl_header_t *header) {
+    uint8_t data[FLASH_FTL_BLOCK_SIZE];
+    uint32_t seq = ftl->sectors[sector].seq;
+    if (!read_header(ftl, sector, header)) {
+        return false;
+    }
+    uint8_t next = ftl->slots_per_sector;
+    while (next > 0 && header->entries[next - 1] == ENTRY_ERASED) {
+        next--;
+    }
+    ftl->next_seq = seq + 1;
+    if (next > 0 && ENTRY_FLAGS(header->entries[next - 1]) != ENTRY_COMMIT) {
+        // An interrupted write. Leave an erased entry after it so the next
+        // write doesn't look like its end. When there is no room for that,
+        // skip a sequence number so the next sector doesn't look like it
+        // either.
+        if (next == ftl->slots_per_sector) {
+            ftl->next_seq = seq + 2;
+        }
+        next++;
+    } else if (next == 0) {
+        // The write that opened the sector may have been interrupted in the
+        // previous one.
+        next++;
+    }
+    for (; next < ftl->slots_per_sector; next++) {
+        uint16_t slot = sector * ftl->slots_per_sector + next;
+        if (!ftl->driver->read(ftl->driver->ctx, slot_address(ftl, slot), data, FLASH_FTL_BLOCK_SIZE)) {
+            return false;
+        }
+        bool erased = true;
+        for (uint16_t i = 0; i < FLASH_FTL_BLOCK_SIZE; i++) {
+            if (data[i] != 0xff) {
+                erased = false;
+                break;
+            }
+        }
+        if (erased) {
+            ftl->sectors[sector].state = SECTOR_ACTIVE;
+            ftl->active = sector;
+            ftl->next_slot = next;
+            return true;
+        }
+    }
+    return true;
+}
+
+bool flash_ftl_mount(flash_ftl_t *ftl) {
+    ftl_header_t header;
+    uint32_t max_seq = 0;
+    uint16_t newest = NO_SECTOR;
+    uint32_t erase_total = 0;
+    uint16_t formatted_count = 0;
+
+    for (uint32_t b = 0; b < ftl->block_count; b++) {
+        ftl->map[b] = NO_SLOT;
+    }
+    for (uint16_t s = 0; s < ftl->sector_count; s++) {
+        flash_ftl_sector_t *sector = &ftl->sectors[s];
+        if (!read_header(ftl, s, &header)) {
+            return false;
+        }
+        sector->live = 0;
+        if (header.magic != FTL_MAGIC) {
+            // Unformatted, or its erase count was lost with power during an
+            // erase. Guessed below.
+            sector->state = SECTOR_FREE;
+            sector->erase_count = 0xffff;
+            sector->seq = 0;
+            continue;
+        }
+        sector->state = SECTOR_USED;
+        sector->erase_count = header.erase_count >= 0xffff ? 0xfffe : header.erase_count;
+        sector->seq = header.seq;
+        erase_total += sector->erase_count;
+        formatted_count++;
+        if (newest == NO_SECTOR || (int32_t)(header.seq - max_seq) > 0) {
+            max_seq = header.seq;
+            newest = s;
+        }
+    }
+
+    for (uint16_t s = 0; s < ftl->sector_count; s++) {
+        if (ftl->sectors[s].erase_count == 0xffff) {
+            ftl->sectors[s].erase_count = formatted_count > 0 ? erase_total / formatted_count : 0;
+        }
+    }
+
+    // Replay every write that made it onto the flash completely.
+    for (uint16_t s = 0; s < ftl->sector_count; s++) {
+        if (ftl->sectors[s].state != SECTOR_USED) {
+            continue;
+        }
+        if (!read_header(ftl, s, &header)) {
+            return false;
+        }
+        uint8_t start = 0;
+        for (uint8_t i = 0; i < ftl->slots_per_sector; i++) {
+            uint32_t entry = header.entries[i];
+            if (entry == ENTRY_ERASED) {
+                // Unused or interrupted slot. Anything pending before it was
+                // never committed.
+                start = i + 1;
+            } else if (ENTRY_FLAGS(entry) == ENTRY_COMMIT) {
+                mount_slots(ftl, s, &header, start, i + 1);
+                start = i + 1;
+            }
+        }
+        if (start < ftl->slots_per_sector && write_continues(ftl, ftl->sectors[s].seq + 1)) {
+            mount_slots(ftl, s, &header, start, ftl->slots_per_sector);
+            // The next sector may be reused once its blocks are superseded so
+            // record the commit here too, as the write would have done.
+            for (uint8_t i = start; i < ftl->slots_per_sector; i++) {
+                if (!commit_slot(ftl, s * ftl->slots_per_sector + i, ENTRY_BLOCK(header.entries[i]))) {
+                    return false;
+                }
+            }
+        }
+    }
+
+    for (uint32_t b = 0; b < ftl->block_count; b++) {
+        if (ftl->map[b] != NO_SLOT) {
+            ftl->sectors[ftl->map[b] / ftl->slots_per_sector].live++;
+        }
+    }
+    ftl->active = NO_SECTOR;
+    ftl->next_slot = ftl->slots_per_sector;
+    ftl->next_seq = 1;
+    if (newest != NO_SECTOR && !resume_sector(ftl, newest, &header)) {
+        return false;
+    }
+    ftl->free_count = 0;
+    for (uint16_t s = 0; s < ftl->sector_count; s++) {
+        flash_ftl_sector_t *sector = &ftl->sectors[s];
+        if (sector->live == 0 && sector->state == SECTOR_USED) {
+            sector->state = SECTOR_FREE;
+        }
+        if (sector->state == SECTOR_FREE) {
+            ftl->free_count++;
+        }
+    }
+    return true;
+}
+
+static void close_active(flash_ftl_t *ftl) {
+    if (ftl->active == NO_SECTOR) {
+        return;
+    }
+    flash_ftl_sector_t *sector = &ftl->sectors[ftl->active];
+    if (sector->live == 0) {
+        sector->state = SECTOR_FREE;
+        ftl->free_count++;
+    } else {
+        sector->state = SECTOR_USED;
+    }
+    ftl->active = NO_SECTOR;
+    ftl->next_slot = ftl->slots_per_sector;
+}
+
+// Erase the least worn free sector and start writing to it.
+static bool open_sector(flash_ftl_t *ftl) {
+    uint16_t best = NO_SECTOR;
+    for (uint16_t s = 0; s < ftl->sector_count; s++) {
+        if (ftl->sectors[s].state == SECTOR_FREE &&
+            (best == NO_SECTOR || ftl->sectors[s].erase_count < ftl->sectors[best].erase_count)) {
+            best = s;
+        }
+    }
+    if (best == NO_SECTOR) {
+        return false;
+    }
+    close_active(ftl);
+    flash_ftl_sector_t *sector = &ftl->sectors[best];
+    if (!ftl->driver->erase(ftl->driver->ctx, sector_address(ftl, best))) {
+        return false;
+    }
+    if (sector->erase_count < 0xffff) {
+        sector->erase_count++;
+    }
+    uint32_t header[HEADER_WORDS] = {FTL_MAGIC, sector->erase_count, ftl->next_seq};
+    if (!ftl->driver->program(ftl->driver->ctx, sector_address(ftl, best), (const uint8_t *)header, sizeof(header))) {
+        return false;
+    }
+    sector->seq = ftl->next_seq++;
+    sector->state = SECTOR_ACTIVE;
+    sector->live = 0;
+    ftl->free_count--;
+    ftl->active = best;
+    ftl->next_slot = 0;
+    return true;
+}
+
+// Append one block to the active sector. The slot isn't mapped yet.
+static bool write_slot(flash_ftl_t *ftl, uint32_t block, const uint8_t *data, uint32_t flags, uint16_t *slot_out) {
+    if (ftl->next_slot >= ftl->slots_per_sector && !open_sector(ftl)) {
+        return false;
+    }
+    uint8_t index = ftl->next_slot;
+    uint16_t slot = ftl->active * ftl->slots_per_sector + index;
+    // Use up the slot even if programming fails so it isn't programmed twice.
+    ftl->next_slot++;
+    if (!ftl->driver->program(ftl->driver->ctx, slot_address(ftl, slot), data, FLASH_FTL_BLOCK_SIZE)) {
+        return false;
+    }
+    uint32_t entry = (flags << 24) | block;
+    if (!ftl->driver->program(ftl->driver->ctx, entry_address(ftl, slot), (const uint8_t *)&entry, sizeof(entry))) {
+        return false;
+    }
+    *slot_out = slot;
+    return true;
+}
+
+// Move the live blocks out of the given sector, which frees it.
+static bool relocate_sector(flash_ftl_t *ftl, uint16_t sector) {
+    ftl_header_t header;
+    uint8_t data[FLASH_FTL_BLOCK_SIZE];
+    if (!read_header(ftl, sector, &header)) {
+        return false;
+    }
+    for (uint8_t i = 0; i < ftl->slots_per_sector; i++) {
+        uint32_t block = ENTRY_BLOCK(header.entries[i]);
+        uint16_t slot = sector * ftl->slots_per_sector + i;
+        if (header.entries[i] == ENTRY_ERASED || block >= ftl->block_count || ftl->map[block] != slot) {
+            continue;
+        }
+        uint16_t new_slot;
+        if (!ftl->driver->read(ftl->driver->ctx, slot_address(ftl, slot), data, FLASH_FTL_BLOCK_SIZE) ||
+            !write_slot(ftl, block, data, ENTRY_COMMIT, &new_slot)) {
+            return false;
+        }
+        set_mapping(ftl, block, new_slot);
+    }
+    return true;
+}
+
+// Slots that can be written before garbage collection has to run.
+static uint32_t free_slots(flash_ftl_t *ftl) {
+    uint32_t room = ftl->active == NO_SECTOR ? 0 : ftl->slots_per_sector - ftl->next_slot;
+    return room + ftl->free_count * ftl->slots_per_sector;
+}
+
+// Make at least count slots free by moving live blocks out of the sectors
+// with the fewest of them. Every move frees more slots than it uses because
+// the spare sectors guarantee some sector has a superseded block.
+static bool collect_garbage(flash_ftl_t *ftl, uint32_t count) {
+    while (free_slots(ftl) < count) {
+        uint16_t victim = NO_SECTOR;
+        for (uint16_t s = 0; s < ftl->sector_count; s++) {
+            flash_ftl_sector_t *sector = &ftl->sectors[s];
+            if (sector->state != SECTOR_USED) {
+                continue;
+            }
+            if (victim == NO_SECTOR || sector->live < ftl->sectors[victim].live ||
+                (sector->live == ftl->sectors[victim].live &&
+                 sector->erase_count < ftl->sectors[victim].erase_count)) {
+                victim = s;
+            }
+        }
+        if (victim == NO_SECTOR || ftl->sectors[victim].live >= ftl->slots_per_sector ||
+            ftl->sectors[victim].live > free_slots(ftl) || !relocate_sector(ftl, victim)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void flash_ftl_erase_count_range(flash_ftl_t *ftl, uint16_t *min_count, uint16_t *max_count) {
+    *min_count = 0xffff;
+    *max_count = 0;
+    for (uint16_t s = 0; s < ftl->sector_count; s++) {
+        uint16_t count = ftl->sectors[s].erase_count;
+        if (count < *min_count) {
+            *min_count = count;
+        }
+        if (count > *max_count) {
+            *max_count = count;
+        }
+    }
+}
+
+// Static wear leveling. Sectors holding data that never changes are never
+// erased, so once the spread of erase counts gets too large the data in the
+// least erased sector is moved out of the way.
+static bool level_wear(flash_ftl_t *ftl) {
+    uint16_t coldest = NO_SECTOR;
+    uint16_t max_count = 0;
+    for (uint16_t s = 0; s < ftl->sector_count; s++) {
+        flash_ftl_sector_t *sector = &ftl->sectors[s];
+        if (sector->erase_count > max_count) {
+            max_count = sector->erase_count;
+        }
+        if (sector->state == SECTOR_USED &&
+            (coldest == NO_SECTOR || sector->erase_count < ftl->sectors[coldest].erase_count)) {
+            coldest = s;
+        }
+    }
+    if (coldest == NO_SECTOR || max_count - ftl->sectors[coldest].erase_count <= FLASH_FTL_WEAR_LEVEL_THRESHOLD) {
+        return true;
+    }
+    // Keep the usual margin of free slots once the data has moved.
+    if (!collect_garbage(ftl, ftl->sectors[coldest].live + ftl->slots_per_sector)) {
+        return false;
+    }
+    return ftl->sectors[coldest].state != SECTOR_USED || relocate_sector(ftl, coldest);
+}
+
+// Write up to a sector's worth of blocks so that either all or none of them
+// are seen after a power loss.
+static bool write_transaction(flash_ftl_t *ftl, const uint8_t *src, uint32_t block_num, uint8_t num_blocks) {
+    uint16_t slots[FLASH_FTL_MAX_SLOTS] = {0};
+    uint16_t active = ftl->active;
+    // Garbage collection can't run halfway through, so make room for the
+    // whole write first. Keep a sector's worth of slots free on top so that
+    // collection can always finish moving a sector, even after a power loss.
+    if (!collect_garbage(ftl, num_blocks + ftl->slots_per_sector)) {
+        return false;
+    }
+    for (uint8_t i = 0; i < num_blocks; i++) {
+        uint32_t flags = i == num_blocks - 1 ? ENTRY_COMMIT : ENTRY_PENDING;
+        if (!write_slot(ftl, block_num + i, src + i * FLASH_FTL_BLOCK_SIZE, flags, &slots[i])) {
+            return false;
+        }
+    }
+    // Slots left pending at the end of the previous sector are committed by
+    // the last slot, but that sector may outlive the one holding it.
+    uint16_t last_sector = slots[num_blocks - 1] / ftl->slots_per_sector;
+    for (uint8_t i = 0; i < num_blocks - 1; i++) {
+        if (slots[i] / ftl->slots_per_sector != last_sector &&
+            !commit_slot(ftl, slots[i], block_num + i)) {
+            return false;
+        }
+    }
+    for (uint8_t i = 0; i < num_blocks; i++) {
+        set_mapping(ftl, block_num + i, slots[i]);
+    }
+    if (ftl->active != active) {
+        return level_wear(ftl);
+    }
+    return true;
+}
+
+bool flash_ftl_read_blocks(flash_ftl_t *ftl, uint8_t *dest, uint32_t block_num, uint32_t num_blocks) {
+    if (block_num + num_blocks > ftl->block_count) {
+        return false;
+    }
+    for (uint32_t i = 0; i < num_blocks; i++) {
+        uint16_t slot = ftl->map[block_num + i];
+        uint8_t *block = dest + i * FLASH_FTL_BLOCK_SIZE;
+        if (slot == NO_SLOT) {
+            // Never written, read back as erased.
+            memset(block, 0xff, FLASH_FTL_BLOCK_SIZE);
+        } else if (!ftl->driver->read(ftl->driver->ctx, slot_address(ftl, slot), block, FLASH_FTL_BLOCK_SIZE)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool flash_ftl_write_blocks(flash_ftl_t *ftl, const uint8_t *src, uint32_t block_num, uint32_t num_blocks) {
+    if (block_num + num_blocks > ftl->block_count) {
+        return false;
+    }
+    while (num_blocks > 0) {
+        uint8_t count = num_blocks < ftl->slots_per_sector ? num_blocks : ftl->slots_per_sector;
+        if (!write_transaction(ftl, src, block_num, count)) {
+            return false;
+        }
+        src += count * FLASH_FTL_BLOCK_SIZE;
+        block_num += count;
+        num_blocks -= count;
+    }
+    return true;
+}
@@ -0,0 +1,113 @@
+
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2020 MicroPython & CircuitPython contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+#ifndef MICROPY_INCLUDED_SUPERVISOR_SHARED_EXTERNAL_FLASH_FLASH_FTL_H
+#define MICROPY_INCLUDED_SUPERVISOR_SHARED_EXTERNAL_FLASH_FLASH_FTL_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// A small log structured flash translation layer for NOR flash. Logical 512
+// byte blocks are appended to the active erase sector instead of being
+// rewritten in place, so small writes only program pages. The first block of
+// each sector holds a header with the sector's erase count, a sequence number
+// and which logical block every other slot of the sector stores. The newest
+// copy of a logical block wins when the flash is mounted.
+//
+// Writes of up to a sector's worth of blocks are atomic: every slot but the
+// last of a write is marked pending and they are only used once the last one
+// is on the flash. Longer writes are split up.
+//
+// Sectors with no live blocks left are reused, least erased first. When free
+// sectors run low the live blocks of the sector with the least live data are
+// moved to the active sector. When erase counts drift too far apart cold data
+// is moved out of the least erased sector so it gets used again.
+
+#define FLASH_FTL_BLOCK_SIZE (512)
+
+// Sectors kept free of live data so that garbage collection can always make
+// progress.
+#define FLASH_FTL_SPARE_SECTORS (3)
+
+// Slots per sector are limited so the header fits in the first block.
+#define FLASH_FTL_MAX_SLOTS (31)
+
+#ifndef FLASH_FTL_WEAR_LEVEL_THRESHOLD
+#define FLASH_FTL_WEAR_LEVEL_THRESHOLD (32)
+#endif
+
+#define FLASH_FTL_SLOTS_PER_SECTOR(sector_size) ((sector_size) / FLASH_FTL_BLOCK_SIZE - 1)
+#define FLASH_FTL_BLOCK_COUNT(sector_size, sector_count) \
+    (((sector_count) - FLASH_FTL_SPARE_SECTORS) * FLASH_FTL_SLOTS_PER_SECTOR(sector_size))
+
+// Access to the raw flash. Addresses are relative to the start of the area
+// managed by the FTL.
+typedef struct {
+    void *ctx;
+    bool (*read)(void *ctx, uint32_t address, uint8_t *data, uint32_t length);
+    // The bytes programmed are erased or already hold the data. The range may
+    // span several pages.
+    bool (*program)(void *ctx, uint32_t address, const uint8_t *data, uint32_t length);
+    bool (*erase)(void *ctx, uint32_t sector_address);
+} flash_ftl_driver_t;
+
+typedef struct {
+    uint32_t seq;
+    uint16_t erase_count;
+    uint8_t live;
+    uint8_t state;
+} flash_ftl_sector_t;
+
+typedef struct {
+    const flash_ftl_driver_t *driver;
+    flash_ftl_sector_t *sectors;
+    // Physical slot of each logical block.
+    uint16_t *map;
+    uint32_t sector_size;
+    uint32_t next_seq;
+    uint16_t sector_count;
+    uint16_t block_count;
+    uint16_t free_count;
+    uint16_t active;
+    uint8_t slots_per_sector;
+    uint8_t next_slot;
+} flash_ftl_t;
+
+// sectors needs room for sector_count entries and map for
+// FLASH_FTL_BLOCK_COUNT(sector_size, sector_count) entries.
+void flash_ftl_init(flash_ftl_t *ftl, const flash_ftl_driver_t *driver,
+    uint32_t sector_size, uint16_t sector_count, flash_ftl_sector_t *sectors, uint16_t *map);
+
+// Rebuild the block map from the sector headers. Flash without an FTL on it
+// reads back as erased and is taken over on the first writes.
+bool flash_ftl_mount(flash_ftl_t *ftl);
+
+bool flash_ftl_read_blocks(flash_ftl_t *ftl, uint8_t *dest, uint32_t block_num, uint32_t num_blocks);
+bool flash_ftl_write_blocks(flash_ftl_t *ftl, const uint8_t *src, uint32_t block_num, uint32_t num_blocks);
+
+void flash_ftl_erase_count_range(flash_ftl_t *ftl, uint16_t *min_count, uint16_t *max_count);
+
+#endif  // MICROPY_INCLUDED_SUPERVISOR_SHARED_EXTERNAL_FLASH_FLASH_FTL_H
@@ -30,9 +30,13 @@
 #include "lib/oofatfs/ff.h"
 #include "lib/oofatfs/diskio.h"
 
+#include "py/mperrno.h"
 #include "py/mpstate.h"
+#include "py/nlr.h"
 
 #include "supervisor/flash.h"
+#include "supervisor/shared/tick.h"
+#include "supervisor/usb.h"
 
 static mp_vfs_mount_t _mp_vfs;
 static fs_user_mount_t _internal_vfs;
@@ -40,11 +44,37 @@ static fs_user_mount_t _internal_vfs;
 static volatile uint32_t filesystem_flush_interval_ms = CIRCUITPY_FILESYSTEM_FLUSH_INTERVAL_MS;
 volatile bool filesystem_flush_requested = false;
 
+#if MICROPY_VFS_FAT_ASYNC
+// The tick keeps background tasks running while queued file I/O is left.
+static bool async_io_ticking = false;
+#endif
+
+void filesystem_schedule_async_io(void) {
+    #if MICROPY_VFS_FAT_ASYNC
+    if (!async_io_ticking) {
+        async_io_ticking = true;
+        supervisor_enable_tick();
+    }
+    #endif
+}
+
 void filesystem_background(void) {
+    #ifdef USB_AVAILABLE
+    usb_msc_background();
+    #endif
+    #if MICROPY_VFS_FAT_ASYNC
+    if (async_io_ticking) {
+        vfs_fat_async_service();
+    }
+    if (async_io_ticking && MP_STATE_VM(vfs_fat_async_files) == NULL) {
+        async_io_ticking = false;
+        supervisor_disable_tick();
+    }
+    #endif
     if (filesystem_flush_requested) {
         filesystem_flush_interval_ms = CIRCUITPY_FILESYSTEM_FLUSH_INTERVAL_MS;
-        // Flush but keep caches
-        supervisor_flash_flush();
+        // Flush lazily and keep caches
+        supervisor_flash_background_flush();
         filesystem_flush_requested = false;
     }
 }
@@ -141,6 +171,21 @@ void filesystem_init(bool create_allowed, bool force_create) {
 void filesystem_flush(void) {
     // Reset interval before next flush.
     filesystem_flush_interval_ms = CIRCUITPY_FILESYSTEM_FLUSH_INTERVAL_MS;
+    #if MICROPY_VFS_FAT_ASYNC
+    // Finish queued file I/O while the heap it lives in is still there. What
+    // can't be finished, eg because the script left the heap locked or the
+    // block device raised, is dropped with an error.
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) == 0) {
+        while (vfs_fat_async_service()) {
+        }
+        nlr_pop();
+    }
+    vfs_fat_async_cancel(MP_EIO);
+    #endif
+    #ifdef USB_AVAILABLE
+    usb_msc_flush();
+    #endif
     supervisor_flash_flush();
     // Don't keep caches because this is called when starting or stopping the VM.
     supervisor_flash_release_cache();
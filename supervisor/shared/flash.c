@@ -111,6 +111,21 @@ mp_uint_t flash_read_blocks(uint8_t *dest, uint32_t block_num, uint32_t num_bloc
     return supervisor_flash_read_blocks(dest, block_num - PART1_START_BLOCK, num_blocks);
 }
 
+// Flash that can't be read in place, such as external flash behind a command
+// interface, keeps this default.
+MP_WEAK const uint8_t *supervisor_flash_get_block_address(uint32_t block_num) {
+    return NULL;
+}
+
+static const uint8_t *flash_get_block_address(uint32_t block_num) {
+    if (block_num == 0) {
+        // the MBR is faked
+        return NULL;
+    }
+    supervisor_flash_flush();
+    return supervisor_flash_get_block_address(block_num - PART1_START_BLOCK);
+}
+
 volatile bool filesystem_dirty = false;
 
 mp_uint_t flash_write_blocks(const uint8_t *src, uint32_t block_num, uint32_t num_blocks) {
@@ -143,6 +158,24 @@ void supervisor_flash_flush(void) {
     filesystem_dirty = false;
 }
 
+// Called periodically from the background. The external flash cache only
+// writes back the sectors that have gone idle and keeps ticking until the
+// rest have been flushed too.
+void supervisor_flash_background_flush(void) {
+    #if INTERNAL_FLASH_FILESYSTEM
+    supervisor_flash_flush();
+    #else
+    if (!supervisor_external_flash_flush_idle()) {
+        return;
+    }
+    // Turn off ticks now that our filesystem has been flushed.
+    if (filesystem_dirty) {
+        supervisor_disable_tick();
+    }
+    filesystem_dirty = false;
+    #endif
+}
+
 STATIC mp_obj_t supervisor_flash_obj_readblocks(mp_obj_t self, mp_obj_t block_num, mp_obj_t buf) {
     mp_buffer_info_t bufinfo;
     mp_get_buffer_raise(buf, &bufinfo, MP_BUFFER_WRITE);
@@ -167,6 +200,10 @@ STATIC mp_obj_t supervisor_flash_obj_ioctl(mp_obj_t self, mp_obj_t cmd_in, mp_ob
         case BP_IOCTL_SYNC: supervisor_flash_flush(); return MP_OBJ_NEW_SMALL_INT(0);
         case BP_IOCTL_SEC_COUNT: return MP_OBJ_NEW_SMALL_INT(flash_get_block_count());
         case BP_IOCTL_SEC_SIZE: return MP_OBJ_NEW_SMALL_INT(supervisor_flash_get_block_size());
+        case BP_IOCTL_SEC_ADDR: {
+            const uint8_t *addr = flash_get_block_address(mp_obj_get_int(arg_in));
+            return addr == NULL ? mp_const_none : mp_obj_new_int_from_uint((uintptr_t)addr);
+        }
         default: return mp_const_none;
     }
 }
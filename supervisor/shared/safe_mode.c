@@ -77,6 +77,10 @@ safe_mode_t wait_for_safe_mode_reset(void) {
     return NO_SAFE_MODE;
 }
 
+safe_mode_t get_safe_mode(void) {
+    return current_safe_mode;
+}
+
 void safe_mode_on_next_reset(safe_mode_t reason) {
     port_set_saved_word(SAFE_MODE_DATA_GUARD | (reason << 8));
 }
@@ -161,6 +165,9 @@ void print_safe_mode_message(safe_mode_t reason) {
             case FLASH_WRITE_FAIL:
                 serial_write_compressed(translate("Failed to write internal flash."));
                 break;
+            case FLASH_FTL_MOUNT_FAIL:
+                serial_write_compressed(translate("Failed to mount the external flash."));
+                break;
             case MEM_MANAGE:
                 serial_write_compressed(translate("Invalid memory access."));
                 break;
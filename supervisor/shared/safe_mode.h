@@ -42,9 +42,12 @@ typedef enum {
   FLASH_WRITE_FAIL,
   MEM_MANAGE,
   WATCHDOG_RESET,
+  FLASH_FTL_MOUNT_FAIL,
 } safe_mode_t;
 
 safe_mode_t wait_for_safe_mode_reset(void);
+// The reason for the safe mode that was entered by reset, if any.
+safe_mode_t get_safe_mode(void);
 
 void safe_mode_on_next_reset(safe_mode_t reason);
 void reset_into_safe_mode(safe_mode_t reason);
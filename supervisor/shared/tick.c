@@ -26,6 +26,7 @@
 
 #include "supervisor/shared/tick.h"
 
+#include "py/mphal.h"
 #include "py/mpstate.h"
 #include "supervisor/linker.h"
 #include "supervisor/filesystem.h"
@@ -135,6 +136,15 @@ uint32_t supervisor_ticks_ms32() {
     return supervisor_ticks_ms64();
 }
 
+mp_uint_t mp_hal_ticks_us(void) {
+    uint8_t subticks = 0;
+    common_hal_mcu_disable_interrupts();
+    uint64_t ticks = port_get_raw_ticks(&subticks);
+    common_hal_mcu_enable_interrupts();
+    // Ticks are 1/1024 s and subticks 1/32 of a tick, so this is only good to ~30 us.
+    return (ticks * 32 + subticks) * 15625 / 512;
+}
+
 
 void PLACE_IN_ITCM(supervisor_run_background_tasks_if_tick)() {
     background_callback_run_all();
@@ -36,11 +36,32 @@
 
 #include "supervisor/filesystem.h"
 #include "supervisor/shared/autoreload.h"
+#include "supervisor/shared/tick.h"
+#include "supervisor/usb.h"
 
 #define MSC_FLASH_BLOCK_SIZE    512
 
+// Not in TinyUSB's list of SCSI commands.
+#define MSC_SCSI_SYNCHRONIZE_CACHE_10 0x35
+
 static bool ejected[1] = {true};
 
+// Set when a staged block couldn't be committed and reported on the next
+// SYNCHRONIZE CACHE.
+static bool write_failed = false;
+
+#if CIRCUITPY_USB_MSC_WRITE_CACHE_BLOCKS > 0
+// Blocks written by the host are staged here instead of being written while
+// it waits for the command to complete. They are committed in sorted runs when
+// the stage is full, when the host synchronizes or ejects, or from the
+// background once writes stop. Rewriting a staged block, as the host does
+// with the FAT while copying, replaces it in place.
+static uint32_t write_cache[CIRCUITPY_USB_MSC_WRITE_CACHE_BLOCKS][MSC_FLASH_BLOCK_SIZE / sizeof(uint32_t)];
+static uint32_t write_cache_lba[CIRCUITPY_USB_MSC_WRITE_CACHE_BLOCKS];
+static size_t write_cache_count = 0;
+static uint32_t write_cache_last_ms;
+#endif
+
 void usb_msc_mount(void) {
     // Reset the ejection tracking every time we're plugged into USB. This allows for us to battery
     // power the device, eject, unplug and plug it back in to get the drive.
@@ -50,7 +71,7 @@ void usb_msc_mount(void) {
 }
 
 void usb_msc_umount(void) {
-
+    usb_msc_flush();
 }
 
 bool usb_msc_ejected(void) {
@@ -78,6 +99,100 @@ static fs_user_mount_t* get_vfs(int lun) {
     return current_mount->obj;
 }
 
+#if CIRCUITPY_USB_MSC_WRITE_CACHE_BLOCKS > 0
+static void swap_staged_blocks(size_t a, size_t b) {
+    for (size_t i = 0; i < MSC_FLASH_BLOCK_SIZE / sizeof(uint32_t); i++) {
+        uint32_t word = write_cache[a][i];
+        write_cache[a][i] = write_cache[b][i];
+        write_cache[b][i] = word;
+    }
+    uint32_t lba = write_cache_lba[a];
+    write_cache_lba[a] = write_cache_lba[b];
+    write_cache_lba[b] = lba;
+}
+
+// Write the staged blocks in ascending order so that each contiguous run is a
+// single disk_write and whole erase sectors reach the flash together.
+static bool commit_staged_blocks(void) {
+    if (write_cache_count == 0) {
+        return true;
+    }
+    // The host mostly writes in order so an insertion sort has little to do.
+    for (size_t i = 1; i < write_cache_count; i++) {
+        for (size_t j = i; j > 0 && write_cache_lba[j - 1] > write_cache_lba[j]; j--) {
+            swap_staged_blocks(j - 1, j);
+        }
+    }
+    fs_user_mount_t *vfs = get_vfs(0);
+    bool ok = vfs != NULL;
+    size_t start = 0;
+    for (size_t i = 1; ok && i <= write_cache_count; i++) {
+        if (i < write_cache_count && write_cache_lba[i] == write_cache_lba[i - 1] + 1) {
+            continue;
+        }
+        ok = disk_write(vfs, (uint8_t*) write_cache[start], write_cache_lba[start], i - start) == RES_OK;
+        start = i;
+    }
+    write_cache_count = 0;
+    // Writing the blocks turned on ticks for the flash's own flush.
+    supervisor_disable_tick();
+    if (!ok) {
+        write_failed = true;
+    }
+    return ok;
+}
+
+static bool stage_block(uint32_t lba, const uint8_t *data) {
+    size_t i;
+    for (i = 0; i < write_cache_count; i++) {
+        if (write_cache_lba[i] == lba) {
+            break;
+        }
+    }
+    if (i == CIRCUITPY_USB_MSC_WRITE_CACHE_BLOCKS) {
+        if (!commit_staged_blocks()) {
+            return false;
+        }
+        i = 0;
+    }
+    if (i == write_cache_count) {
+        if (write_cache_count == 0) {
+            // Ticks run the background that commits the blocks if the host
+            // doesn't fill the stage.
+            supervisor_enable_tick();
+        }
+        write_cache_lba[i] = lba;
+        write_cache_count++;
+    }
+    memcpy(write_cache[i], data, MSC_FLASH_BLOCK_SIZE);
+    return true;
+}
+#endif
+
+void usb_msc_background(void) {
+    #if CIRCUITPY_USB_MSC_WRITE_CACHE_BLOCKS > 0
+    if (write_cache_count > 0 &&
+        supervisor_ticks_ms32() - write_cache_last_ms >= CIRCUITPY_USB_MSC_WRITE_CACHE_IDLE_MS) {
+        commit_staged_blocks();
+    }
+    #endif
+}
+
+void usb_msc_flush(void) {
+    #if CIRCUITPY_USB_MSC_WRITE_CACHE_BLOCKS > 0
+    commit_staged_blocks();
+    #endif
+}
+
+// Get everything the host has written onto the media. Fails if any of it
+// couldn't be written since the last time.
+static bool sync_lun(fs_user_mount_t *vfs) {
+    usb_msc_flush();
+    bool ok = !write_failed && disk_ioctl(vfs, CTRL_SYNC, NULL) == RES_OK;
+    write_failed = false;
+    return ok;
+}
+
 // Callback invoked when received an SCSI command not in built-in list below
 // - READ_CAPACITY10, READ_FORMAT_CAPACITY, INQUIRY, TEST_UNIT_READY, START_STOP_UNIT, MODE_SENSE6, REQUEST_SENSE
 // - READ10 and WRITE10 have their own callbacks
@@ -91,6 +206,18 @@ int32_t tud_msc_scsi_cb (uint8_t lun, const uint8_t scsi_cmd[16], void* buffer,
             resplen = 0;
         break;
 
+        case MSC_SCSI_SYNCHRONIZE_CACHE_10: {
+            fs_user_mount_t *vfs = get_vfs(lun);
+            if (vfs == NULL || !sync_lun(vfs)) {
+                // Write error
+                tud_msc_set_sense(lun, SCSI_SENSE_MEDIUM_ERROR, 0x0C, 0x00);
+                resplen = -1;
+            } else {
+                resplen = 0;
+            }
+        break;
+        }
+
         default:
           // Set Sense = Invalid Command Operation
           tud_msc_set_sense(lun, SCSI_SENSE_ILLEGAL_REQUEST, 0x20, 0x00);
@@ -144,6 +271,15 @@ int32_t tud_msc_read10_cb (uint8_t lun, uint32_t lba, uint32_t offset, void* buf
 
     fs_user_mount_t * vfs = get_vfs(lun);
     disk_read(vfs, buffer, lba, block_count);
+    #if CIRCUITPY_USB_MSC_WRITE_CACHE_BLOCKS > 0
+    // Staged blocks are newer than what is on the media.
+    for (size_t i = 0; i < write_cache_count; i++) {
+        uint32_t block = write_cache_lba[i] - lba;
+        if (block < block_count) {
+            memcpy((uint8_t*) buffer + block * MSC_FLASH_BLOCK_SIZE, write_cache[i], MSC_FLASH_BLOCK_SIZE);
+        }
+    }
+    #endif
 
     return block_count * MSC_FLASH_BLOCK_SIZE;
 }
@@ -157,7 +293,16 @@ int32_t tud_msc_write10_cb (uint8_t lun, uint32_t lba, uint32_t offset, uint8_t*
     const uint32_t block_count = bufsize / MSC_FLASH_BLOCK_SIZE;
 
     fs_user_mount_t * vfs = get_vfs(lun);
+    #if CIRCUITPY_USB_MSC_WRITE_CACHE_BLOCKS > 0
+    for (uint32_t i = 0; i < block_count; i++) {
+        if (!stage_block(lba + i, buffer + i * MSC_FLASH_BLOCK_SIZE)) {
+            return -1;
+        }
+    }
+    write_cache_last_ms = supervisor_ticks_ms32();
+    #else
     disk_write(vfs, buffer, lba, block_count);
+    #endif
     // Since by getting here we assume the mount is read-only to
     // MicroPython let's update the cached FatFs sector if it's the one
     // we just wrote.
@@ -230,7 +375,7 @@ bool tud_msc_start_stop_cb(uint8_t lun, uint8_t power_condition, bool start, boo
     if (load_eject) {
         if (!start) {
             // Eject but first flush.
-            if (disk_ioctl(current_mount, CTRL_SYNC, NULL) != RES_OK) {
+            if (!sync_lun(current_mount)) {
                 return false;
             } else {
                 ejected[lun] = true;
@@ -242,7 +387,7 @@ bool tud_msc_start_stop_cb(uint8_t lun, uint8_t power_condition, bool start, boo
     } else {
         if (!start) {
             // Stop the unit but don't eject.
-            if (disk_ioctl(current_mount, CTRL_SYNC, NULL) != RES_OK) {
+            if (!sync_lun(current_mount)) {
                 return false;
             }
         }
@@ -26,6 +26,8 @@
 
 #include "supervisor/filesystem.h"
 
+#include "py/runtime.h"
+
 void filesystem_init(bool create_allowed, bool force_create) {
     (void) create_allowed;
     (void) force_create;
@@ -34,6 +36,33 @@ void filesystem_init(bool create_allowed, bool force_create) {
 void filesystem_flush(void) {
 }
 
+#if MICROPY_VFS_FAT_ASYNC && MICROPY_ENABLE_SCHEDULER
+// Without background tasks, queued file I/O is serviced by a scheduled
+// callback that schedules itself again until none is left.
+STATIC bool async_io_scheduled = false;
+
+STATIC mp_obj_t async_io_service(mp_obj_t arg) {
+    vfs_fat_async_service();
+    async_io_scheduled = MP_STATE_VM(vfs_fat_async_files) != NULL && mp_sched_schedule(arg, arg);
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(async_io_service_obj, async_io_service);
+#endif
+
+void filesystem_schedule_async_io(void) {
+    #if MICROPY_VFS_FAT_ASYNC
+    #if MICROPY_ENABLE_SCHEDULER
+    if (!async_io_scheduled) {
+        mp_obj_t service = MP_OBJ_FROM_PTR(&async_io_service_obj);
+        async_io_scheduled = mp_sched_schedule(service, service);
+    }
+    #else
+    while (vfs_fat_async_service()) {
+    }
+    #endif
+    #endif
+}
+
 bool filesystem_is_writable_by_python(fs_user_mount_t *vfs) {
     (void) vfs;
     return true;
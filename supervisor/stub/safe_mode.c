@@ -30,6 +30,10 @@ safe_mode_t wait_for_safe_mode_reset(void) {
     return NO_SAFE_MODE;
 }
 
+safe_mode_t get_safe_mode(void) {
+    return NO_SAFE_MODE;
+}
+
 void reset_into_safe_mode(safe_mode_t reason) {
     (void) reason;
 }
@@ -45,6 +45,9 @@ ifdef EXTERNAL_FLASH_DEVICES
 				-DEXTERNAL_FLASH_DEVICE_COUNT=$(EXTERNAL_FLASH_DEVICE_COUNT)
 
 	SRC_SUPERVISOR += supervisor/shared/external_flash/external_flash.c
+	ifeq ($(CIRCUITPY_EXTERNAL_FLASH_FTL),1)
+		SRC_SUPERVISOR += supervisor/shared/external_flash/flash_ftl.c
+	endif
 	ifeq ($(SPI_FLASH_FILESYSTEM),1)
 		SRC_SUPERVISOR += supervisor/shared/external_flash/spi_flash.c
 	else
@@ -52,4 +52,9 @@ void usb_msc_mount(void);
 void usb_msc_umount(void);
 bool usb_msc_ejected(void);
 
+// Commit blocks written by the host that are still staged in RAM. The
+// background version only does so once the host has stopped writing.
+void usb_msc_background(void);
+void usb_msc_flush(void);
+
 #endif // MICROPY_INCLUDED_SUPERVISOR_USB_H
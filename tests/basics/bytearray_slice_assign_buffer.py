@@ -0,0 +1,45 @@
+# test slice assignment to bytearray from any object with the buffer protocol
+try:
+    bytearray()[:] = bytearray()
+except TypeError:
+    print("SKIP")
+    raise SystemExit
+try:
+    import uarray as array
+except ImportError:
+    try:
+        import array
+    except ImportError:
+        print("SKIP")
+        raise SystemExit
+
+b = bytearray(b"0123456789")
+b[0:2] = array.array("b", [65, 66, 67])
+print(b)
+b[1:1] = array.array("B")
+print(b)
+
+# memoryview of another object, growing and shrinking
+src = b"abcdef"
+b = bytearray(b"0123")
+b[1:2] = memoryview(src)[1:5]
+print(b)
+b[0:6] = memoryview(src)[:1]
+print(b)
+
+# memoryview of itself, same size
+b = bytearray(b"0123456789")
+b[2:6] = memoryview(b)[0:4]
+print(b)
+b[4:8] = memoryview(b)[6:10]
+print(b)
+
+# str doesn't have the buffer protocol
+try:
+    bytearray(4)[0:2] = "ab"
+except (TypeError, NotImplementedError):
+    print("TypeError")
+
+# bytes from bytes is the same object
+x = b"abc" * 3
+print(bytes(x) is x, bytes(x) == x)
@@ -0,0 +1,25 @@
+# test growing slice assignment to bytearray from a memoryview of itself
+# (CPython doesn't allow resizing a bytearray that has exports)
+try:
+    memoryview
+    bytearray()[:] = bytearray()
+except:
+    print("SKIP")
+    raise SystemExit
+
+b = bytearray(b"0123456789")
+b[0:1] = memoryview(b)[2:6]
+print(b)
+
+b = bytearray(b"0123456789")
+b[5:6] = memoryview(b)[0:8]
+print(b)
+
+b = bytearray(b"0123456789")
+b[0:4] = memoryview(b)[2:4]
+print(b)
+
+# large enough that the buffer must be reallocated
+b = bytearray(range(200))
+b[100:101] = memoryview(b)[50:150]
+print(len(b), b[99], b[100], b[199], b[200], b[298])
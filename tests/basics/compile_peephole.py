@@ -0,0 +1,95 @@
+# test code that the bytecode compiler may optimise while emitting it
+
+# stores to locals that are never read
+def f(a):
+    x = 1
+    y = z = a
+    for i in range(3):
+        pass
+    w = print("side effect")
+    return z
+print(f(2))
+
+# a store followed by del must still happen
+def f():
+    x = 1
+    del x
+    try:
+        del x
+    except NameError:
+        print("NameError")
+f()
+
+# exception variables
+def f():
+    try:
+        raise ValueError(1)
+    except ValueError as e:
+        pass
+    try:
+        e
+    except NameError:
+        print("NameError")
+f()
+
+# values that are computed and thrown away
+def f():
+    1
+    "str"
+    None
+    (1, 2)
+    return 3
+print(f())
+
+# jumps to jumps and jumps to returns
+def f(a, b):
+    if a:
+        if b:
+            x = 1
+        else:
+            x = 2
+    else:
+        x = 3
+    return x
+print(f(1, 1), f(1, 0), f(0, 1))
+
+def f(a):
+    return 1 if a else 2
+print(f(True), f(False))
+
+def f(n):
+    r = 0
+    while n:
+        if n & 1:
+            r += 1
+        else:
+            pass
+        n >>= 1
+    return r
+print(f(0), f(7), f(0x55))
+
+def f(a, b, c):
+    return a and b or c
+print(f(1, 2, 3), f(0, 2, 3), f(1, 0, 3))
+
+def f(a):
+    for x in a:
+        if x:
+            continue
+        else:
+            break
+    else:
+        return "else"
+    return "break"
+print(f([1, 1]), f([1, 0]))
+
+# tuples of constants
+def f():
+    return (1, "a", b"b", None, True, False, ..., 1.5, 10 ** 20)
+print(f(), f() == f())
+def f():
+    return (1, 2), (3, (4, 5)), ()
+print(f())
+def f(x):
+    return x in (1, 2, 3)
+print(f(2), f(4))
@@ -0,0 +1,42 @@
+# test functions that are called often and run long loops, which may be
+# recompiled while the program runs; behaviour must not change
+
+G = 5
+
+def f(n, k=2, *, m=3):
+    s = 0
+    for i in range(n):
+        s += i * k + m + G
+    return s
+
+def raiser(x):
+    if x > 300:
+        raise ValueError(x)
+    return x
+
+def counter():
+    global G
+    G += 1
+
+for j in range(400):
+    r = f(j)
+print(r, f(10, 3, m=1), f(10, m=0), f.__name__)
+
+try:
+    for j in range(400):
+        raiser(j)
+except ValueError as e:
+    print('ValueError', e)
+
+for j in range(2000):
+    counter()
+print(G)
+
+# a hot function that is redefined must use the new definition
+def g():
+    return 1
+for j in range(2000):
+    g()
+def g():
+    return 2
+print(g())
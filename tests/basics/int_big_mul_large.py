@@ -0,0 +1,30 @@
+# test multiplication, squaring and modular pow of large enough ints to use
+# the fast algorithms
+
+# simple deterministic pseudo-random numbers of the given bit length
+seed = 7
+def rnd(bits):
+    global seed
+    r = 0
+    for _ in range((bits + 29) // 30):
+        seed = (seed * 1103515245 + 12345) & 0x7fffffff
+        r = (r << 30) | (seed & 0x3fffffff)
+    return r >> (((bits + 29) // 30) * 30 - bits)
+
+M = 10 ** 38 + 3
+for bits in (100, 1023, 1024, 1025, 2048, 3000, 6000):
+    for bits2 in (30, 700, 1100, 2048, bits):
+        a = rnd(bits) | 1
+        b = rnd(bits2)
+        print(bits, bits2, a * b % M, -a * b % M, a * a % M, (a * b) >> (bits + bits2 - 64))
+    e = (1 << bits) - 1
+    print(e * e == (1 << (2 * bits)) - (1 << (bits + 1)) + 1, e * (e + 2) == (1 << (2 * bits)) - 1)
+
+for bits in (64, 100, 512, 1024, 2048):
+    m = rnd(bits) | 1 | (1 << (bits - 1))
+    for eb in (1, 2, 17, 64, bits):
+        x = rnd(bits + 10)
+        e = rnd(eb) | 1
+        print(bits, eb, pow(x, e, m) % M, pow(x, e, m) == pow(x % m, e, m))
+    print(pow(m - 1, 2, m), pow(0, 5, m), pow(3, 0, m), pow(2, m - 1, m) % M)
+print(pow(-3, 1001, 2 ** 200 + 1) % M, pow(3, 1001, -(2 ** 200 + 1)) % M, pow(7, 2 ** 100, 2 ** 128))
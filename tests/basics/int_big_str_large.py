@@ -0,0 +1,35 @@
+# test conversion of large enough ints to and from strings to use the fast
+# algorithms (kept below CPython's default limit of 4300 digits)
+
+# simple deterministic pseudo-random numbers of the given bit length
+seed = 7
+def rnd(bits):
+    global seed
+    r = 0
+    for _ in range((bits + 29) // 30):
+        seed = (seed * 1103515245 + 12345) & 0x7fffffff
+        r = (r << 30) | (seed & 0x3fffffff)
+    return r >> (((bits + 29) // 30) * 30 - bits)
+
+for bits in (100, 2000, 4000, 7000, 14000):
+    for x in (rnd(bits), -rnd(bits), 1 << bits, (1 << bits) - 1):
+        s = str(x)
+        print(bits, len(s), s[:20], s[-20:], int(s) == x)
+        for base in (2, 7, 16, 36):
+            print(base, int(s, 10) == int(("-" if x < 0 else "") + "%x" % abs(x), 16), int(int(s) % base))
+
+# powers of ten and numbers with runs of zeros, which need padding
+for n in (9, 10, 11, 99, 100, 1000, 2047, 2048, 4000):
+    for x in (10 ** n, 10 ** n - 1, 10 ** n + 1, 7 * 10 ** (n // 2) + 10 ** n):
+        s = str(x)
+        print(n, len(s), s.count("0"), s.count("9"), int(s) == x, int(s + "0") == 10 * x)
+
+# other bases and leading zeros
+for n in (100, 1000, 3000):
+    x = rnd(n * 4)
+    print(n, int("0" * n + "1", 10), int("z" * n, 36) == 36 ** n - 1, int("7" * n, 8) == 8 ** n - 1)
+    print(n, int("1" * n, 3) == (3 ** n - 1) // 2, int("-" + "9" * n) == -(10 ** n) + 1)
+    print(n, "{:,}".format(x)[:40], "{:,}".format(-x)[-40:])
+
+# division that previously estimated a quotient digit too large
+print(((1 << 1000) - (1 << 501) + 1) % ((1 << 127) - 1))
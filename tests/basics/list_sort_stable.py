@@ -0,0 +1,66 @@
+# test that list.sort and sorted() are stable, also on long and presorted input
+
+# simple deterministic pseudo-random numbers
+seed = 1
+def rand(n):
+    global seed
+    seed = (seed * 1103515245 + 12345) & 0x7fffffff
+    return seed % n
+
+def check(l, **kwargs):
+    key = kwargs.get("key", lambda x: x)
+    pairs = [(x, i) for i, x in enumerate(l)]
+    s = sorted(pairs, key=lambda p: key(p[0]), reverse=kwargs.get("reverse", False))
+    l2 = l[:]
+    l2.sort(**kwargs)
+    print(len(l), [p[0] for p in s] == l2, [p[1] for p in s][:8])
+
+# equal keys keep their order
+print(sorted(["bb", "a", "ccc", "d", "ee", "f"], key=len))
+print(sorted(["bb", "a", "ccc", "d", "ee", "f"], key=len, reverse=True))
+print(sorted([(1, "a"), (0, "b"), (1, "c"), (0, "d")], key=lambda t: t[0]))
+
+for n in (10, 64, 65, 300, 1000):
+    check([rand(n // 4 + 1) for _ in range(n)])
+    check([rand(n // 4 + 1) for _ in range(n)], reverse=True)
+    check([rand(10) for _ in range(n)], key=lambda x: -x)
+    check(list(range(n)))
+    check(list(range(n, 0, -1)), reverse=True)
+    check([i // 3 for i in range(n)], reverse=True)
+    check([i % 7 for i in range(n)])
+
+# long runs going in both directions
+l = []
+while len(l) < 2000:
+    k = rand(150) + 1
+    s = rand(1000)
+    l += list(range(s, s + k)) if rand(2) else list(range(s + k, s, -1))
+check(l)
+check(l, key=lambda x: x // 10)
+
+# key function is called exactly once per item
+calls = []
+def key(x):
+    calls.append(x)
+    return -x
+l = [rand(100) for _ in range(100)]
+l.sort(key=key)
+print(len(calls), sorted(calls) == sorted(l))
+
+# an exception in the middle of a sort leaves every item in the list
+class A:
+    n = 0
+    def __init__(self, x):
+        self.x = x
+    def __lt__(self, other):
+        A.n += 1
+        if A.n == 500:
+            raise ValueError
+        return self.x < other.x
+l = [A(rand(50)) for _ in range(200)]
+ids = sorted(id(a) for a in l)
+try:
+    l.sort()
+except ValueError:
+    print("ValueError")
+print(sorted(id(a) for a in l) == ids)
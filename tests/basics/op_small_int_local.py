@@ -0,0 +1,83 @@
+# test ops on locals with small-int constants, and compares feeding a jump;
+# these sequences may be compiled to fused/specialised bytecodes
+
+def add_sub(x):
+    a = x + 1
+    b = x - 1
+    x += 47
+    x -= -16
+    return a, b, x
+
+print(add_sub(0))
+print(add_sub(-5))
+print(add_sub(1.5))
+print(add_sub(True))
+
+def bitops(x):
+    return x & 6, x | 6, x ^ 6, x // 3, x % 3, x < 5, x >= 5, x == 5, x != 5
+
+for v in (-7, 0, 5, 12):
+    print(bitops(v))
+
+# compare with non-int operands
+def cmp_jump(a, b):
+    if a < b:
+        return 'lt'
+    if a == b:
+        return 'eq'
+    return 'gt'
+
+print(cmp_jump(1, 2), cmp_jump(2, 2), cmp_jump(3, 2))
+print(cmp_jump(1.5, 2), cmp_jump(2, 2.0), cmp_jump('b', 'a'))
+print(cmp_jump((1, 2), (1, 3)), cmp_jump([1], [1]))
+
+def count(n):
+    i = 0
+    while i < n:
+        i += 1
+    while i != 0:
+        i -= 2
+    return i
+
+print(count(10))
+
+# attribute of a local
+class A:
+    def __init__(self):
+        self.x = 1
+    def get(self):
+        return self.x
+
+def attr(a):
+    return a.x + a.get()
+
+print(attr(A()))
+
+def unbound():
+    if False:
+        a = 1
+    return a.x
+
+try:
+    unbound()
+except NameError:
+    print('NameError')
+
+def unbound_op():
+    if False:
+        a = 1
+    return a + 1
+
+try:
+    unbound_op()
+except NameError:
+    print('NameError')
+
+# unsupported types still raise
+def bad(x):
+    return x + 1
+
+try:
+    bad('a')
+except TypeError:
+    print('TypeError')
@@ -0,0 +1,9 @@
+# test ops on locals with small-int constants whose results overflow a small int
+
+def overflow(x):
+    return x + 1, x - 1, x * 3, x << 40
+
+print(overflow(0x3fffffff))
+print(overflow(-0x40000000))
+print(overflow(0x3fffffffffffffff))
+print(overflow(-0x4000000000000000))
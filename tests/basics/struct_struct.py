@@ -0,0 +1,73 @@
+# test precompiled struct formats
+# (ustruct has no Struct; the unix coverage build has CircuitPython's struct
+# module as _cpstruct)
+try:
+    import _cpstruct as struct
+except ImportError:
+    try:
+        import struct
+    except ImportError:
+        print("SKIP")
+        raise SystemExit
+
+try:
+    struct.Struct
+except AttributeError:
+    print("SKIP")
+    raise SystemExit
+
+s = struct.Struct("<hHb3sxI")
+print(s.format, s.size)
+data = s.pack(-2, 60000, 7, b"ab", 123456)
+print(data)
+print(s.unpack(data))
+print(s.unpack_from(b"\xff" + data, 1))
+print(s.unpack_from(data + b"\xff"))
+
+buf = bytearray(s.size + 2)
+s.pack_into(buf, 2, 1, 2, 3, b"xyzw", 4)
+print(buf)
+s.pack_into(buf, -s.size, 5, 6, 7, b"", 8)
+print(buf)
+
+# big-endian and repeat counts
+s = struct.Struct(">2h2s2B")
+print(s.size, s.pack(1, -1, b"q", 254, 255))
+print(s.unpack(b"\x00\x01\xff\xffqr\xfe\xff"))
+
+# native alignment matches calcsize
+for fmt in ("bi", "bh", "hq", "b2i", "3bH"):
+    s = struct.Struct(fmt)
+    print(fmt, s.size == struct.calcsize(fmt), len(s.pack(*range(1, len(s.unpack(bytes(s.size))) + 1))) == s.size)
+
+# the same Struct can be reused
+s = struct.Struct("<BH")
+for i in range(3):
+    print(s.unpack(s.pack(i, i * 1000)))
+
+# iter_unpack on a Struct and at module level
+s = struct.Struct("<hB")
+frames = b"".join(s.pack(i * 100, i) for i in range(4))
+for rec in s.iter_unpack(frames):
+    print(rec)
+print(list(struct.iter_unpack("<h", b"\x01\x00\x02\x00")))
+print(list(s.iter_unpack(b"")))
+
+# wrong-sized buffers
+for args in ((b"\x00",), (frames,)):
+    try:
+        s.unpack(*args)
+    except Exception:
+        print("Exception")
+try:
+    s.iter_unpack(b"\x00\x00")
+except Exception:
+    print("Exception")
+try:
+    s.unpack_from(b"\x00\x00\x00", 1)
+except Exception:
+    print("Exception")
+try:
+    s.pack_into(bytearray(2), 0, 1, 2)
+except Exception:
+    print("Exception")
@@ -0,0 +1,61 @@
+# test the incremental JSON parser
+
+try:
+    import ujson as json
+    import uio as io
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+if not hasattr(json, "Parser"):
+    print("SKIP")
+    raise SystemExit
+
+CONTAINER = ("start_map", "end_map", "start_array", "end_array")
+
+doc = '{"a": [1, 2.5, -3e2, {"b": null, "c": "x\\"y\\u0041"}], "d": {"e": true, "f": false}, "g": [], "h": {}}'
+
+# all events, with a buffer smaller than most tokens
+p = json.Parser(io.StringIO(doc), 4)
+for ev in p:
+    print(ev, p.depth(), "" if ev in CONTAINER else p.value())
+
+# materialise only a selected part of the document
+p = json.Parser(io.StringIO(doc))
+v = p.find("a"), p.value()
+print(v[0], v[1][:3], sorted(v[1][3].items()))
+print(p.find("f"), p.value(), p.depth())
+
+# skip containers without materialising them
+p = json.Parser(io.StringIO(doc))
+print(p.find("d"), p.skip(), p.depth(), next(p), p.value())
+print(p.find("zz"), list(p))
+
+# a stream of several documents, read through readinto
+class Buffer:
+    def __init__(self, data):
+        self._data = data
+        self._i = 0
+
+    def readinto(self, buf):
+        n = min(len(buf), len(self._data) - self._i)
+        buf[:n] = self._data[self._i : self._i + n]
+        self._i += n
+        return n
+
+p = json.Parser(Buffer(b'[{"id": 1, "v": [1, 2]}, {"id": 2, "v": {"x": [[]]}}]\n5\n"s"\n'), 1)
+print(next(p), next(p), p.value(), next(p), next(p), p.value())
+print(next(p), next(p), p.value())
+print(list(p))
+
+# a large integer
+p = json.Parser(io.StringIO("[123456789012345678901234567890]"))
+print(next(p), next(p), p.value())
+
+# malformed input
+for bad in ("[1, 2", '{"a" 1 }]', "[}", "tru", "{[1]: 2}", '"abc', '{"a"}', "{1: 2}",
+            "[1 2]", "[1,,2]", '{"a" "b"}', '{"a":1,}', "[,]", "[1,]", "1-2", ",1", '{"a"::1}', "[1:2]", "[1.]", "[1e5e5]"):
+    try:
+        print(list(json.Parser(io.StringIO(bad))))
+    except ValueError:
+        print("ValueError", bad)
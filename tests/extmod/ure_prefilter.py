@@ -0,0 +1,79 @@
+# test unanchored searches of patterns whose first bytes are known up front,
+# and repeated use of module-level functions with the same pattern
+
+try:
+    import ure as re
+except ImportError:
+    try:
+        import re
+    except ImportError:
+        print("SKIP")
+        raise SystemExit
+
+def print_groups(m):
+    if m is None:
+        print(None)
+    else:
+        print(m.group(0), m.group(1) if m.group(0) != m.group(1) else "")
+
+s = "2020-01-01 12:00:00 INFO worker processed id=12345 status=200 in 7ms"
+
+# literal prefix
+print(re.search("status=", s).group(0))
+print(re.search("status=(\\d+)", s).group(1))
+print(re.search("stat", "sta sta stat").group(0))
+print(re.search("stats", s))
+print(re.search("abc", "ab"))
+print(re.search("abc", ""))
+print(re.search("id=(\\d)+", s).group(0))
+print(re.search("(in) (\\d+)", s).group(2))
+print(re.search("x+y", "xxxy").group(0))
+print(re.search("ab*c", "abbbd ac").group(0))
+print(re.search("ab?c", "abbc abc").group(0))
+
+# prefix longer than is kept for scanning
+print(re.search("processed id=12345 st", s).group(0))
+print(re.search("processed id=12345 sx", s))
+
+# set of first bytes
+print(re.search("[A-Z]+", s).group(0))
+print(re.search("\\d\\d:", s).group(0))
+print(re.search("[^0-9 :-]+", s).group(0))
+print(re.search("(a|st)atus", s).group(0))
+print(re.search("b*c", "aaabbc").group(0))
+print(re.search("(?:ms|s)$", s).group(0))
+print(re.search("[xyz]", s))
+print(re.search("\\s\\w", s).group(0))
+
+# patterns that may match without consuming a byte are tried everywhere
+print(re.search("x*", s).group(0) == "")
+print(re.search("a|$", "bbb").group(0) == "")
+print(re.search(".s", s).group(0))
+
+# anchored at start of string
+print(re.search("^2020", s).group(0))
+print(re.search("^INFO", s))
+print(re.match("INFO", s))
+print(re.match("\\d+", s).group(0))
+
+# bytes subjects
+print(re.search(b"id=(\\d+)", b"x id=7").group(1))
+print(re.search(b"[\xe9]d", b"abc\xe9d").group(0))
+
+# split uses the same search
+print(re.compile(", *").split("a,b,  c"))
+print(re.compile("[0-9]+").split("ab12cd3"))
+
+# module-level functions called repeatedly with equal patterns
+for i in range(12):
+    p = "(\\d+)" + "x" * (i % 5)
+    print_groups(re.search(p, "12xxxx 34xx"))
+for i in range(3):
+    print(re.match("".join(["w", "o", "r"]), "worker").group(0))
+
+# invalid patterns still raise every time
+for i in range(2):
+    try:
+        re.search("a(", "a(")
+    except Exception:
+        print("Exception")
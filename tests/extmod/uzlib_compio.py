@@ -0,0 +1,59 @@
+try:
+    import uzlib as zlib
+    import uio as io
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+if not hasattr(zlib, "CompIO"):
+    print("SKIP")
+    raise SystemExit
+
+
+def compress(data, wbits, chunk):
+    buf = io.BytesIO()
+    c = zlib.CompIO(buf, wbits)
+    for i in range(0, len(data), chunk):
+        c.write(data[i : i + chunk])
+    c.close()
+    return buf.getvalue()
+
+
+# round trip raw DEFLATE, zlib and gzip streams, written in pieces of any size
+data = "".join("t=%d x=%d\n" % (i % 5, i % 3) for i in range(400)).encode()
+for wbits in (-8, 9, 10, 15, 26):
+    for chunk in (1, 7, 1000, 10000):
+        z = compress(data, wbits, chunk)
+        print(wbits, chunk, zlib.DecompIO(io.BytesIO(z), wbits).read() == data, len(z) < len(data) // 4)
+
+# incompressible and empty input
+data = bytes((i * 7919 >> 3) & 0xFF for i in range(3000))
+print(zlib.DecompIO(io.BytesIO(compress(data, 10, 100)), 10).read() == data)
+print(zlib.DecompIO(io.BytesIO(compress(b"", 10, 1)), 10).read())
+
+# streams ending at every fill level of the output buffer
+data = bytes((i * 7919 >> 3) & 0xFF for i in range(300))
+for wbits in (10, 26):
+    print(all(zlib.DecompIO(io.BytesIO(compress(data[:n], wbits, 50)), wbits).read() == data[:n] for n in range(300)))
+
+# flush makes everything written so far decompressible
+buf = io.BytesIO()
+with zlib.CompIO(buf, -10) as c:
+    c.write(b"hello " * 10)
+    c.flush()
+    print(zlib.DecompIO(io.BytesIO(buf.getvalue()), -10).read(60))
+    c.write(b"world")
+print(zlib.DecompIO(io.BytesIO(buf.getvalue()), -10).read())
+
+# writing after close fails
+try:
+    c.write(b"x")
+except OSError:
+    print("OSError")
+
+# window size must be 8..15, with an optional gzip offset of 16
+for wbits in (7, 16, -16, 32):
+    try:
+        zlib.CompIO(io.BytesIO(), wbits)
+    except ValueError:
+        print("ValueError")
@@ -0,0 +1,126 @@
+# test the bytecode cache of imported modules using a user-defined filesystem
+
+import sys, uio
+
+try:
+    uio.IOBase
+    import uos
+    uos.mount
+except (ImportError, AttributeError):
+    print("SKIP")
+    raise SystemExit
+
+
+class UserFile(uio.IOBase):
+    def __init__(self, fs, path):
+        self.fs = fs
+        self.path = path
+        self.pos = 0
+    def readinto(self, buf):
+        data = self.fs.files[self.path]
+        n = 0
+        while n < len(buf) and self.pos < len(data):
+            buf[n] = data[self.pos]
+            n += 1
+            self.pos += 1
+        return n
+    def write(self, buf):
+        self.fs.files[self.path] += bytes(buf)
+        return len(buf)
+    def ioctl(self, req, arg):
+        if req == 4: # MP_STREAM_CLOSE
+            self.fs.log.append('close ' + self.path)
+        return 0
+
+
+class UserFS:
+    def __init__(self, files):
+        self.files = files
+        self.dirs = set()
+        self.mtimes = {}
+        self.readonly = False
+        self.log = []
+    def mount(self, readonly, mksfs):
+        pass
+    def umount(self):
+        pass
+    def stat(self, path):
+        if path in self.dirs:
+            return (16384, 0, 0, 0, 0, 0, 0, 0, 0, 0)
+        if path in self.files:
+            size = len(self.files[path])
+            mtime = self.mtimes.get(path, 0)
+            return (32768, 0, 0, 0, 0, 0, size, mtime, mtime, mtime)
+        raise OSError(2)
+    def open(self, path, mode):
+        self.log.append('open %s %s' % (path, mode))
+        if 'w' in mode:
+            if self.readonly:
+                raise OSError(30)
+            self.files[path] = b''
+        elif path not in self.files:
+            raise OSError(2)
+        return UserFile(self, path)
+    def mkdir(self, path):
+        self.log.append('mkdir ' + path)
+        if self.readonly:
+            raise OSError(30)
+        if path in self.dirs:
+            raise OSError(17)
+        self.dirs.add(path)
+    def remove(self, path):
+        self.log.append('remove ' + path)
+        del self.files[path]
+
+
+def test(desc):
+    fs.log.clear()
+    sys.modules.pop('cachemod', None)
+    import cachemod
+    print(desc, cachemod.f())
+    for op in fs.log:
+        print(' ', op)
+
+
+user_files = {
+    '/cachemod.py': b"x = 1\ndef f():\n    return x\n",
+}
+fs = UserFS(user_files)
+uos.mount(fs, '/userfs')
+sys.path.append('/userfs')
+
+# the first import compiles the module and saves its bytecode
+import cachemod
+if '/.mpycache/cachemod.mpy' not in user_files:
+    print("SKIP")
+    raise SystemExit
+print('compiled', cachemod.f())
+for op in fs.log:
+    print(' ', op)
+
+# the next import loads the saved bytecode instead of the source
+test('cached')
+
+# changing the size or the mtime of the source compiles it again
+user_files['/cachemod.py'] = b"x = 22\ndef f():\n    return x\n"
+test('resized')
+user_files['/cachemod.py'] = b"x = 33\ndef f():\n    return x\n"
+fs.mtimes['/cachemod.py'] = 1000
+test('touched')
+test('cached')
+
+# a truncated cache file is closed and replaced
+cache = user_files['/.mpycache/cachemod.mpy']
+user_files['/.mpycache/cachemod.mpy'] = cache[:len(cache) // 2]
+test('truncated')
+test('cached')
+
+# if the cache can't be written the module is still imported
+del user_files['/.mpycache/cachemod.mpy']
+fs.dirs.clear()
+fs.readonly = True
+test('readonly')
+
+# unmount and undo path addition
+uos.umount('/userfs')
+sys.path.pop()
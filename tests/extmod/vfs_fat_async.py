@@ -0,0 +1,137 @@
+# test file I/O queued with write_async/readinto_async and serviced in the background
+try:
+    import uos
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+try:
+    uos.VfsFat
+    uos.VfsFat.open
+except AttributeError:
+    print("SKIP")
+    raise SystemExit
+
+
+class RAMFS:
+
+    SEC_SIZE = 512
+
+    def __init__(self, blocks):
+        self.data = bytearray(blocks * self.SEC_SIZE)
+
+    def readblocks(self, n, buf):
+        buf[:] = self.data[n * self.SEC_SIZE:n * self.SEC_SIZE + len(buf)]
+        return 0
+
+    def writeblocks(self, n, buf):
+        self.data[n * self.SEC_SIZE:n * self.SEC_SIZE + len(buf)] = buf
+        return 0
+
+    def ioctl(self, op, arg):
+        if op == 4:  # BP_IOCTL_SEC_COUNT
+            return len(self.data) // self.SEC_SIZE
+        if op == 5:  # BP_IOCTL_SEC_SIZE
+            return self.SEC_SIZE
+
+
+try:
+    bdev = RAMFS(50)
+except MemoryError:
+    print("SKIP")
+    raise SystemExit
+
+uos.VfsFat.mkfs(bdev)
+vfs = uos.VfsFat(bdev)
+uos.mount(vfs, '/ramdisk')
+uos.chdir('/ramdisk')
+
+f = open('f', 'wb')
+if not hasattr(f, 'write_async'):
+    f.close()
+    print("SKIP")
+    raise SystemExit
+
+
+def wait(f):
+    polls = 0
+    while True:
+        r = f.async_result()
+        if r is not None:
+            return r, polls > 0
+        polls += 1
+
+
+data = bytes(i & 0xff for i in range(3000))
+
+# the write is done in steps while the caller keeps running
+f.write(b'head')
+f.write_async(data)
+print(wait(f))
+f.close()
+print(uos.stat('f')[6])
+
+# only one transfer can be queued at a time
+f = open('f', 'rb')
+buf = bytearray(2000)
+f.readinto_async(buf)
+try:
+    f.readinto_async(buf)
+except OSError as er:
+    print('OSError', er.args[0] == 16)
+print(wait(f))
+print(buf == b'head' + data[:1996])
+
+# reading stops at the end of the file
+f.readinto_async(buf)
+print(wait(f))
+print(buf[:1004] == data[1996:])
+f.close()
+
+# synchronous operations finish a queued transfer first
+f = open('f', 'r+b')
+f.seek(4)
+f.write_async(b'x' * 700)
+print(f.tell())
+print(f.async_result())
+f.seek(0)
+print(f.read(8))
+f.close()
+
+# nothing is done while the heap is locked, and the transfer goes on after
+try:
+    import micropython
+    micropython.heap_lock
+except (ImportError, AttributeError):
+    micropython = None
+if micropython:
+    f = open('f', 'wb')
+    f.write_async(data)
+    r = None
+    i = 0
+    micropython.heap_lock()
+    while i < 10:
+        r = f.async_result()
+        i += 1
+    micropython.heap_unlock()
+    print(r, wait(f))
+    f.close()
+else:
+    print(None, (3000, True))
+
+# errors are raised by async_result
+f = open('f', 'wb')
+f.readinto_async(buf)
+try:
+    wait(f)
+except OSError as er:
+    print('OSError', er.args[0])
+f.close()
+
+# queuing on a closed file fails
+try:
+    f.write_async(b'x')
+except OSError as er:
+    print('OSError', er.args[0])
+
+uos.umount('/ramdisk')
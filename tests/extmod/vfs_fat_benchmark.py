@@ -0,0 +1,87 @@
+# test timing block device reads and writes with uos.benchmark
+try:
+    import uos
+
+    uos.benchmark
+    uos.VfsFat
+except (ImportError, AttributeError):
+    print("SKIP")
+    raise SystemExit
+
+
+class RAMFS:
+
+    SEC_SIZE = 512
+
+    def __init__(self, blocks):
+        self.data = bytearray(blocks * self.SEC_SIZE)
+
+    def readblocks(self, n, buf):
+        buf[:] = self.data[n * self.SEC_SIZE:n * self.SEC_SIZE + len(buf)]
+        return 0
+
+    def writeblocks(self, n, buf):
+        self.data[n * self.SEC_SIZE:n * self.SEC_SIZE + len(buf)] = buf
+        return 0
+
+    def ioctl(self, op, arg):
+        if op == 4:  # BP_IOCTL_SEC_COUNT
+            return len(self.data) // self.SEC_SIZE
+        if op == 5:  # BP_IOCTL_SEC_SIZE
+            return self.SEC_SIZE
+
+
+class ReadOnlyBDev:
+
+    def __init__(self, bdev):
+        self.readblocks = bdev.readblocks
+        self.ioctl = bdev.ioctl
+
+
+def check(r, count):
+    print(sum(r.histogram) == count, 0 <= r.p50_us <= r.p99_us <= r.max_us, r.bytes_per_second > 0)
+
+
+try:
+    bdev = RAMFS(60)
+except MemoryError:
+    print("SKIP")
+    raise SystemExit
+
+for i in range(len(bdev.data)):
+    bdev.data[i] = i * 7 & 0xff
+orig = bytes(bdev.data)
+
+# sequential and random reads, of single blocks and of several at once
+check(uos.benchmark(bdev), 64)
+check(uos.benchmark(bdev, random=True, count=100), 100)
+check(uos.benchmark(bdev, count=20, blocks=8), 20)
+
+# writes leave the data as it was
+check(uos.benchmark(bdev, write=True, random=True, count=50, blocks=3), 50)
+print(bytes(bdev.data) == orig)
+
+# the device under a VfsFat
+uos.VfsFat.mkfs(bdev)
+vfs = uos.VfsFat(bdev)
+check(uos.benchmark(vfs, count=10), 10)
+check(uos.benchmark(vfs, write=True, count=10, blocks=2), 10)
+
+# fields of the result
+r = uos.benchmark(bdev, count=1)
+print(r[4] is r.histogram, len(r))
+
+# errors
+for kw in ({'count': 0}, {'blocks': 0}):
+    try:
+        uos.benchmark(bdev, **kw)
+    except ValueError:
+        print('ValueError')
+try:
+    uos.benchmark(bdev, blocks=61)
+except OSError as er:
+    print('OSError', er.args[0])
+try:
+    uos.benchmark(ReadOnlyBDev(bdev), write=True)
+except OSError as er:
+    print('OSError', er.args[0])
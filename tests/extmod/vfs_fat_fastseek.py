@@ -0,0 +1,85 @@
+# test seeking in fragmented files opened for reading, which use a cluster link map
+try:
+    import uos
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+try:
+    uos.VfsFat
+except AttributeError:
+    print("SKIP")
+    raise SystemExit
+
+
+class RAMFS:
+
+    SEC_SIZE = 512
+
+    def __init__(self, blocks):
+        self.data = bytearray(blocks * self.SEC_SIZE)
+
+    def readblocks(self, n, buf):
+        buf[:] = self.data[n * self.SEC_SIZE:n * self.SEC_SIZE + len(buf)]
+        return 0
+
+    def writeblocks(self, n, buf):
+        self.data[n * self.SEC_SIZE:n * self.SEC_SIZE + len(buf)] = buf
+        return 0
+
+    def ioctl(self, op, arg):
+        if op == 4:  # BP_IOCTL_SEC_COUNT
+            return len(self.data) // self.SEC_SIZE
+        if op == 5:  # BP_IOCTL_SEC_SIZE
+            return self.SEC_SIZE
+
+
+try:
+    bdev = RAMFS(60)
+except MemoryError:
+    print("SKIP")
+    raise SystemExit
+
+uos.VfsFat.mkfs(bdev)
+vfs = uos.VfsFat(bdev)
+uos.mount(vfs, '/ramdisk')
+uos.chdir('/ramdisk')
+
+# interleave appends so that both files end up in many fragments
+expect = {'a': bytearray(), 'b': bytearray()}
+for i in range(12):
+    for name in expect:
+        chunk = bytes((i * 37 + j + ord(name)) & 0xff for j in range(300 + i * 11))
+        with open(name, 'ab') as f:
+            f.write(chunk)
+        expect[name] += chunk
+
+for name in expect:
+    data = expect[name]
+    with open(name, 'rb') as f:
+        ok = f.read() == data
+        for pos in (len(data) - 1, 0, 513, 4000, 1024, 511, len(data) // 2, 3):
+            f.seek(pos)
+            ok = ok and f.read(700) == data[pos:pos + 700]
+        f.seek(-100, 2)
+        ok = ok and f.read() == data[-100:]
+        f.seek(len(data) + 50)
+        ok = ok and f.read(10) == b'' and f.tell() == len(data)
+        f.seek(200)
+        f.seek(600, 1)
+        ok = ok and f.read(5) == data[800:805]
+    print(name, len(data), ok)
+
+# files that fit in one cluster, and writable files, don't use a map
+with open('small', 'wb') as f:
+    f.write(b'xyz' * 10)
+with open('small') as f:
+    f.seek(12)
+    print(f.read(6))
+with open('a', 'r+b') as f:
+    f.seek(2000)
+    f.write(b'!!')
+    f.seek(1999)
+    print(f.read(4) == expect['a'][1999:2000] + b'!!' + expect['a'][2002:2003])
+
+uos.umount('/ramdisk')
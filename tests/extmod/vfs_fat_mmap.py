@@ -0,0 +1,90 @@
+# test mapping files on a FAT filesystem whose block device is memory mapped
+try:
+    import uerrno
+    import uos
+    import uctypes
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+try:
+    uos.VfsFat
+    uos.mmap
+except AttributeError:
+    print("SKIP")
+    raise SystemExit
+
+
+class RAMFS:
+
+    SEC_SIZE = 512
+
+    def __init__(self, blocks):
+        self.data = bytearray(blocks * self.SEC_SIZE)
+        self.mapped = True
+
+    def readblocks(self, n, buf):
+        buf[:] = self.data[n * self.SEC_SIZE:n * self.SEC_SIZE + len(buf)]
+        return 0
+
+    def writeblocks(self, n, buf):
+        self.data[n * self.SEC_SIZE:n * self.SEC_SIZE + len(buf)] = buf
+        return 0
+
+    def ioctl(self, op, arg):
+        if op == 4:  # BP_IOCTL_SEC_COUNT
+            return len(self.data) // self.SEC_SIZE
+        if op == 5:  # BP_IOCTL_SEC_SIZE
+            return self.SEC_SIZE
+        if op == 7 and self.mapped:  # BP_IOCTL_SEC_ADDR
+            return uctypes.addressof(self.data) + arg * self.SEC_SIZE
+
+
+try:
+    bdev = RAMFS(50)
+except MemoryError:
+    print("SKIP")
+    raise SystemExit
+
+uos.VfsFat.mkfs(bdev)
+vfs = uos.VfsFat(bdev)
+uos.mount(vfs, '/ramdisk')
+uos.chdir('/ramdisk')
+
+data = bytes(i & 0xff for i in range(1500))
+with open('contig', 'wb') as f:
+    f.write(data)
+
+# the view reads the file in place
+m = uos.mmap('contig')
+print(type(m), len(m), m == data, bytes(m[510:514]))
+try:
+    m[0] = 1
+except TypeError:
+    print('TypeError')
+
+# a file that has to be followed through the FAT can't be mapped
+with open('frag', 'wb') as f:
+    f.write(b'a' * 600)
+with open('other', 'wb') as f:
+    f.write(b'b' * 100)
+with open('frag', 'ab') as f:
+    f.write(b'c' * 600)
+for name in ('frag', 'empty', 'missing'):
+    if name == 'empty':
+        open(name, 'w').close()
+    try:
+        uos.mmap(name)
+    except OSError as e:
+        print(name, e.args[0] == (uerrno.ENOENT if name == 'missing' else uerrno.EINVAL))
+
+# nor can files on a device that isn't memory mapped
+bdev.mapped = False
+try:
+    uos.mmap('contig')
+except OSError as e:
+    print('unmapped', e.args[0] == uerrno.EINVAL)
+bdev.mapped = True
+print(len(uos.mmap('other')), uos.mmap('other') == b'b' * 100)
+
+uos.umount('/ramdisk')
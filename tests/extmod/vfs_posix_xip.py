@@ -0,0 +1,112 @@
+# test importing a .mpy from the posix filesystem with its bytecode run in
+# place from the mapped file, and the file unmapped once the code is gone
+
+import sys, gc, uio
+
+try:
+    import uos
+    uos.VfsPosix
+    open('/proc/self/maps').close()
+except (ImportError, AttributeError, OSError):
+    print("SKIP")
+    raise SystemExit
+
+DIR = 'vfs_posix_xip_tmp'
+
+
+def cleanup():
+    for name in ('/.mpycache/xipmod.mpy', '/.mpycache', '/xipmod.py', '/xipmod.mpy', ''):
+        try:
+            if name.endswith('py'):
+                uos.remove(DIR + name)
+            else:
+                uos.rmdir(DIR + name)
+        except OSError:
+            pass
+
+
+def mappings():
+    with open('/proc/self/maps') as f:
+        return f.read().count('xipmod.mpy')
+
+
+def ram_to_import():
+    sys.modules.pop('xipmod', None)
+    gc.collect()
+    before = gc.mem_alloc()
+    import xipmod
+    gc.collect()
+    return gc.mem_alloc() - before
+
+
+# a module with a long function, so that its bytecode takes a lot of RAM
+src = ['def big():', '    x = 0']
+for i in range(500):
+    src.append('    x += %d' % i)
+src.append('    return x')
+src.append('''
+def gen(n):
+    for i in range(n):
+        yield i * i
+def adder(a):
+    def add(b):
+        return a + b
+    return add
+def kw(a, *, b=2):
+    return a * b
+def fail():
+    raise ValueError('fail')
+''')
+
+cleanup()
+uos.mkdir(DIR)
+with open(DIR + '/xipmod.py', 'w') as f:
+    f.write('\n'.join(src))
+sys.path.insert(0, DIR)
+
+# the first import compiles the module and saves its bytecode in the cache,
+# which is used to make the .mpy file
+import xipmod
+try:
+    with open(DIR + '/.mpycache/xipmod.mpy', 'rb') as f:
+        mpy = f.read()
+except OSError:
+    sys.path.pop(0)
+    cleanup()
+    print("SKIP")
+    raise SystemExit
+
+# importing from the cache copies the bytecode to RAM
+ram_copied = ram_to_import()
+
+# the .mpy data follows an 8 byte key in the cache file
+uos.remove(DIR + '/xipmod.py')
+with open(DIR + '/xipmod.mpy', 'wb') as f:
+    f.write(mpy[8:])
+ram_in_place = ram_to_import()
+import xipmod
+print('in place', ram_in_place + 2000 < ram_copied, mappings())
+
+# run the code, including names and the traceback that come from the qstrs
+print(xipmod.big(), list(xipmod.gen(4)), xipmod.adder(1)(2), xipmod.kw(3), xipmod.kw(3, b=4))
+print(xipmod.big.__name__, xipmod.kw.__name__, xipmod.fail.__name__)
+try:
+    xipmod.fail()
+except ValueError as er:
+    buf = uio.StringIO()
+    sys.print_exception(er, buf)
+    for line in buf.getvalue().split('\n')[-3:-1]:
+        print(line.strip())
+
+# once the code is collected the file is unmapped
+del xipmod
+sys.modules.pop('xipmod')
+gc.collect()
+print('collected', mappings())
+
+# and it can be imported again
+import xipmod
+print('again', xipmod.kw(5), mappings())
+
+sys.path.pop(0)
+cleanup()
@@ -0,0 +1,26 @@
+# test binary operations between floats, and between floats and small ints
+
+for lhs in (0.0, -0.0, 1.5, -2.25, 3.0):
+    for rhs in (4.0, -0.5, 2, -4, 0):
+        print(lhs, rhs, lhs + rhs, lhs - rhs, lhs * rhs)
+        print(lhs < rhs, lhs > rhs, lhs == rhs, lhs != rhs, lhs <= rhs, lhs >= rhs)
+        try:
+            print(lhs / rhs, lhs // rhs, lhs % rhs, divmod(lhs, rhs))
+        except ZeroDivisionError:
+            print('ZeroDivisionError')
+
+# in-place operations
+x = 1.0
+for i in range(5):
+    x += i
+    x *= 1.5
+    x -= 0.25
+print(x)
+
+# float against other types must still fall back to the generic path
+print(1.5 in [1.5, 2])
+print(2.0 == 2, 2.0 != 3, 2.5 == 'a')
+try:
+    1.5 + 'a'
+except TypeError:
+    print('TypeError')
@@ -0,0 +1,30 @@
+# a hot function whose source file was changed after it was imported must
+# keep running the code it was imported with
+try:
+    import uos as os
+except ImportError:
+    import os
+import sys
+
+if not hasattr(os, "unlink"):
+    print("SKIP")
+    raise SystemExit
+
+sys.path.insert(0, "")
+
+
+def write(val):
+    with open("hot_edit_mod.py", "w") as f:
+        f.write("def h(x):\n    return x + %d\n" % val)
+
+
+write(1)
+import hot_edit_mod
+
+print(hot_edit_mod.h(1))
+write(100)
+for j in range(2000):
+    r = hot_edit_mod.h(j)
+print(r)
+
+os.unlink("hot_edit_mod.py")
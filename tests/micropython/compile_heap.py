@@ -0,0 +1,50 @@
+# test that the lexer and parser don't leave holes among the program's objects
+# when their buffers grow while compiling
+import gc
+
+try:
+    compile
+except NameError:
+    print("SKIP")
+    raise SystemExit
+
+
+def source(doc, nest):
+    src = '"""' + "doc " * doc + '"""\n'
+    for i in range(30):
+        src += (" " * i + "if x%d:\n" if nest else "if x%d: pass\n") % i
+    if nest:
+        return src + " " * 30 + "y = [[[[[[[[[[[[[[[[1]]]]]]]]]]]]]]]]\n"
+    return src + "y = [1]\n"
+
+
+fill = [None] * 2000
+
+
+# count the objects that go in holes left below the compiled code
+def holes(src):
+    # fill any holes left so far, so that new objects go on the end
+    i = 0
+    while i < len(fill):
+        fill[i] = None
+        i += 1
+    gc.collect()
+    i = 0
+    while i < len(fill):
+        fill[i] = object()
+        i += 1
+    code = compile(src, "test", "exec")
+    gc.collect()
+    top = id(code)
+    below = 0
+    while i > 0:
+        if id(object()) < top:
+            below += 1
+        i -= 1
+    return below
+
+
+# a docstring longer than the lexer's token buffer, and nesting deeper than
+# the initial indent table and parser stacks, leave no more than a plain module
+small = holes(source(1, False))
+print(holes(source(200, True)) - small)
@@ -0,0 +1,68 @@
+# test the flash translation layer against a RAM backed flash
+try:
+    FTLRamFlash
+    import uos
+    uos.VfsFat
+except (NameError, ImportError, AttributeError):
+    print("SKIP")
+    raise SystemExit
+
+
+def pattern(block, version, count=1):
+    return bytes((block * 7 + version + i) & 0xff for i in range(512 * count))
+
+# 16 sectors of 4k, 3 kept spare and 7 blocks per sector
+bdev = FTLRamFlash(16)
+print(bdev.ioctl(4, 0), bdev.ioctl(5, 0))
+
+# unwritten blocks read back erased
+buf = bytearray(512)
+bdev.readblocks(5, buf)
+print(buf == b"\xff" * 512)
+
+# writes survive a remount
+bdev.writeblocks(3, pattern(3, 0, 2))
+bdev.writeblocks(4, pattern(9, 1))
+print(bdev.remount())
+buf = bytearray(1024)
+bdev.readblocks(3, buf)
+print(buf[:512] == pattern(3, 0), buf[512:] == pattern(9, 1))
+
+# a write of up to 7 blocks is seen completely or not at all whenever the
+# power is cut
+for block in range(0, 80, 7):
+    bdev.writeblocks(block, pattern(block, 0, 7))
+atomic = True
+for ops in range(0, 40):
+    block = ops * 7 % 77
+    bdev.fail_after(ops)
+    bdev.writeblocks(block, pattern(block, ops + 1, 7))
+    bdev.remount()
+    buf = bytearray(512 * 7)
+    bdev.readblocks(block, buf)
+    if buf == pattern(block, ops + 1, 7):
+        bdev.writeblocks(block, pattern(block, 0, 7))
+    elif buf != pattern(block, 0, 7):
+        atomic = False
+print("atomic", atomic)
+
+# a FAT filesystem on top
+bdev = FTLRamFlash(32)
+uos.VfsFat.mkfs(bdev)
+vfs = uos.VfsFat(bdev)
+with vfs.open("static.txt", "w") as f:
+    f.write("x" * 20000)
+for i in range(300):
+    with vfs.open("log.txt", "w") as f:
+        f.write("entry %d\n" % i)
+print(bdev.remount())
+vfs = uos.VfsFat(bdev)
+with vfs.open("log.txt", "r") as f:
+    print(f.read())
+with vfs.open("static.txt", "r") as f:
+    print(f.read() == "x" * 20000)
+
+# rewriting the same file keeps erases spread over every sector, including
+# those holding the static file
+erases, least, most = bdev.wear()
+print(erases < 300 * 3, most - least <= 40)
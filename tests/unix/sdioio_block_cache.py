@@ -0,0 +1,107 @@
+# test the sdioio block cache against a simulated SD card
+try:
+    SimSDCard
+    import uos
+    uos.VfsFat
+except (NameError, ImportError, AttributeError):
+    print("SKIP")
+    raise SystemExit
+
+
+def block(n, version=0):
+    return bytes([(n + version) & 0xff]) * 512
+
+# half of the 16 blocks read ahead, so sequential single block reads take one
+# command per 8 blocks
+sd = SimSDCard(256, 16)
+sd.writeblocks(0, b"".join(block(n) for n in range(64)))
+print(sd.card()[:2])
+buf = bytearray(512)
+ok = True
+for n in range(40):
+    sd.readblocks(n, buf)
+    ok = ok and buf == block(n)
+print(ok, sd.card()[:2])
+
+# the other half hold back writes, here alternating between a FAT sector and
+# consecutive data sectors
+sd = SimSDCard(256, 16)
+for n in range(40, 46):
+    sd.writeblocks(1, block(n))
+    sd.writeblocks(n, block(n))
+print(sd.card()[:2], sd.card()[2][40 * 512] == 0)
+sd.readblocks(1, buf)
+print(buf == block(45), sd.card()[:2])
+buf = bytearray(512 * 8)
+sd.readblocks(38, buf)
+print(buf[1024:4096] == b"".join(block(n) for n in range(40, 46)))
+sd.sync()
+print(sd.card()[:2], sd.card()[2][40 * 512:46 * 512] == buf[1024:4096])
+sd.sync()
+print(sd.card()[:2])
+
+# blocks are written out once all slots are taken
+for n in range(9):
+    sd.writeblocks(100 + 3 * n, block(n))
+print(sd.card()[:2])
+
+# large writes go straight to the card and replace held back blocks
+sd.writeblocks(120, block(0, 1) * 8)
+sd.sync()
+print(sd.card()[:2], sd.card()[2][124 * 512:125 * 512] == block(0, 1))
+
+# random mix of reads and writes compared against a model
+sd = SimSDCard(64, 8)
+model = [bytes(512) for n in range(64)]
+seed = 1
+def rand(n):
+    global seed
+    seed = (seed * 1103515245 + 12345) & 0x7fffffff
+    return seed % n
+ok = True
+for i in range(2000):
+    start = rand(60)
+    count = 1 + rand(4)
+    if rand(2):
+        data = b"".join(block(start + j, i) for j in range(count))
+        sd.writeblocks(start, data)
+        for j in range(count):
+            model[start + j] = block(start + j, i)
+    else:
+        buf = bytearray(512 * count)
+        sd.readblocks(start, buf)
+        ok = ok and buf == b"".join(model[start:start + count])
+    if rand(50) == 0:
+        sd.sync()
+sd.sync()
+print(ok, sd.card()[2] == b"".join(model))
+
+# out of range requests still fail
+try:
+    sd.writeblocks(64, block(0))
+except OSError:
+    print("OSError")
+try:
+    sd.readblocks(63, bytearray(1024))
+except OSError:
+    print("OSError")
+
+# a file written in small pieces and read back in small pieces
+def file_cmds(cache_blocks):
+    sd = SimSDCard(512, cache_blocks)
+    uos.VfsFat.mkfs(sd)
+    vfs = uos.VfsFat(sd)
+    before = sd.card()[:2]
+    with vfs.open("data.bin", "wb") as f:
+        for i in range(64):
+            f.write(bytes([i]) * 500)
+    vfs = uos.VfsFat(sd)
+    with vfs.open("data.bin", "rb") as f:
+        ok = all(f.read(500) == bytes([i]) * 500 for i in range(64))
+    after = sd.card()[:2]
+    return ok, after[0] - before[0], after[1] - before[1]
+
+plain = file_cmds(0)
+cached = file_cmds(16)
+print(plain[0], cached[0])
+print(cached[1] * 4 < plain[1], cached[2] * 2 < plain[2])